@@ -0,0 +1,483 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            AssetManager.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Streams assets from disk without stalling the frame.
+ * The manager is an engine system: add it with Engine::AddOn. Loads are
+ * queued by priority and run on dedicated I/O threads, which take a few
+ * of the most urgent at a time, read their files together through a
+ * FileReader and decode them into the asset type. Asking for an asset that is
+ * already loaded or on its way hands out the same one instead of
+ * reading it again. Handles count references, and the asset is freed
+ * with the last one. Mounted packs are searched before loose files.
+ * Completion callbacks always run on the main thread, in BeginFrame at
+ * the start of the frame, never from inside Load.
+ * With hot reload on, files changed on disk are loaded again in the
+ * background and swapped in at the start of a frame, behind the handles
+ * already given out.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef AssetManager_MODULE_H
+#define AssetManager_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Assets/FileReader.hpp"
+#include "Ludus/System/Node.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Ludus
+{
+    class FileWatcher;
+    class JobSystem;
+    class PackReader;
+
+    /* ===================================================================== */
+    /**
+     * How urgently an asset is needed. Higher priorities load first,
+     * equal ones in the order they were asked for.
+    **/
+    /* ===================================================================== */
+    enum class AssetPriority : std::uint8_t
+    {
+        LOW      = 0x00,  /* Prefetching, nobody waits on it yet. */
+        NORMAL   = 0x01,  /* Needed soon. */
+        HIGH     = 0x02,  /* Needed for the next frames. */
+        CRITICAL = 0x03,  /* The game can't go on without it. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * Where an asset is in its life.
+    **/
+    /* ===================================================================== */
+    enum class AssetState : std::uint8_t
+    {
+        QUEUED  = 0x00,  /* Waiting for an I/O thread. */
+        LOADING = 0x01,  /* Being read and decoded. */
+        READY   = 0x02,  /* Loaded, the value can be used. */
+        FAILED  = 0x03,  /* The file couldn't be read or decoded. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * Turns the bytes of a file into an asset. Specialize it for asset
+     * types that aren't constructible from the bytes. Runs on the I/O
+     * threads, and may throw to fail the load.
+     * @tparam T                    The type of the asset.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    struct AssetLoader
+    {
+        /* ================================================================= */
+        /**
+         * Decodes an asset.
+         * @param bytes             The contents of the file.
+         * @returns                 The asset.
+        **/
+        /* ================================================================= */
+        static T Load(std::vector<std::uint8_t> &&bytes);
+    };
+
+    /* ===================================================================== */
+    /** Text files load as their contents. */
+    /* ===================================================================== */
+    template <>
+    struct AssetLoader<std::string>
+    {
+        /* ================================================================= */
+        /**
+         * Decodes a text file.
+         * @param bytes             The contents of the file.
+         * @returns                 The text.
+        **/
+        /* ================================================================= */
+        static std::string Load(std::vector<std::uint8_t> &&bytes);
+    };
+
+    /* ===================================================================== */
+    /**
+     * The shared state of one asset, whatever its type.
+    **/
+    /* ===================================================================== */
+    struct AssetSlot
+    {
+        /** Decodes the bytes of the file into the asset. */
+        using Decoder = std::function<std::shared_ptr<void const>(
+            std::vector<std::uint8_t> &&bytes)>;
+        /** Called on the main thread once the asset is done. */
+        using Callback = std::function<void(std::shared_ptr<AssetSlot> const &slot)>;
+
+        /** The file the asset comes from. */
+        std::string path_;
+        /** Decodes the bytes of the file. */
+        Decoder decoder_;
+        /** Where the asset is in its life. */
+        std::atomic<AssetState> state_;
+        /** The highest priority it was asked for with. */
+        AssetPriority priority_;
+        /** The asset, once ready. */
+        std::shared_ptr<void const> value_;
+        /** Why the load failed, if it did. */
+        std::string error_;
+        /** The callbacks not delivered yet, guarded by the manager. */
+        std::vector<Callback> callbacks_;
+        /** Bumped every time a reload is swapped in. */
+        std::uint32_t version_;
+        /** The reloaded asset waiting to be swapped in, guarded by the manager. */
+        std::shared_ptr<void const> reloaded_;
+        /** Why the reload failed, guarded by the manager. */
+        std::string reloadError_;
+        /** Set while a reload is on its way, guarded by the manager. */
+        bool reloading_;
+        /** Set when the file changed again meanwhile, guarded by the manager. */
+        bool changed_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * A counted reference to an asset, loaded or not.
+     * @tparam T                    The type of the asset.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    class AssetHandle
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a handle to nothing.
+        **/
+        /* ================================================================= */
+        AssetHandle() = default;
+
+        /* ================================================================= */
+        /**
+         * Gets whether the handle refers to an asset.
+         * @returns                 True if the handle isn't empty.
+        **/
+        /* ================================================================= */
+        bool IsValid() const;
+        /* ================================================================= */
+        /**
+         * Gets where the asset is in its life.
+         * @returns                 The state of the asset.
+        **/
+        /* ================================================================= */
+        AssetState GetState() const;
+        /* ================================================================= */
+        /**
+         * Gets whether the asset can be used.
+         * @returns                 True if the asset is loaded.
+        **/
+        /* ================================================================= */
+        bool IsReady() const;
+        /* ================================================================= */
+        /**
+         * Gets the asset.
+         * @returns                 The asset.
+         * @throw std::logic_error  If the asset isn't loaded yet.
+         * @throw std::runtime_error If the asset failed to load.
+        **/
+        /* ================================================================= */
+        T const &Get() const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the asset, kept alive even after a reload swaps it out.
+         * References from Get only last until the next BeginFrame when
+         * hot reload is on.
+         * @returns                 The asset.
+         * @throw std::logic_error  If the asset isn't loaded yet.
+         * @throw std::runtime_error If the asset failed to load.
+        **/
+        /* ================================================================= */
+        std::shared_ptr<T const> GetShared() const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets how many times the asset was reloaded.
+         * @returns                 The version of the asset.
+        **/
+        /* ================================================================= */
+        std::uint32_t GetVersion() const;
+        /* ================================================================= */
+        /**
+         * Gets the file the asset comes from.
+         * @returns                 The path of the asset.
+        **/
+        /* ================================================================= */
+        std::string const &GetPath() const;
+        /* ================================================================= */
+        /**
+         * Gets why the asset failed to load.
+         * @returns                 The error, empty unless it failed.
+        **/
+        /* ================================================================= */
+        std::string const &GetError() const;
+    private:
+        friend class AssetManager;
+
+        /* ================================================================= */
+        /**
+         * Creates a handle to an asset.
+         * @param slot              The state of the asset.
+        **/
+        /* ================================================================= */
+        explicit AssetHandle(std::shared_ptr<AssetSlot> slot);
+
+        /** The state of the asset. */
+        std::shared_ptr<AssetSlot> slot_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The engine system streaming assets.
+    **/
+    /* ===================================================================== */
+    class AssetManager final : public Node
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates the manager with two I/O threads.
+        **/
+        /* ================================================================= */
+        AssetManager();
+        /* ================================================================= */
+        /**
+         * Creates the manager.
+         * @param threadCount       The number of I/O threads, at least one.
+         * @param backend           How loose files are read. Falls back
+         *                          on PREAD when io_uring isn't available.
+        **/
+        /* ================================================================= */
+        explicit AssetManager(unsigned threadCount,
+            FileBackend backend = FileBackend::IO_URING);
+        /* ================================================================= */
+        /**
+         * Stops the I/O threads. Queued loads never finish and their
+         * callbacks are dropped.
+        **/
+        /* ================================================================= */
+        ~AssetManager();
+
+        /* ================================================================= */
+        /**
+         * Asks for an asset. Returns at once, the asset loads in the
+         * background unless it's already loaded or on its way.
+         * @tparam T                The type of the asset.
+         * @param path              The file holding the asset.
+         * @param priority          How urgently the asset is needed. A
+         *                          queued asset moves up if asked for
+         *                          again with a higher priority.
+         * @param callback          Called on the main thread, during a
+         *                          later BeginFrame, once the asset is
+         *                          ready or failed.
+         * @returns                 A handle to the asset.
+        **/
+        /* ================================================================= */
+        template <typename T>
+        AssetHandle<T> Load(std::string const &path,
+            AssetPriority priority = AssetPriority::NORMAL,
+            std::function<void(AssetHandle<T> const &asset)> callback = nullptr);
+        /* ================================================================= */
+        /**
+         * Delivers the callbacks of the assets done since the last frame.
+        **/
+        /* ================================================================= */
+        void BeginFrame() override;
+        /* ================================================================= */
+        /**
+         * Reads assets out of a pack before looking for loose files. The
+         * packs mounted last are searched first.
+         * @param pack              The pack to read from.
+        **/
+        /* ================================================================= */
+        void Mount(std::shared_ptr<PackReader const> pack);
+        /* ================================================================= */
+        /**
+         * Turns hot reload on or off. Only assets read from loose files
+         * are watched.
+         * @param enabled           Whether to watch the files.
+         * @throw std::runtime_error If the files can't be watched.
+        **/
+        /* ================================================================= */
+        void SetHotReload(bool enabled) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of assets queued, loading, or waiting for their
+         * callbacks.
+         * @returns                 The number of pending assets.
+        **/
+        /* ================================================================= */
+        size_t GetPendingCount() const;
+        /* ================================================================= */
+        /**
+         * Gets how loose files are read.
+         * @returns                 The backend in use.
+        **/
+        /* ================================================================= */
+        FileBackend GetFileBackend() const;
+    private:
+        struct PendingRead;
+
+        /* ================================================================= */
+        /** A load waiting for an I/O thread. */
+        /* ================================================================= */
+        struct Request
+        {
+            /** The asset to load. */
+            std::shared_ptr<AssetSlot> slot_;
+            /** The priority it was asked for with. */
+            AssetPriority priority_;
+            /** The order it was asked in, to break ties. */
+            std::uint64_t sequence_;
+            /** Whether the asset is already loaded and changed on disk. */
+            bool reload_;
+
+            /* ============================================================= */
+            /**
+             * Orders the requests, the most urgent last.
+             * @param rhs           The other request.
+             * @returns             True if this one should run later.
+            **/
+            /* ============================================================= */
+            bool operator<(Request const &rhs) const;
+        };
+
+        /* ================================================================= */
+        /**
+         * Finds or creates the slot of an asset and queues it if needed.
+         * @param key               The path and type of the asset.
+         * @param path              The file holding the asset.
+         * @param priority          How urgently the asset is needed.
+         * @param decoder           Decodes the asset.
+         * @param callback          Called once the asset is done, or null.
+         * @returns                 The slot of the asset.
+        **/
+        /* ================================================================= */
+        std::shared_ptr<AssetSlot> Enqueue(std::string const &key,
+            std::string const &path, AssetPriority priority,
+            AssetSlot::Decoder decoder, AssetSlot::Callback callback);
+        /* ================================================================= */
+        /**
+         * Starts reading the bytes of an asset. Loose files are queued on
+         * the reader, packs are only read once the bytes are needed.
+         * @param path              The file holding the asset.
+         * @param packs             The packs mounted.
+         * @param read              Tracks the read.
+        **/
+        /* ================================================================= */
+        void StartRead(std::string const &path,
+            std::vector<std::shared_ptr<PackReader const> > const &packs,
+            PendingRead &read);
+        /* ================================================================= */
+        /**
+         * Waits for the bytes of an asset.
+         * @param path              The file holding the asset.
+         * @param read              The read started for it.
+         * @returns                 The bytes of the asset.
+         * @throw std::runtime_error If the file can't be read.
+        **/
+        /* ================================================================= */
+        std::vector<std::uint8_t> FinishRead(std::string const &path,
+            PendingRead &read) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Reads and decodes an asset.
+         * @param slot              The asset to load.
+         * @param read              The read started for it.
+        **/
+        /* ================================================================= */
+        void Fetch(AssetSlot &slot, PendingRead &read);
+        /* ================================================================= */
+        /**
+         * Reads and decodes an asset again, for BeginFrame to swap in.
+         * @param slot              The asset to reload.
+         * @param read              The read started for it.
+        **/
+        /* ================================================================= */
+        void Reload(std::shared_ptr<AssetSlot> const &slot, PendingRead &read);
+        /* ================================================================= */
+        /**
+         * Starts watching the file of an asset. Needs the mutex.
+         * @param slot              The asset to watch.
+        **/
+        /* ================================================================= */
+        void Watch(std::shared_ptr<AssetSlot> const &slot);
+        /* ================================================================= */
+        /**
+         * Queues the reload of an asset. Needs the mutex.
+         * @param slot              The asset to reload.
+        **/
+        /* ================================================================= */
+        void QueueReload(std::shared_ptr<AssetSlot> const &slot);
+        /* ================================================================= */
+        /**
+         * Reloads the assets read from a file that changed.
+         * @param path              The normalized path of the file.
+        **/
+        /* ================================================================= */
+        void OnFileChanged(std::string const &path);
+        /* ================================================================= */
+        /**
+         * The loop run by every I/O thread.
+        **/
+        /* ================================================================= */
+        void WorkerLoop();
+
+        /** The I/O threads. */
+        std::vector<std::thread> workers_;
+        /** The loads waiting, the most urgent on top. */
+        std::priority_queue<Request> queue_;
+        /** Every asset asked for, by path and type. */
+        std::unordered_map<std::string, std::weak_ptr<AssetSlot> > cache_;
+        /** The assets watched for hot reload, by normalized path. */
+        std::unordered_map<std::string, std::vector<std::weak_ptr<AssetSlot> > > watched_;
+        /** The packs searched before loose files, the last one first. */
+        std::vector<std::shared_ptr<PackReader const> > packs_;
+        /** The assets with callbacks to deliver. */
+        std::vector<std::shared_ptr<AssetSlot> > completed_;
+        /** The assets reloaded, waiting to be swapped in. */
+        std::vector<std::shared_ptr<AssetSlot> > swaps_;
+        /** Guards everything above and the callbacks of the slots. */
+        mutable std::mutex mutex_;
+        /** Wakes the I/O threads when loads get queued. */
+        std::condition_variable available_;
+        /** The number of loads asked for, to order them. */
+        std::uint64_t sequence_;
+        /** The number of assets not delivered yet. */
+        std::atomic<size_t> pending_;
+        /** Set when the I/O threads should exit. */
+        bool stopping_;
+        /** Watches the files of the assets, when hot reload is on. */
+        std::unique_ptr<FileWatcher> watcher_;
+        /** Runs the completions of the reads, waking the I/O threads. */
+        std::unique_ptr<JobSystem> reads_;
+        /** Reads the loose files, outlived by the jobs above. */
+        std::unique_ptr<FileReader> reader_;
+    };
+}
+
+#include "AssetManager.tpp"
+/* ========================================================================= */
+#endif // AssetManager_MODULE_H
+/* ========================================================================= */
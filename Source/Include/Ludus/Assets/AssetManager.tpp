@@ -0,0 +1,118 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            AssetManager.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Implements the typed side of the asset manager.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <stdexcept>
+#include <typeinfo>
+#include <utility>
+
+namespace Ludus
+{
+    template <typename T>
+    T AssetLoader<T>::Load(std::vector<std::uint8_t> &&bytes)
+    {
+        return T(std::move(bytes));
+    }
+
+    template <typename T>
+    AssetHandle<T>::AssetHandle(std::shared_ptr<AssetSlot> slot) :
+        slot_(std::move(slot))
+    {
+    }
+
+    template <typename T>
+    bool AssetHandle<T>::IsValid() const
+    {
+        return static_cast<bool>(slot_);
+    }
+
+    template <typename T>
+    AssetState AssetHandle<T>::GetState() const
+    {
+        return slot_->state_.load(std::memory_order_acquire);
+    }
+
+    template <typename T>
+    bool AssetHandle<T>::IsReady() const
+    {
+        return slot_ && GetState() == AssetState::READY;
+    }
+
+    template <typename T>
+    T const &AssetHandle<T>::Get() const noexcept(false)
+    {
+        switch(GetState())
+        {
+        case AssetState::READY:
+            return *static_cast<T const *>(slot_->value_.get());
+        case AssetState::FAILED:
+            throw std::runtime_error("The asset " + slot_->path_
+                + " failed to load: " + slot_->error_);
+        default:
+            throw std::logic_error("The asset " + slot_->path_
+                + " isn't loaded yet.");
+        }
+    }
+
+    template <typename T>
+    std::shared_ptr<T const> AssetHandle<T>::GetShared() const noexcept(false)
+    {
+        // Get checks the state.
+        Get();
+        return std::static_pointer_cast<T const>(slot_->value_);
+    }
+
+    template <typename T>
+    std::uint32_t AssetHandle<T>::GetVersion() const
+    {
+        return slot_->version_;
+    }
+
+    template <typename T>
+    std::string const &AssetHandle<T>::GetPath() const
+    {
+        return slot_->path_;
+    }
+
+    template <typename T>
+    std::string const &AssetHandle<T>::GetError() const
+    {
+        return slot_->error_;
+    }
+
+    template <typename T>
+    AssetHandle<T> AssetManager::Load(std::string const &path,
+        AssetPriority priority,
+        std::function<void(AssetHandle<T> const &asset)> callback)
+    {
+        AssetSlot::Callback erased;
+        if(callback)
+        {
+            erased = [callback = std::move(callback)](
+                std::shared_ptr<AssetSlot> const &slot)
+            {
+                callback(AssetHandle<T>(slot));
+            };
+        }
+        // The same file loaded as two types is two different assets.
+        std::string const key = std::string(typeid(T).name()) + '|' + path;
+        return AssetHandle<T>(Enqueue(key, path, priority,
+            [](std::vector<std::uint8_t> &&bytes) -> std::shared_ptr<void const>
+            {
+                return std::make_shared<T const>(
+                    AssetLoader<T>::Load(std::move(bytes)));
+            },
+            std::move(erased)));
+    }
+}
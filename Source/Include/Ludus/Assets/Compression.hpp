@@ -0,0 +1,108 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Compression.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A small LZ codec and checksums for packed assets.
+ * The codec works on independent blocks of up to 64 KiB, so blocks can be
+ * decompressed in any order and on any thread. It favours decompression
+ * speed over ratio: a block is a run of sequences, each a few literal
+ * bytes copied as is followed by a match copied from earlier in the
+ * block.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Compression_MODULE_H
+#define Compression_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Ludus
+{
+    namespace Compression
+    {
+        /** The largest block the codec takes. */
+        constexpr size_t MaxBlockSize = 64 * 1024;
+
+        /* ================================================================= */
+        /**
+         * Gets how big a block may get when compressed, for incompressible
+         * data.
+         * @param size              The size of the block.
+         * @returns                 The largest compressed size.
+        **/
+        /* ================================================================= */
+        constexpr size_t GetMaxCompressedSize(size_t size)
+        {
+            return size + size / 255 + 16;
+        }
+
+        /* ================================================================= */
+        /**
+         * Compresses a block.
+         * @param data              The block to compress.
+         * @param size              The size of the block, at most
+         *                          MaxBlockSize.
+         * @returns                 The compressed block.
+         * @throw std::length_error If the block is bigger than MaxBlockSize.
+        **/
+        /* ================================================================= */
+        std::vector<std::uint8_t> Compress(std::uint8_t const *data, size_t size)
+            noexcept(false);
+        /* ================================================================= */
+        /**
+         * Decompresses a block. Corrupt blocks are caught, never read or
+         * written out of bounds.
+         * @param data              The compressed block.
+         * @param size              The size of the compressed block.
+         * @param out               Where to write the block.
+         * @param outSize           The size of the block once decompressed.
+         * @throw std::runtime_error If the block is corrupt or doesn't
+         *                          decompress to exactly outSize bytes.
+        **/
+        /* ================================================================= */
+        void Decompress(std::uint8_t const *data, size_t size, std::uint8_t *out,
+            size_t outSize) noexcept(false);
+
+        /* ================================================================= */
+        /**
+         * Computes the CRC-32 of some bytes, to catch corrupt blocks.
+         * @param data              The bytes to check.
+         * @param size              The number of bytes.
+         * @returns                 The checksum.
+        **/
+        /* ================================================================= */
+        std::uint32_t Checksum(std::uint8_t const *data, size_t size);
+        /* ================================================================= */
+        /**
+         * Hashes a path with 64 bit FNV-1a, to look files up.
+         * @param path              The path to hash.
+         * @returns                 The hash.
+        **/
+        /* ================================================================= */
+        constexpr std::uint64_t HashPath(std::string_view path)
+        {
+            std::uint64_t hash = 0xCBF29CE484222325ull;
+            for(char const c : path)
+            {
+                hash = (hash ^ static_cast<std::uint8_t>(c)) * 0x100000001B3ull;
+            }
+            return hash;
+        }
+    }
+}
+
+/* ========================================================================= */
+#endif // Compression_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,199 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            FileReader.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Reads whole files in the background, many at a time.
+ * On Linux the reads go through io_uring: the opens, sizes, reads and
+ * closes of every queued file are batched into the ring and submitted
+ * together, so thousands of small assets cost a handful of system calls.
+ * Everywhere else, or on kernels without io_uring, a pool of threads
+ * reads the files with pread instead.
+ * Either way every finished file is handed to the job system as a job,
+ * so decoding happens on the workers and can be waited on.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef FileReader_MODULE_H
+#define FileReader_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Ludus
+{
+    class JobCounter;
+    class JobSystem;
+
+    /* ===================================================================== */
+    /**
+     * How files get read.
+    **/
+    /* ===================================================================== */
+    enum class FileBackend : std::uint8_t
+    {
+        PREAD    = 0x00,  /* A pool of threads, one blocking read at a time. */
+        IO_URING = 0x01,  /* Batches submitted to a Linux io_uring. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * A file once read.
+    **/
+    /* ===================================================================== */
+    struct FileRead
+    {
+        /** The file read. */
+        std::string path_;
+        /** The contents of the file. */
+        std::vector<std::uint8_t> bytes_;
+        /** Why the file couldn't be read, empty if it was. */
+        std::string error_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Reads files in the background and completes them into the job
+     * system.
+    **/
+    /* ===================================================================== */
+    class FileReader final
+    {
+    public:
+        /** Runs on the job system for every file read. */
+        using Completion = std::function<void(FileRead &read)>;
+
+        /* ================================================================= */
+        /**
+         * Creates the reader.
+         * @param jobs              Runs the completions. Must outlive the
+         *                          reader.
+         * @param backend           How to read the files. Falls back on
+         *                          PREAD when io_uring isn't available.
+         * @param threadCount       The number of threads reading with
+         *                          PREAD, at least one.
+        **/
+        /* ================================================================= */
+        explicit FileReader(JobSystem &jobs, FileBackend backend = FileBackend::IO_URING,
+            unsigned threadCount = 4);
+        /* ================================================================= */
+        /**
+         * Finishes every queued read and stops the threads.
+        **/
+        /* ================================================================= */
+        ~FileReader();
+        FileReader(FileReader const &) = delete;
+        FileReader &operator=(FileReader const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Queues files to be read. Returns at once.
+         * @param paths             The files to read.
+         * @param completion        Runs as a job for every file, read or
+         *                          not, in no particular order.
+         * @param counter           Counts the completions, so they can be
+         *                          waited on with JobSystem::Wait, or null.
+        **/
+        /* ================================================================= */
+        void Read(std::vector<std::string> const &paths, Completion completion,
+            JobCounter *counter = nullptr);
+        /* ================================================================= */
+        /**
+         * Gets how the files are read.
+         * @returns                 The backend in use.
+        **/
+        /* ================================================================= */
+        FileBackend GetBackend() const;
+        /* ================================================================= */
+        /**
+         * Gets whether a backend works on this machine.
+         * @param backend           The backend to check.
+         * @returns                 True if the backend can be used.
+        **/
+        /* ================================================================= */
+        static bool IsSupported(FileBackend backend);
+    private:
+        struct Ring;
+
+        /* ================================================================= */
+        /** A file waiting to be read. */
+        /* ================================================================= */
+        struct Request
+        {
+            /** The file to read. */
+            std::string path_;
+            /** Runs once the file is read. */
+            std::shared_ptr<Completion const> completion_;
+            /** Counts the completion, or null. */
+            JobCounter *counter_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Hands a finished file to the job system.
+         * @param request           The request of the file.
+         * @param read              The file read.
+        **/
+        /* ================================================================= */
+        void Complete(Request &request, FileRead &&read);
+        /* ================================================================= */
+        /**
+         * Takes requests off the queue.
+         * @param requests          Receives the requests taken.
+         * @param max               The most requests to take.
+         * @param block             Whether to wait when none are queued.
+         * @returns                 False once the reader is stopping and
+         *                          nothing is left to wait for.
+        **/
+        /* ================================================================= */
+        bool TakeRequests(std::deque<Request> &requests, size_t max, bool block);
+        /* ================================================================= */
+        /**
+         * The loop of every thread reading with PREAD.
+        **/
+        /* ================================================================= */
+        void PreadLoop();
+        /* ================================================================= */
+        /**
+         * The loop of the thread driving the ring.
+        **/
+        /* ================================================================= */
+        void RingLoop();
+
+        /** Runs the completions. */
+        JobSystem &jobs_;
+        /** How the files are read. */
+        FileBackend backend_;
+        /** The ring, when reading with IO_URING. */
+        std::unique_ptr<Ring> ring_;
+        /** The threads reading. */
+        std::vector<std::thread> threads_;
+        /** The files waiting to be read. */
+        std::deque<Request> queue_;
+        /** Guards the queue. */
+        std::mutex mutex_;
+        /** Wakes the threads when files get queued. */
+        std::condition_variable available_;
+        /** Set when the threads should exit once the queue is empty. */
+        bool stopping_;
+    };
+}
+
+/* ========================================================================= */
+#endif // FileReader_MODULE_H
+/* ========================================================================= */
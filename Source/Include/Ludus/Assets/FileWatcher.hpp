@@ -0,0 +1,107 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            FileWatcher.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Notices when files change on disk.
+ * On Linux the directories of the watched files are handed to inotify,
+ * since editors usually save by replacing the file rather than writing
+ * into it. Elsewhere the modification times are polled instead.
+ * Changes are reported from the watcher's own thread.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef FileWatcher_MODULE_H
+#define FileWatcher_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Watches files and reports the ones written to.
+    **/
+    /* ===================================================================== */
+    class FileWatcher final
+    {
+    public:
+        /** Called with the normalized path of every file changed. */
+        using Callback = std::function<void(std::string const &path)>;
+
+        /* ================================================================= */
+        /**
+         * Starts watching nothing.
+         * @param changed           Called from the watcher's thread for
+         *                          every change.
+         * @throw std::runtime_error If the system refuses to watch files.
+        **/
+        /* ================================================================= */
+        explicit FileWatcher(Callback changed) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Stops watching.
+        **/
+        /* ================================================================= */
+        ~FileWatcher();
+        FileWatcher(FileWatcher const &) = delete;
+        FileWatcher &operator=(FileWatcher const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Starts watching a file. The file doesn't have to exist yet, but
+         * its directory does.
+         * @param path              The file to watch.
+        **/
+        /* ================================================================= */
+        void Add(std::string const &path);
+        /* ================================================================= */
+        /**
+         * Turns a path into the form changes are reported with.
+         * @param path              The path of a file.
+         * @returns                 The absolute, normalized path.
+        **/
+        /* ================================================================= */
+        static std::string Normalize(std::string const &path);
+    private:
+        /* ================================================================= */
+        /**
+         * The loop of the watcher's thread.
+        **/
+        /* ================================================================= */
+        void WatchLoop();
+
+        /** Called for every change. */
+        Callback changed_;
+        /** The files watched, with their last modification time. */
+        std::unordered_map<std::string, std::filesystem::file_time_type> files_;
+        /** The directories handed to inotify, by watch descriptor. */
+        std::unordered_map<int, std::string> directories_;
+        /** Guards the files and the directories. */
+        std::mutex mutex_;
+        /** The inotify instance, -1 when polling. */
+        int fd_;
+        /** Set when the thread should exit. */
+        std::atomic<bool> stopping_;
+        /** The thread waiting for changes. */
+        std::thread thread_;
+    };
+}
+
+/* ========================================================================= */
+#endif // FileWatcher_MODULE_H
+/* ========================================================================= */
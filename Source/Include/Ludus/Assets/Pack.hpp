@@ -0,0 +1,241 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Pack.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Packs many asset files into a single archive, so they are opened once
+ * instead of one by one.
+ * The files are laid end to end and cut into 64 KiB blocks, each
+ * compressed on its own and guarded by a checksum. A table of contents at
+ * the front, sorted by the hash of the paths, finds any file without
+ * touching the others. Reading a file only decompresses the blocks it
+ * spans, spread across the job system when one is given.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Pack_MODULE_H
+#define Pack_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/System/MappedFile.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace Ludus
+{
+    class JobSystem;
+
+    /* ===================================================================== */
+    /**
+     * Gathers files and writes them as a pack.
+    **/
+    /* ===================================================================== */
+    class PackWriter final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Adds a file to the pack.
+         * @param path              The path the file is read back with.
+         * @param data              The contents of the file.
+         * @param size              The size of the file.
+         * @throw std::invalid_argument If the path was already added.
+        **/
+        /* ================================================================= */
+        void Add(std::string const &path, std::uint8_t const *data, size_t size)
+            noexcept(false);
+        /* ================================================================= */
+        /**
+         * Writes the pack into memory.
+         * @param jobs              Compresses the blocks in parallel, or
+         *                          null to do it on the calling thread.
+         * @returns                 The bytes of the pack.
+        **/
+        /* ================================================================= */
+        std::vector<std::uint8_t> Serialize(JobSystem *jobs = nullptr) const;
+        /* ================================================================= */
+        /**
+         * Writes the pack to a file.
+         * @param path              The file to write.
+         * @param jobs              Compresses the blocks in parallel, or
+         *                          null to do it on the calling thread.
+         * @throw std::runtime_error If the file can't be written.
+        **/
+        /* ================================================================= */
+        void Save(std::string const &path, JobSystem *jobs = nullptr) const
+            noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of files added.
+         * @returns                 The number of files.
+        **/
+        /* ================================================================= */
+        size_t GetFileCount() const;
+    private:
+        /* ================================================================= */
+        /** A file added to the pack. */
+        /* ================================================================= */
+        struct File
+        {
+            /** The path the file is read back with. */
+            std::string path_;
+            /** Where the file starts in the contents. */
+            std::uint64_t offset_;
+            /** The size of the file. */
+            std::uint64_t size_;
+        };
+
+        /** The files, in the order they were added. */
+        std::vector<File> files_;
+        /** The paths added so far. */
+        std::unordered_set<std::string> paths_;
+        /** Every file end to end. */
+        std::vector<std::uint8_t> contents_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Reads files out of a pack, in place. Readers are safe to use from
+     * many threads at once.
+    **/
+    /* ===================================================================== */
+    class PackReader final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Maps a pack. Only the table of contents is read up front.
+         * @param path              The file holding the pack.
+         * @throw std::runtime_error If the file can't be mapped or isn't
+         *                          a valid pack.
+        **/
+        /* ================================================================= */
+        explicit PackReader(std::string const &path) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Reads a pack already in memory. The bytes must outlive the
+         * reader.
+         * @param data              The bytes of the pack, aligned to 8.
+         * @param size              The number of bytes.
+         * @throw std::runtime_error If the bytes aren't a valid pack.
+        **/
+        /* ================================================================= */
+        PackReader(std::uint8_t const *data, size_t size) noexcept(false);
+        PackReader(PackReader const &) = delete;
+        PackReader &operator=(PackReader const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Gets whether the pack holds a file.
+         * @param path              The path of the file.
+         * @returns                 True if the file is in the pack.
+        **/
+        /* ================================================================= */
+        bool Contains(std::string_view path) const;
+        /* ================================================================= */
+        /**
+         * Gets the size of a file.
+         * @param path              The path of the file.
+         * @returns                 The size of the file once read.
+         * @throw std::out_of_range If the pack doesn't hold the file.
+        **/
+        /* ================================================================= */
+        size_t GetFileSize(std::string_view path) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Reads a file, decompressing only the blocks it spans.
+         * @param path              The path of the file.
+         * @param jobs              Decompresses the blocks in parallel, or
+         *                          null to do it on the calling thread.
+         * @returns                 The contents of the file.
+         * @throw std::out_of_range If the pack doesn't hold the file.
+         * @throw std::runtime_error If a block is corrupt.
+        **/
+        /* ================================================================= */
+        std::vector<std::uint8_t> Read(std::string_view path,
+            JobSystem *jobs = nullptr) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the path of a file, in the order of the table of contents.
+         * @param index             The index of the file.
+         * @returns                 The path of the file.
+         * @throw std::out_of_range If there aren't that many files.
+        **/
+        /* ================================================================= */
+        std::string_view GetPath(size_t index) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of files in the pack.
+         * @returns                 The number of files.
+        **/
+        /* ================================================================= */
+        size_t GetFileCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of blocks in the pack.
+         * @returns                 The number of blocks.
+        **/
+        /* ================================================================= */
+        size_t GetBlockCount() const;
+    private:
+        /* ================================================================= */
+        /**
+         * Checks the header and the table of contents.
+         * @throw std::runtime_error If the pack is broken.
+        **/
+        /* ================================================================= */
+        void Open() noexcept(false);
+        /* ================================================================= */
+        /**
+         * Finds a file in the table of contents.
+         * @param path              The path of the file.
+         * @returns                 The index of the file, or the number of
+         *                          files if it isn't there.
+        **/
+        /* ================================================================= */
+        size_t Find(std::string_view path) const;
+        /* ================================================================= */
+        /**
+         * Checks and decompresses a block.
+         * @param block             The index of the block.
+         * @param out               Where to write the block.
+         * @throw std::runtime_error If the block is corrupt.
+        **/
+        /* ================================================================= */
+        void DecodeBlock(size_t block, std::uint8_t *out) const noexcept(false);
+
+        /** The mapped file, if the pack came from one. */
+        std::unique_ptr<MappedFile> file_;
+        /** The bytes of the pack. */
+        std::uint8_t const *data_;
+        /** The size of the pack. */
+        size_t size_;
+        /** The number of files. */
+        size_t fileCount_;
+        /** The number of blocks. */
+        size_t blockCount_;
+        /** The size of every file end to end. */
+        std::uint64_t contentSize_;
+        /** The table of paths. */
+        char const *strings_;
+        /** The entries of the files, sorted by hash. */
+        std::uint8_t const *files_;
+        /** The entries of the blocks, in order. */
+        std::uint8_t const *blocks_;
+    };
+}
+
+/* ========================================================================= */
+#endif // Pack_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,303 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Archetype.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Stores every entity that has exactly the same set of components.
+ * Entities are kept in fixed size chunks; inside a chunk every component
+ * type has its own tightly packed column, so walking one component of
+ * many entities touches consecutive memory. Rows stay dense: removing an
+ * entity moves the last one into its place.
+ * Every column of a chunk remembers the version of the world when it was
+ * last written and when an entity last gained the component there, so
+ * queries can skip chunks nothing happened to.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Archetype_MODULE_H
+#define Archetype_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Entity/Entity.hpp"
+#include <memory>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * A fixed size block of memory holding the columns of some entities.
+    **/
+    /* ===================================================================== */
+    class Chunk final
+    {
+    public:
+        /** The size of every chunk in bytes. */
+        static constexpr size_t Size = 16 * 1024;
+        /** The alignment of every chunk and column. */
+        static constexpr size_t Alignment = 64;
+
+        /* ================================================================= */
+        /**
+         * Allocates an empty chunk.
+         * @param columnCount       The number of component columns.
+        **/
+        /* ================================================================= */
+        explicit Chunk(size_t columnCount);
+        /* ================================================================= */
+        /**
+         * Gets the number of entities in the chunk.
+         * @returns                 The number of entities.
+        **/
+        /* ================================================================= */
+        size_t GetCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the entities of the chunk, stored in the first column.
+         * @returns                 A pointer to the first entity.
+        **/
+        /* ================================================================= */
+        Entity *GetEntities() const;
+        /* ================================================================= */
+        /**
+         * Gets the start of a column.
+         * @param offset            The offset of the column in the chunk.
+         * @returns                 A pointer to the first component.
+        **/
+        /* ================================================================= */
+        void *GetColumn(size_t offset) const;
+        /* ================================================================= */
+        /**
+         * Gets the version a column was last written at.
+         * @param column            The index of the column.
+         * @returns                 The version of the last write.
+        **/
+        /* ================================================================= */
+        std::uint32_t GetChangedVersion(size_t column) const;
+        /* ================================================================= */
+        /**
+         * Gets the version an entity last gained the component of a
+         * column in this chunk.
+         * @param column            The index of the column.
+         * @returns                 The version of the last addition.
+        **/
+        /* ================================================================= */
+        std::uint32_t GetAddedVersion(size_t column) const;
+        /* ================================================================= */
+        /**
+         * Records a write to a column. Older versions are ignored.
+         * @param column            The index of the column.
+         * @param version           The version of the write.
+        **/
+        /* ================================================================= */
+        void MarkChanged(size_t column, std::uint32_t version);
+        /* ================================================================= */
+        /**
+         * Records an entity gaining the component of a column, which is
+         * also a write. Older versions are ignored.
+         * @param column            The index of the column.
+         * @param version           The version of the addition.
+        **/
+        /* ================================================================= */
+        void MarkAdded(size_t column, std::uint32_t version);
+    private:
+        /** The archetype fills and empties the chunk. */
+        friend class Archetype;
+
+        /* ================================================================= */
+        /** Releases memory allocated with the chunk alignment. */
+        /* ================================================================= */
+        struct Deleter
+        {
+            /* ============================================================= */
+            /**
+             * Releases the memory of a chunk.
+             * @param data          The memory to release.
+            **/
+            /* ============================================================= */
+            void operator()(unsigned char *data) const;
+        };
+
+        /** The memory of the chunk. */
+        std::unique_ptr<unsigned char[], Deleter> data_;
+        /** The number of entities in the chunk. */
+        size_t count_;
+        /** The changed and added versions of every column, interleaved. */
+        std::vector<std::uint32_t> versions_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The chunks of entities sharing one set of components.
+    **/
+    /* ===================================================================== */
+    class Archetype final
+    {
+    public:
+        /** Returned when a component isn't part of the archetype. */
+        static constexpr size_t NoColumn = ~static_cast<size_t>(0);
+
+        /* ================================================================= */
+        /**
+         * Lays out the columns of the archetype.
+         * @param signature         The components of the archetype.
+         * @throw std::length_error If a single entity doesn't fit in a
+         *                          chunk.
+        **/
+        /* ================================================================= */
+        explicit Archetype(Signature signature) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Destroys every component still stored.
+        **/
+        /* ================================================================= */
+        ~Archetype();
+        Archetype(Archetype const &) = delete;
+        Archetype &operator=(Archetype const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Adds an entity at the end of the archetype. Its components are
+         * left unconstructed for the caller to fill in.
+         * @param entity            The entity added.
+         * @returns                 The row of the entity.
+        **/
+        /* ================================================================= */
+        size_t Allocate(Entity entity);
+        /* ================================================================= */
+        /**
+         * Removes an entity by moving the last one into its row. The
+         * components of the removed row must already be moved out or
+         * destroyed.
+         * @param row               The row to remove.
+         * @returns                 The entity now living in the row, or
+         *                          the removed one if it was the last.
+        **/
+        /* ================================================================= */
+        Entity Remove(size_t row);
+        /* ================================================================= */
+        /**
+         * Gets a component of an entity.
+         * @param row               The row of the entity.
+         * @param id                The component to get.
+         * @returns                 A pointer to the component, or null if
+         *                          the archetype doesn't have it.
+        **/
+        /* ================================================================= */
+        void *GetComponent(size_t row, ComponentId id) const;
+        /* ================================================================= */
+        /**
+         * Gets the chunk holding a row.
+         * @param row               The row of an entity.
+         * @returns                 The chunk of the row.
+        **/
+        /* ================================================================= */
+        Chunk &GetChunkOf(size_t row);
+
+        /* ================================================================= */
+        /**
+         * Gets the components of the archetype.
+         * @returns                 The signature of the archetype.
+        **/
+        /* ================================================================= */
+        Signature GetSignature() const;
+        /* ================================================================= */
+        /**
+         * Gets where a column starts in every chunk.
+         * @param id                The component of the column.
+         * @returns                 The offset of the column, or NoColumn.
+        **/
+        /* ================================================================= */
+        size_t GetColumnOffset(ComponentId id) const;
+        /* ================================================================= */
+        /**
+         * Gets the index of a column, used to look up its versions.
+         * @param id                The component of the column.
+         * @returns                 The index of the column, or NoColumn.
+        **/
+        /* ================================================================= */
+        size_t GetColumnIndex(ComponentId id) const;
+        /* ================================================================= */
+        /**
+         * Gets the number of entities in the archetype.
+         * @returns                 The number of entities.
+        **/
+        /* ================================================================= */
+        size_t GetSize() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of entities a chunk holds.
+         * @returns                 The capacity of a chunk.
+        **/
+        /* ================================================================= */
+        size_t GetChunkCapacity() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of chunks in use.
+         * @returns                 The number of chunks.
+        **/
+        /* ================================================================= */
+        size_t GetChunkCount() const;
+        /* ================================================================= */
+        /**
+         * Gets a chunk.
+         * @param chunk             The index of the chunk.
+         * @returns                 The chunk.
+        **/
+        /* ================================================================= */
+        Chunk const &GetChunk(size_t chunk) const;
+        /* ================================================================= */
+        /**
+         * Gets a chunk.
+         * @param chunk             The index of the chunk.
+         * @returns                 The chunk.
+        **/
+        /* ================================================================= */
+        Chunk &GetChunk(size_t chunk);
+    private:
+        /* ================================================================= */
+        /** Where a component type lives in every chunk. */
+        /* ================================================================= */
+        struct Column
+        {
+            /** The component stored. */
+            ComponentId id_;
+            /** The offset of the column from the start of a chunk. */
+            size_t offset_;
+            /** How to move and destroy the component. */
+            ComponentInfo const *info_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Gets a component of an entity.
+         * @param row               The row of the entity.
+         * @param column            The column of the component.
+         * @returns                 A pointer to the component.
+        **/
+        /* ================================================================= */
+        void *GetComponent(size_t row, Column const &column) const;
+
+        /** The components of the archetype. */
+        Signature signature_;
+        /** The columns, ordered by component id. */
+        std::vector<Column> columns_;
+        /** The number of entities a chunk holds. */
+        size_t capacity_;
+        /** The number of entities stored. */
+        size_t size_;
+        /** The chunks holding the entities, only the last one has room. */
+        std::vector<Chunk> chunks_;
+    };
+}
+
+/* ========================================================================= */
+#endif // Archetype_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,205 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Entity.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * The handles naming entities and the type erased description of every
+ * component type stored in a World.
+ * Every component type gets a small id the first time it is used, and a
+ * set of component types is a bit mask of those ids.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Entity_MODULE_H
+#define Entity_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Names an entity. The generation changes every time the slot gets
+     * reused, so stale handles can be told apart from live ones.
+    **/
+    /* ===================================================================== */
+    struct Entity
+    {
+        /** The slot of the entity in the world. */
+        std::uint32_t index_;
+        /** How many times the slot was reused. */
+        std::uint32_t generation_;
+
+        /* ================================================================= */
+        /**
+         * Compares two handles.
+         * @param rhs               The other handle.
+         * @returns                 True if both name the same entity.
+        **/
+        /* ================================================================= */
+        bool operator==(Entity const &rhs) const;
+        /* ================================================================= */
+        /**
+         * Compares two handles.
+         * @param rhs               The other handle.
+         * @returns                 True if they name different entities.
+        **/
+        /* ================================================================= */
+        bool operator!=(Entity const &rhs) const;
+    };
+
+    /** The id given to a component type. */
+    using ComponentId = std::uint32_t;
+    /** A set of component types, one bit per id. */
+    using Signature = std::uint64_t;
+    /** The most component types a program can use. */
+    static constexpr ComponentId MaxComponents = 64;
+
+    /* ===================================================================== */
+    /**
+     * Everything an archetype needs to store a component type without
+     * knowing it.
+    **/
+    /* ===================================================================== */
+    struct ComponentInfo
+    {
+        /** The size of a component. */
+        size_t size_;
+        /** The alignment of a component. */
+        size_t alignment_;
+        /** Move constructs a component and destroys the source. */
+        void (*move_)(void *destination, void *source);
+        /** Destroys a component. */
+        void (*destroy_)(void *component);
+        /** The name of the type, for debugging. */
+        char const *name_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Hands out the ids of the component types.
+    **/
+    /* ===================================================================== */
+    class ComponentRegistry final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Gets the id of a component type, registering it on first use.
+         * @tparam T                The component type.
+         * @returns                 The id of the type.
+         * @throw std::length_error If more than MaxComponents types are
+         *                          used.
+        **/
+        /* ================================================================= */
+        template <typename T>
+        static ComponentId GetId() noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the description of a registered component type.
+         * @param id                The id of the type.
+         * @returns                 The description of the type.
+        **/
+        /* ================================================================= */
+        static ComponentInfo const &GetInfo(ComponentId id);
+    private:
+        /* ================================================================= */
+        /**
+         * Gives a new id to a component type.
+         * @param info              The description of the type.
+         * @returns                 The new id.
+         * @throw std::length_error If every id is taken.
+        **/
+        /* ================================================================= */
+        static ComponentId Register(ComponentInfo const &info) noexcept(false);
+    };
+
+    /* ===================================================================== */
+    /**
+     * The components some code reads and writes. Code only reading a
+     * component may run next to other readers, writers run alone.
+    **/
+    /* ===================================================================== */
+    struct Access
+    {
+        /** The components only read. */
+        Signature reads_;
+        /** The components written. */
+        Signature writes_;
+
+        /* ================================================================= */
+        /**
+         * Gets the access of a list of components.
+         * @tparam Ts               The components, const when only read.
+         * @returns                 The access of the list.
+        **/
+        /* ================================================================= */
+        template <typename... Ts>
+        static Access Of();
+        /* ================================================================= */
+        /**
+         * Gets the access writing every component.
+         * @returns                 The exclusive access.
+        **/
+        /* ================================================================= */
+        static Access All();
+        /* ================================================================= */
+        /**
+         * Gets whether two accesses can't run at the same time.
+         * @param other             The other access.
+         * @returns                 True if either writes what the other
+         *                          touches.
+        **/
+        /* ================================================================= */
+        bool ConflictsWith(Access const &other) const;
+        /* ================================================================= */
+        /**
+         * Gets whether this access allows everything another one does.
+         * @param other             The other access.
+         * @returns                 True if the other access is allowed.
+        **/
+        /* ================================================================= */
+        bool Covers(Access const &other) const;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Compares two change versions, allowing the counter to wrap around.
+     * @param version               The version to check.
+     * @param than                  The version to compare against.
+     * @returns                     True if version came after than.
+    **/
+    /* ===================================================================== */
+    constexpr bool IsNewerVersion(std::uint32_t version, std::uint32_t than)
+    {
+        return static_cast<std::int32_t>(version - than) > 0;
+    }
+
+    /* ===================================================================== */
+    /**
+     * Gets the signature holding a set of component types.
+     * @tparam Ts                   The component types, const is ignored.
+     * @returns                     The signature of the set.
+    **/
+    /* ===================================================================== */
+    template <typename... Ts>
+    Signature GetSignature();
+}
+
+#include "Entity.tpp"
+/* ========================================================================= */
+#endif // Entity_MODULE_H
+/* ========================================================================= */
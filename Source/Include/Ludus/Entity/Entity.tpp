@@ -0,0 +1,57 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Entity.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * The handles naming entities and the type erased description of every
+ * component type stored in a World.
+ **/
+/* ========================================================================= */
+
+namespace Ludus
+{
+    template <typename T>
+    ComponentId ComponentRegistry::GetId()
+    {
+        static_assert(std::is_same<T, std::decay_t<T> >::value,
+            "Components are registered by their plain type.");
+        static_assert(std::is_nothrow_move_constructible<T>::value,
+            "Components move between chunks and can't throw doing so.");
+        // Registered once per type, the first time any thread asks.
+        static ComponentId const id = Register(ComponentInfo{
+            sizeof(T), alignof(T),
+            [](void *destination, void *source)
+            {
+                T *from = static_cast<T *>(source);
+                ::new(destination) T(std::move(*from));
+                from->~T();
+            },
+            [](void *component)
+            {
+                static_cast<T *>(component)->~T();
+            },
+            typeid(T).name() });
+        return id;
+    }
+
+    template <typename... Ts>
+    Access Access::Of()
+    {
+        Access access = { 0, 0 };
+        (((std::is_const<Ts>::value ? access.reads_ : access.writes_) |=
+            GetSignature<Ts>()), ...);
+        return access;
+    }
+
+    template <typename... Ts>
+    Signature GetSignature()
+    {
+        Signature signature = 0;
+        ((signature |= Signature(1) <<
+            ComponentRegistry::GetId<std::remove_const_t<Ts> >()), ...);
+        return signature;
+    }
+}
@@ -0,0 +1,259 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Query.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Walks every entity of a World that has a set of components.
+ * The query remembers the archetypes it matched and only looks at the
+ * ones created since its last run, then hands out the matching columns
+ * of every chunk so the loop body runs over packed arrays. Components
+ * listed as const are only read.
+ * ParallelForEach hands groups of whole chunks to the job system of the
+ * world, so no two threads ever touch the same chunk.
+ * Wrapping a component in Changed or Added skips every chunk where it
+ * wasn't written, or gained by an entity, since the query last ran.
+ * Versions are tracked per chunk, so a visited chunk may still hold
+ * entities that didn't change, but an untouched chunk is never visited.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Query_MODULE_H
+#define Query_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Entity/World.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Only visits chunks where a component was written since the query
+     * last ran.
+     * @tparam T                    The component, const when only read.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    struct Changed
+    {
+    };
+
+    /* ===================================================================== */
+    /**
+     * Only visits chunks where an entity gained a component since the
+     * query last ran.
+     * @tparam T                    The component, const when only read.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    struct Added
+    {
+    };
+
+    /* ===================================================================== */
+    /**
+     * Splits a query argument into its component and its filter.
+     * @tparam T                    The argument of the query.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    struct QueryTerm
+    {
+        /** The component visited. */
+        using Type = T;
+        /** Whether the term only passes changed chunks. */
+        static constexpr bool IsChanged = false;
+        /** Whether the term only passes chunks with additions. */
+        static constexpr bool IsAdded = false;
+    };
+
+    /* ===================================================================== */
+    /** A term only passing changed chunks. */
+    /* ===================================================================== */
+    template <typename T>
+    struct QueryTerm<Changed<T> >
+    {
+        /** The component visited. */
+        using Type = T;
+        /** Whether the term only passes changed chunks. */
+        static constexpr bool IsChanged = true;
+        /** Whether the term only passes chunks with additions. */
+        static constexpr bool IsAdded = false;
+    };
+
+    /* ===================================================================== */
+    /** A term only passing chunks with additions. */
+    /* ===================================================================== */
+    template <typename T>
+    struct QueryTerm<Added<T> >
+    {
+        /** The component visited. */
+        using Type = T;
+        /** Whether the term only passes changed chunks. */
+        static constexpr bool IsChanged = false;
+        /** Whether the term only passes chunks with additions. */
+        static constexpr bool IsAdded = true;
+    };
+
+    /** The component visited by a query argument. */
+    template <typename T>
+    using TermType = typename QueryTerm<T>::Type;
+
+    /* ===================================================================== */
+    /**
+     * Iterates the entities having every component in Ts. Entities must
+     * not be created, destroyed or change components while iterating.
+     * Inside a system, every component in Ts must be declared with the
+     * same or a stronger access.
+     * Every run counts the components it can write as changed, in every
+     * chunk it visits.
+     * @tparam Ts                   The components to visit, const when
+     *                              only read, optionally wrapped in
+     *                              Changed or Added.
+    **/
+    /* ===================================================================== */
+    template <typename... Ts>
+    class Query final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a query over a world. The first run sees every chunk
+         * as changed.
+         * @param world             The world to iterate.
+        **/
+        /* ================================================================= */
+        explicit Query(World &world);
+
+        /* ================================================================= */
+        /**
+         * Calls a function for every matching entity.
+         * @param function          Called as function(Ts &...) or as
+         *                          function(Entity, Ts &...).
+        **/
+        /* ================================================================= */
+        template <typename Function>
+        void ForEach(Function &&function);
+        /* ================================================================= */
+        /**
+         * Calls a function for every matching entity, spreading the
+         * chunks over the job system of the world. Runs on the calling
+         * thread when the world has no job system.
+         * @param function          Called as in ForEach, from many
+         *                          threads at once.
+         * @throw std::logic_error  If the running system didn't declare
+         *                          the access of the query.
+        **/
+        /* ================================================================= */
+        template <typename Function>
+        void ParallelForEach(Function &&function) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Calls a function for every chunk holding matching entities.
+         * @param function          Called as function(size_t count,
+         *                          Entity const *entities, Ts *...columns).
+        **/
+        /* ================================================================= */
+        template <typename Function>
+        void ForEachChunk(Function &&function);
+        /* ================================================================= */
+        /**
+         * Counts the entities having the components, whether they
+         * changed or not.
+         * @returns                 The number of matching entities.
+        **/
+        /* ================================================================= */
+        size_t Count();
+        /* ================================================================= */
+        /**
+         * Gets the components the query reads and writes.
+         * @returns                 The access of the query.
+        **/
+        /* ================================================================= */
+        static Access GetAccess();
+    private:
+        /** The number of components visited. */
+        static constexpr size_t TermCount = sizeof...(Ts);
+
+        /* ================================================================= */
+        /** A matched archetype and where its columns are. */
+        /* ================================================================= */
+        struct Match
+        {
+            /** The archetype holding the entities. */
+            Archetype *archetype_;
+            /** The offset of the column of every component in Ts. */
+            std::array<size_t, TermCount> offsets_;
+            /** The index of the column of every component in Ts. */
+            std::array<size_t, TermCount> columns_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Matches the archetypes created since the last refresh.
+        **/
+        /* ================================================================= */
+        void Refresh();
+        /* ================================================================= */
+        /**
+         * Gets whether a chunk passes the filters, and marks the columns
+         * the query writes as changed if it does.
+         * @param chunk             The chunk to check.
+         * @param match             The archetype of the chunk.
+         * @param version           The version of this run.
+         * @returns                 True if the chunk should be visited.
+        **/
+        /* ================================================================= */
+        bool Accept(Chunk &chunk, Match const &match, std::uint32_t version) const;
+        /* ================================================================= */
+        /**
+         * Wraps a function called per entity into one called per chunk.
+         * @param function          The function to call per entity.
+         * @returns                 The function to call per chunk.
+        **/
+        /* ================================================================= */
+        template <typename Function>
+        static auto MakeChunkVisitor(Function &function);
+        /* ================================================================= */
+        /**
+         * Calls a chunk function with the typed columns of a chunk.
+         * @param function          The function to call.
+         * @param chunk             The chunk to visit.
+         * @param match             The archetype of the chunk.
+        **/
+        /* ================================================================= */
+        template <typename Function, size_t... Is>
+        static void VisitChunk(Function &function, Chunk const &chunk,
+            Match const &match, std::index_sequence<Is...>);
+
+        /** The world iterated. */
+        World &world_;
+        /** The components every match must have. */
+        Signature signature_;
+        /** The archetypes matched so far. */
+        std::vector<Match> matches_;
+        /** Every accepted chunk of a parallel run, with its archetype. */
+        std::vector<std::pair<size_t, Chunk const *> > chunks_;
+        /** The number of archetypes of the world already looked at. */
+        size_t seen_;
+        /** The version of the world when the query last ran. */
+        std::uint32_t lastVersion_;
+    };
+}
+
+#include "Query.tpp"
+/* ========================================================================= */
+#endif // Query_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,196 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Query.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Walks every entity of a World that has a set of components.
+ **/
+/* ========================================================================= */
+
+namespace Ludus
+{
+    template <typename... Ts>
+    Query<Ts...>::Query(World &world) :
+        world_(world), signature_(GetSignature<TermType<Ts>...>()), seen_(0),
+        lastVersion_(world.GetVersion() - 0x40000000u)
+    {
+    }
+
+    template <typename... Ts>
+    template <typename Function>
+    void Query<Ts...>::ForEach(Function &&function)
+    {
+        ForEachChunk(MakeChunkVisitor(function));
+    }
+
+    template <typename... Ts>
+    template <typename Function>
+    void Query<Ts...>::ParallelForEach(Function &&function)
+    {
+        JobSystem *jobs = world_.GetJobSystem();
+        if(!jobs)
+        {
+            ForEach(function);
+            return;
+        }
+        World::CheckAccess(GetAccess());
+        Refresh();
+        // Filtering and marking happen here, the workers only visit.
+        std::uint32_t const version = world_.NextVersion();
+        chunks_.clear();
+        for(size_t match = 0; match < matches_.size(); ++match)
+        {
+            Archetype &archetype = *matches_[match].archetype_;
+            for(size_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk)
+            {
+                if(Accept(archetype.GetChunk(chunk), matches_[match], version))
+                {
+                    chunks_.emplace_back(match, &archetype.GetChunk(chunk));
+                }
+            }
+        }
+        lastVersion_ = version;
+
+        // A few groups per thread keeps them busy when chunks differ.
+        size_t const groups = (jobs->GetWorkerCount() + 1) * 4;
+        size_t const grain = std::max<size_t>(1, chunks_.size() / groups);
+        auto visitor = MakeChunkVisitor(function);
+        jobs->ParallelFor(chunks_.size(), grain,
+            [this, &visitor](size_t begin, size_t end)
+        {
+            for(size_t i = begin; i < end; ++i)
+            {
+                VisitChunk(visitor, *chunks_[i].second, matches_[chunks_[i].first],
+                    std::index_sequence_for<Ts...>());
+            }
+        });
+    }
+
+    template <typename... Ts>
+    template <typename Function>
+    void Query<Ts...>::ForEachChunk(Function &&function)
+    {
+        World::CheckAccess(GetAccess());
+        Refresh();
+        std::uint32_t const version = world_.NextVersion();
+        for(Match const &match : matches_)
+        {
+            Archetype &archetype = *match.archetype_;
+            for(size_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk)
+            {
+                Chunk &current = archetype.GetChunk(chunk);
+                if(Accept(current, match, version))
+                {
+                    VisitChunk(function, current, match,
+                        std::index_sequence_for<Ts...>());
+                }
+            }
+        }
+        lastVersion_ = version;
+    }
+
+    template <typename... Ts>
+    size_t Query<Ts...>::Count()
+    {
+        Refresh();
+        size_t count = 0;
+        for(Match const &match : matches_)
+        {
+            count += match.archetype_->GetSize();
+        }
+        return count;
+    }
+
+    template <typename... Ts>
+    Access Query<Ts...>::GetAccess()
+    {
+        return Access::Of<TermType<Ts>...>();
+    }
+
+    template <typename... Ts>
+    void Query<Ts...>::Refresh()
+    {
+        for(; seen_ < world_.GetArchetypeCount(); ++seen_)
+        {
+            Archetype &archetype = world_.GetArchetype(seen_);
+            if((archetype.GetSignature() & signature_) != signature_)
+            {
+                continue;
+            }
+            matches_.push_back(Match{ &archetype,
+                { archetype.GetColumnOffset(ComponentRegistry::GetId<
+                    std::remove_const_t<TermType<Ts> > >())... },
+                { archetype.GetColumnIndex(ComponentRegistry::GetId<
+                    std::remove_const_t<TermType<Ts> > >())... } });
+        }
+    }
+
+    template <typename... Ts>
+    bool Query<Ts...>::Accept(Chunk &chunk, Match const &match,
+        std::uint32_t version) const
+    {
+        if(chunk.GetCount() == 0)
+        {
+            return false;
+        }
+        static constexpr std::array<bool, TermCount> changed = {
+            QueryTerm<Ts>::IsChanged... };
+        static constexpr std::array<bool, TermCount> added = {
+            QueryTerm<Ts>::IsAdded... };
+        static constexpr std::array<bool, TermCount> writes = {
+            !std::is_const<TermType<Ts> >::value... };
+        for(size_t i = 0; i < TermCount; ++i)
+        {
+            size_t const column = match.columns_[i];
+            if((changed[i] && !IsNewerVersion(chunk.GetChangedVersion(column), lastVersion_)) ||
+                (added[i] && !IsNewerVersion(chunk.GetAddedVersion(column), lastVersion_)))
+            {
+                return false;
+            }
+        }
+        for(size_t i = 0; i < TermCount; ++i)
+        {
+            if(writes[i])
+            {
+                chunk.MarkChanged(match.columns_[i], version);
+            }
+        }
+        return true;
+    }
+
+    template <typename... Ts>
+    template <typename Function>
+    auto Query<Ts...>::MakeChunkVisitor(Function &function)
+    {
+        return [&function](size_t count, Entity const *entities,
+            TermType<Ts> *...columns)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                if constexpr(std::is_invocable<Function &, Entity,
+                    TermType<Ts> &...>::value)
+                {
+                    function(entities[i], columns[i]...);
+                }
+                else
+                {
+                    UNREFERENCED(entities);
+                    function(columns[i]...);
+                }
+            }
+        };
+    }
+
+    template <typename... Ts>
+    template <typename Function, size_t... Is>
+    void Query<Ts...>::VisitChunk(Function &function, Chunk const &chunk,
+        Match const &match, std::index_sequence<Is...>)
+    {
+        UNREFERENCED(match);
+        function(chunk.GetCount(), static_cast<Entity const *>(chunk.GetEntities()),
+            static_cast<TermType<Ts> *>(chunk.GetColumn(match.offsets_[Is]))...);
+    }
+}
@@ -0,0 +1,352 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            World.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Owns every entity and its components, grouped by archetype.
+ * The world is an engine system: add it with Engine::AddOn and it runs
+ * the functions registered with AddSystem on every update. Plain game
+ * data lives here instead of in one Node per object, so the simulation
+ * walks packed columns instead of chasing pointers and virtual calls.
+ * Systems declare the components they read and write. Consecutive
+ * systems that don't conflict form a phase and run side by side on the
+ * job system; queries and components got inside a system are checked
+ * against what it declared. Creating, destroying and reshaping entities
+ * needs the whole world, so only systems declaring every component may,
+ * and those always run alone.
+ * Every write is stamped with a version of the world that only grows, so
+ * a query can tell which chunks changed since it last ran.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef World_MODULE_H
+#define World_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Entity/Archetype.hpp"
+#include "Ludus/Entity/Entity.hpp"
+#include "Ludus/System/Node.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace Ludus
+{
+    /** Forward declaration to the JobSystem. */
+    class JobSystem;
+
+    /* ===================================================================== */
+    /**
+     * The entity component store.
+    **/
+    /* ===================================================================== */
+    class World final : public Node
+    {
+    public:
+        /** A function run on the world every update. */
+        using System = std::function<void(World &world, double dt)>;
+
+        /* ================================================================= */
+        /**
+         * Creates an empty world.
+        **/
+        /* ================================================================= */
+        World();
+
+        /* ================================================================= */
+        /**
+         * Creates an entity with some components.
+         * @tparam Ts               The types of the components, each one
+         *                          at most once.
+         * @param components        The initial value of every component.
+         * @returns                 The new entity.
+         * @throw std::logic_error  If the running system isn't exclusive.
+        **/
+        /* ================================================================= */
+        template <typename... Ts>
+        Entity Create(Ts &&...components) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Destroys an entity and its components.
+         * @param entity            The entity to destroy.
+         * @throw std::invalid_argument If the entity isn't alive.
+         * @throw std::logic_error  If the running system isn't exclusive.
+        **/
+        /* ================================================================= */
+        void Destroy(Entity entity) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets whether a handle names a live entity.
+         * @param entity            The handle to check.
+         * @returns                 True if the entity is alive.
+        **/
+        /* ================================================================= */
+        bool IsAlive(Entity entity) const;
+        /* ================================================================= */
+        /**
+         * Adds a component to an entity, or overwrites it if the entity
+         * already has one. Adding moves the entity to another archetype.
+         * @tparam T                The type of the component.
+         * @param entity            The entity to add to.
+         * @param component         The value of the component.
+         * @throw std::invalid_argument If the entity isn't alive.
+         * @throw std::logic_error  If the running system isn't exclusive.
+        **/
+        /* ================================================================= */
+        template <typename T>
+        void Add(Entity entity, T &&component) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Removes a component from an entity, if it has one.
+         * @tparam T                The type of the component.
+         * @param entity            The entity to remove from.
+         * @throw std::invalid_argument If the entity isn't alive.
+         * @throw std::logic_error  If the running system isn't exclusive.
+        **/
+        /* ================================================================= */
+        template <typename T>
+        void Remove(Entity entity) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets a component of an entity, counting it as changed unless
+         * the type is const. The reference is only valid until the entity
+         * changes archetype or another entity of its archetype is
+         * destroyed.
+         * @tparam T                The type of the component, const when
+         *                          only read.
+         * @param entity            The entity to get from.
+         * @returns                 The component.
+         * @throw std::invalid_argument If the entity isn't alive.
+         * @throw std::out_of_range If the entity doesn't have one.
+         * @throw std::logic_error  If the running system didn't declare
+         *                          the access.
+        **/
+        /* ================================================================= */
+        template <typename T>
+        T &Get(Entity entity) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets whether an entity has a component.
+         * @tparam T                The type of the component.
+         * @param entity            The entity to check.
+         * @returns                 True if the entity has one.
+         * @throw std::invalid_argument If the entity isn't alive.
+        **/
+        /* ================================================================= */
+        template <typename T>
+        bool Has(Entity entity) const noexcept(false);
+
+        /* ================================================================= */
+        /**
+         * Adds a function to run every update, after the ones already
+         * added. It may run at the same time as the systems next to it
+         * whose access doesn't conflict with its own. A system declaring
+         * every component always runs alone.
+         * @param system            The function to run.
+         * @param access            The components the function touches,
+         *                          everything by default.
+        **/
+        /* ================================================================= */
+        void AddSystem(System system, Access access = Access::All());
+        /* ================================================================= */
+        /**
+         * Sets the job system running systems and parallel queries.
+         * @param jobs              The job system, or null to run
+         *                          everything on the calling thread.
+        **/
+        /* ================================================================= */
+        void SetJobSystem(JobSystem *jobs);
+        /* ================================================================= */
+        /**
+         * Gets the job system running systems and parallel queries.
+         * @returns                 The job system, or null.
+        **/
+        /* ================================================================= */
+        JobSystem *GetJobSystem() const;
+        /* ================================================================= */
+        /**
+         * Picks up the job system of the engine, if it has one and none
+         * was set.
+        **/
+        /* ================================================================= */
+        void Initialize() override;
+        /* ================================================================= */
+        /**
+         * Runs every system, phase after phase.
+         * @param dt                The amount of time the last frame took.
+         * @throw                   The exception of the first system of a
+         *                          phase that failed, once the whole
+         *                          phase is done.
+        **/
+        /* ================================================================= */
+        void Update(double const &dt) override;
+        /* ================================================================= */
+        /**
+         * Gets the number of phases the systems are split into.
+         * @returns                 The number of phases.
+        **/
+        /* ================================================================= */
+        size_t GetPhaseCount() const;
+        /* ================================================================= */
+        /**
+         * Checks that the running system declared some access.
+         * Outside of a system everything is allowed.
+         * @param access            The access about to be used.
+         * @throw std::logic_error  If the running system didn't declare
+         *                          it.
+        **/
+        /* ================================================================= */
+        static void CheckAccess(Access const &access) noexcept(false);
+
+        /* ================================================================= */
+        /**
+         * Gets the number of live entities.
+         * @returns                 The number of entities.
+        **/
+        /* ================================================================= */
+        size_t GetEntityCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of archetypes created so far. Archetypes are
+         * never removed, so new ones are always at the end.
+         * @returns                 The number of archetypes.
+        **/
+        /* ================================================================= */
+        size_t GetArchetypeCount() const;
+        /* ================================================================= */
+        /**
+         * Gets an archetype.
+         * @param archetype         The index of the archetype.
+         * @returns                 The archetype.
+        **/
+        /* ================================================================= */
+        Archetype const &GetArchetype(size_t archetype) const;
+        /* ================================================================= */
+        /**
+         * Gets an archetype.
+         * @param archetype         The index of the archetype.
+         * @returns                 The archetype.
+        **/
+        /* ================================================================= */
+        Archetype &GetArchetype(size_t archetype);
+        /* ================================================================= */
+        /**
+         * Gets the version of the last write.
+         * @returns                 The current version.
+        **/
+        /* ================================================================= */
+        std::uint32_t GetVersion() const;
+        /* ================================================================= */
+        /**
+         * Moves to a new version for the writes about to happen. Safe to
+         * call from any thread.
+         * @returns                 The new version.
+        **/
+        /* ================================================================= */
+        std::uint32_t NextVersion();
+    private:
+        /* ================================================================= */
+        /** Where an entity slot currently lives. */
+        /* ================================================================= */
+        struct Record
+        {
+            /** The archetype holding the entity. */
+            std::uint32_t archetype_;
+            /** The generation of the slot, bumped when it's freed. */
+            std::uint32_t generation_;
+            /** The row of the entity in its archetype. */
+            size_t row_;
+        };
+
+        /* ================================================================= */
+        /** A registered system. */
+        /* ================================================================= */
+        struct Entry
+        {
+            /** The function to run. */
+            System system_;
+            /** The components the function touches. */
+            Access access_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Runs a system with its access declared for the thread.
+         * @param entry             The system to run.
+         * @param dt                The amount of time the last frame took.
+        **/
+        /* ================================================================= */
+        void RunSystem(Entry &entry, double dt);
+
+        /* ================================================================= */
+        /**
+         * Takes a free slot for a new entity, placed in an archetype.
+         * @param signature         The components of the entity.
+         * @param row               Set to the row of the entity.
+         * @returns                 The new entity.
+        **/
+        /* ================================================================= */
+        Entity Allocate(Signature signature, size_t &row);
+        /* ================================================================= */
+        /**
+         * Finds the record of a live entity.
+         * @param entity            The entity to find.
+         * @returns                 The record of the entity.
+         * @throw std::invalid_argument If the entity isn't alive.
+        **/
+        /* ================================================================= */
+        Record const &Lookup(Entity entity) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Finds the archetype of a signature, creating it if needed.
+         * @param signature         The components of the archetype.
+         * @returns                 The index of the archetype.
+        **/
+        /* ================================================================= */
+        std::uint32_t FindArchetype(Signature signature);
+        /* ================================================================= */
+        /**
+         * Moves an entity to the archetype of another signature. Shared
+         * components are moved, the others destroyed, and the new ones
+         * left unconstructed.
+         * @param entity            The entity to move.
+         * @param signature         The components it should have.
+         * @returns                 The new row of the entity.
+        **/
+        /* ================================================================= */
+        size_t Relocate(Entity entity, Signature signature);
+
+        /** Where every entity slot lives. */
+        std::vector<Record> records_;
+        /** The slots of destroyed entities, reused first. */
+        std::vector<std::uint32_t> free_;
+        /** Every archetype, in the order they were created. */
+        std::vector<std::unique_ptr<Archetype> > archetypes_;
+        /** Finds the archetype of a signature. */
+        std::unordered_map<Signature, std::uint32_t> lookup_;
+        /** The systems, in the order they were added. */
+        std::vector<Entry> systems_;
+        /** The index of the first system of every phase. */
+        std::vector<size_t> phases_;
+        /** Runs the systems and parallel queries, if any. */
+        JobSystem *jobs_;
+        /** The version of the last write. */
+        std::atomic<std::uint32_t> version_;
+    };
+}
+
+#include "World.tpp"
+/* ========================================================================= */
+#endif // World_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,88 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            World.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Owns every entity and its components, grouped by archetype.
+ **/
+/* ========================================================================= */
+
+namespace Ludus
+{
+    template <typename... Ts>
+    Entity World::Create(Ts &&...components)
+    {
+        CheckAccess(Access::All());
+        Signature const signature = GetSignature<std::decay_t<Ts>...>();
+        size_t row = 0;
+        Entity const entity = Allocate(signature, row);
+        Archetype &archetype = *archetypes_[records_[entity.index_].archetype_];
+        (::new(archetype.GetComponent(row,
+            ComponentRegistry::GetId<std::decay_t<Ts> >()))
+            std::decay_t<Ts>(std::forward<Ts>(components)), ...);
+        std::uint32_t const version = NextVersion();
+        Chunk &chunk = archetype.GetChunkOf(row);
+        (chunk.MarkAdded(archetype.GetColumnIndex(
+            ComponentRegistry::GetId<std::decay_t<Ts> >()), version), ...);
+        return entity;
+    }
+
+    template <typename T>
+    void World::Add(Entity entity, T &&component)
+    {
+        using Type = std::decay_t<T>;
+        CheckAccess(Access::All());
+        if(Has<Type>(entity))
+        {
+            Get<Type>(entity) = std::forward<T>(component);
+            return;
+        }
+        Signature const signature = archetypes_[Lookup(entity).archetype_]->
+            GetSignature() | GetSignature<Type>();
+        size_t const row = Relocate(entity, signature);
+        ::new(archetypes_[records_[entity.index_].archetype_]->GetComponent(
+            row, ComponentRegistry::GetId<Type>())) Type(std::forward<T>(component));
+    }
+
+    template <typename T>
+    void World::Remove(Entity entity)
+    {
+        CheckAccess(Access::All());
+        if(!Has<T>(entity))
+        {
+            return;
+        }
+        Relocate(entity, archetypes_[Lookup(entity).archetype_]->GetSignature() &
+            ~GetSignature<T>());
+    }
+
+    template <typename T>
+    T &World::Get(Entity entity)
+    {
+        CheckAccess(Access::Of<T>());
+        Record const &record = Lookup(entity);
+        Archetype &archetype = *archetypes_[record.archetype_];
+        ComponentId const id = ComponentRegistry::GetId<std::remove_const_t<T> >();
+        size_t const column = archetype.GetColumnIndex(id);
+        if(column == Archetype::NoColumn)
+        {
+            throw std::out_of_range(std::string("The entity has no ") +
+                typeid(T).name() + " component.");
+        }
+        if constexpr(!std::is_const_v<T>)
+        {
+            archetype.GetChunkOf(record.row_).MarkChanged(column, NextVersion());
+        }
+        return *static_cast<T *>(archetype.GetComponent(record.row_, id));
+    }
+
+    template <typename T>
+    bool World::Has(Entity entity) const
+    {
+        return (archetypes_[Lookup(entity).archetype_]->GetSignature() &
+            GetSignature<T>()) != 0;
+    }
+}
@@ -0,0 +1,77 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            BlockCompression.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Decodes the block compressed formats textures ship in:
+ * - BC1, 8 bytes per block of 4x4 texels: two colors and four levels
+ *   between them, or three and transparent black.
+ * - BC3, 16 bytes per block: a block of eight alpha levels followed by a
+ *   BC1 block always using four colors.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef BlockCompression_MODULE_H
+#define BlockCompression_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include "Ludus/Graphics/Texture.hpp"
+#include <cstddef>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Decodes a single BC1 block.
+     * @param block             The 8 bytes of the block.
+     * @param texels            Gets the 16 texels, row after row.
+    **/
+    /* ===================================================================== */
+    void DecodeBC1Block(std::uint8_t const *block, Color *texels);
+    /* ===================================================================== */
+    /**
+     * Decodes a single BC3 block.
+     * @param block             The 16 bytes of the block.
+     * @param texels            Gets the 16 texels, row after row.
+    **/
+    /* ===================================================================== */
+    void DecodeBC3Block(std::uint8_t const *block, Color *texels);
+    /* ===================================================================== */
+    /**
+     * Decodes a texture compressed as BC1.
+     * @param data              The blocks, row after row.
+     * @param size              The number of bytes.
+     * @param width             The width in texels.
+     * @param height            The height in texels.
+     * @returns                 The texture.
+     * @throw std::invalid_argument If there aren't enough blocks.
+    **/
+    /* ===================================================================== */
+    Texture DecodeBC1(std::uint8_t const *data, size_t size, unsigned width,
+        unsigned height) noexcept(false);
+    /* ===================================================================== */
+    /**
+     * Decodes a texture compressed as BC3.
+     * @param data              The blocks, row after row.
+     * @param size              The number of bytes.
+     * @param width             The width in texels.
+     * @param height            The height in texels.
+     * @returns                 The texture.
+     * @throw std::invalid_argument If there aren't enough blocks.
+    **/
+    /* ===================================================================== */
+    Texture DecodeBC3(std::uint8_t const *data, size_t size, unsigned width,
+        unsigned height) noexcept(false);
+}
+
+/* ========================================================================= */
+#endif // BlockCompression_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,110 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Culling.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Removes the instances outside of the view before anything gets
+ * transformed.
+ * The bounding spheres of the instances are laid out as one array per
+ * component and tested against the six planes of the frustum four at a
+ * time; the survivors are written as a compacted list of indices.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Culling_MODULE_H
+#define Culling_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Math/Math.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Ludus
+{
+    /** Forward declaration to the Mesh. */
+    class Mesh;
+    /** Forward declaration to the Instance. */
+    struct Instance;
+
+    /* ===================================================================== */
+    /**
+     * The six planes bounding what a camera sees, pointing inwards.
+    **/
+    /* ===================================================================== */
+    struct Frustum
+    {
+        /** The planes as (normal, distance), in the order left, right,
+         *  bottom, top, near, far. */
+        Math::Vec4 planes_[6];
+
+        /* ================================================================= */
+        /**
+         * Extracts the planes of a view projection matrix.
+         * @param viewProjection    The matrix going from world to clip
+         *                          space.
+         * @returns                 The frustum of the matrix.
+        **/
+        /* ================================================================= */
+        static Frustum FromMatrix(Math::Mat4 const &viewProjection);
+    };
+
+    /* ===================================================================== */
+    /**
+     * Culls the instances of a mesh against a frustum.
+     * The arrays are kept between calls so steady state culling doesn't
+     * allocate.
+    **/
+    /* ===================================================================== */
+    class InstanceCuller final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Finds every instance whose bounding sphere touches the frustum.
+         * @param frustum           The frustum to test against.
+         * @param mesh              The mesh every instance draws.
+         * @param instances         The instances to test.
+         * @param count             The number of instances.
+         * @returns                 The number of visible instances.
+        **/
+        /* ================================================================= */
+        size_t Cull(Frustum const &frustum, Mesh const &mesh,
+            Instance const *instances, size_t count);
+        /* ================================================================= */
+        /**
+         * Gets the indices of the visible instances, in ascending order.
+         * @returns                 A pointer to the first index.
+        **/
+        /* ================================================================= */
+        std::uint32_t const *GetVisible() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of visible instances.
+         * @returns                 The number of visible instances.
+        **/
+        /* ================================================================= */
+        size_t GetVisibleCount() const;
+    private:
+        /** The x component of every sphere center. */
+        std::vector<float> x_;
+        /** The y component of every sphere center. */
+        std::vector<float> y_;
+        /** The z component of every sphere center. */
+        std::vector<float> z_;
+        /** The radius of every sphere. */
+        std::vector<float> radius_;
+        /** The indices of the visible instances. */
+        std::vector<std::uint32_t> visible_;
+    };
+}
+
+/* ========================================================================= */
+#endif // Culling_MODULE_H
+/* ========================================================================= */
@@ -8,6 +8,13 @@
  * @brief
  * Provides access to all graphical functions needed to create the assets
  * being drawn to the swapchain.
+ * The software device rasterizes on the CPU into its own color buffer,
+ * which makes it usable headless and in tests. The buffers keep their
+ * capacity when shrunk, rows of pixels stay the pitch apart.
+ * Buffers, textures and framebuffers come from pools and are named by
+ * handles. Destroying one only frees it once the frames in flight that
+ * could still read it are done. Data changing every frame is written to
+ * a ring of memory shared by the frames in flight instead.
  **/
 /* ========================================================================= */
 
@@ -20,9 +27,25 @@
 /* Includes */
 /* ========================================================================= */
 #include "Ludus/Graphics/Graphics.hpp"
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include "Ludus/Graphics/Resources.hpp"
+#include "Ludus/Graphics/Texture.hpp"
+#include "Ludus/Graphics/UploadRing.hpp"
+#include "Ludus/Math/Batch.hpp"
+#include <vector>
 
 namespace Ludus
 {
+    /** Forward declaration to the SampledTexture. */
+    class SampledTexture;
+
+    /** Names a buffer of the device. */
+    using BufferHandle = ResourceHandle<Buffer>;
+    /** Names a texture of the device. */
+    using TextureHandle = ResourceHandle<Texture>;
+    /** Names a framebuffer of the device. */
+    using FramebufferHandle = ResourceHandle<Framebuffer>;
+
     /* ================================================================= */
     /** 
      * The graphics device holding the context and making it possible
@@ -31,6 +54,384 @@ namespace Ludus
     /* ================================================================= */
     class Device
     {
+    public:
+        /* ============================================================= */
+        /**
+         * Creates the device along with its color buffer.
+         * @param width                 The width of the color buffer.
+         * @param height                The height of the color buffer.
+        **/
+        /* ============================================================= */
+        Device(unsigned width, unsigned height);
+        /* ============================================================= */
+        /**
+         * Fills the whole color buffer with a single color and resets
+         * the depth buffer to the far plane.
+         * @param color                 The color to fill with.
+        **/
+        /* ============================================================= */
+        void Clear(Color color);
+        /* ============================================================= */
+        /**
+         * Changes the size of the color and depth buffers. Their memory
+         * is only reallocated when growing past its capacity, otherwise
+         * drawing keeps to the corner of the buffers in use.
+         * @param width                 The new width in pixels.
+         * @param height                The new height in pixels.
+         * @returns                     True if the buffers were
+         *                              reallocated, losing their pixels.
+        **/
+        /* ============================================================= */
+        bool Resize(unsigned width, unsigned height);
+        /* ============================================================= */
+        /**
+         * Rasterizes quads, each made of four consecutive vertices going
+         * around the quad.
+         * @param vertices              The vertices of the quads.
+         * @param quadCount             The number of quads.
+         * @param texture               The texture sampled by the quads,
+         *                              or null to use the vertex colors
+         *                              only.
+         * @param blend                 How the quads get blended.
+        **/
+        /* ============================================================= */
+        void DrawQuads(Vertex2D const *vertices, size_t quadCount,
+            Texture const *texture, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Rasterizes quads filtering a texture between its mip levels.
+         * The level of detail comes from how many texels a pixel steps
+         * over, and every span of pixels is sampled in one go.
+         * @param vertices              The vertices of the quads.
+         * @param quadCount             The number of quads.
+         * @param texture               The texture sampled by the quads,
+         *                              or null to use the vertex colors
+         *                              only.
+         * @param blend                 How the quads get blended.
+        **/
+        /* ============================================================= */
+        void DrawSampledQuads(Vertex2D const *vertices, size_t quadCount,
+            SampledTexture const *texture, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Rasterizes depth tested, single colored triangles from clip
+         * space vertices. Triangles crossing the near plane are dropped.
+         * @param clip                  The clip space position of every
+         *                              vertex.
+         * @param indices               Three vertex indices per triangle.
+         * @param triangleCount         The number of triangles.
+         * @param color                 The color of every triangle.
+         * @returns                     The number of triangles that
+         *                              reached the rasterizer.
+        **/
+        /* ============================================================= */
+        size_t DrawTriangles(Math::Vec4Stream const &clip,
+            std::uint32_t const *indices, size_t triangleCount, Color color);
+        /* ============================================================= */
+        /**
+         * Ends the frame, freeing what was destroyed before the frames
+         * still in flight.
+        **/
+        /* ============================================================= */
+        void EndFrame();
+        /* ============================================================= */
+        /**
+         * Sets how many frames may still be reading resources after they
+         * were destroyed. Recreates the upload ring, so it must be empty.
+         * @param frames                The number of frames in flight.
+        **/
+        /* ============================================================= */
+        void SetFramesInFlight(unsigned frames);
+        /* ============================================================= */
+        /**
+         * Sets how much a frame may upload. Recreates the upload ring, so
+         * it must be empty.
+         * @param bytesPerFrame         The most bytes uploaded per frame,
+         *                              each allocation rounded up to a
+         *                              cache line.
+        **/
+        /* ============================================================= */
+        void SetUploadSize(size_t bytesPerFrame);
+        /* ============================================================= */
+        /**
+         * Allocates memory in the upload ring for the current frame. The
+         * memory is reclaimed once the frame is no longer in flight.
+         * @param size                  The number of bytes.
+         * @returns                     The memory, aligned to a cache
+         *                              line.
+         * @throw std::length_error     If the frame uploads more than the
+         *                              ring holds.
+        **/
+        /* ============================================================= */
+        UploadAllocation AllocateUpload(size_t size) noexcept(false);
+
+        /* ============================================================= */
+        /**
+         * Creates a buffer of zeroed bytes.
+         * @param size                  The number of bytes.
+         * @returns                     The buffer.
+        **/
+        /* ============================================================= */
+        BufferHandle CreateBuffer(size_t size);
+        /* ============================================================= */
+        /**
+         * Destroys a buffer once the frames in flight are done with it.
+         * @param buffer                The buffer.
+         * @throw std::invalid_argument If the buffer was destroyed.
+        **/
+        /* ============================================================= */
+        void DestroyBuffer(BufferHandle buffer) noexcept(false);
+        /* ============================================================= */
+        /**
+         * Gets the bytes of a buffer.
+         * @param buffer                The buffer.
+         * @returns                     The buffer.
+         * @throw std::invalid_argument If the buffer was destroyed.
+        **/
+        /* ============================================================= */
+        Buffer &GetBuffer(BufferHandle buffer) noexcept(false);
+        /* ============================================================= */
+        /**
+         * Creates a texture filled with a single color.
+         * @param width                 The width in texels.
+         * @param height                The height in texels.
+         * @param fill                  The color of every texel.
+         * @returns                     The texture.
+        **/
+        /* ============================================================= */
+        TextureHandle CreateTexture(unsigned width, unsigned height,
+            Color fill = 0);
+        /* ============================================================= */
+        /**
+         * Destroys a texture once the frames in flight are done with it.
+         * @param texture               The texture.
+         * @throw std::invalid_argument If the texture was destroyed.
+        **/
+        /* ============================================================= */
+        void DestroyTexture(TextureHandle texture) noexcept(false);
+        /* ============================================================= */
+        /**
+         * Gets a texture. The reference is only valid until the next
+         * texture is created.
+         * @param texture               The texture.
+         * @returns                     The texture.
+         * @throw std::invalid_argument If the texture was destroyed.
+        **/
+        /* ============================================================= */
+        Texture &GetTexture(TextureHandle texture) noexcept(false);
+        /* ============================================================= */
+        /**
+         * Creates a framebuffer cleared to black and the far plane.
+         * @param width                 The width in pixels.
+         * @param height                The height in pixels.
+         * @returns                     The framebuffer.
+        **/
+        /* ============================================================= */
+        FramebufferHandle CreateFramebuffer(unsigned width, unsigned height);
+        /* ============================================================= */
+        /**
+         * Destroys a framebuffer once the frames in flight are done with
+         * it.
+         * @param framebuffer           The framebuffer.
+         * @throw std::invalid_argument If the framebuffer was destroyed.
+        **/
+        /* ============================================================= */
+        void DestroyFramebuffer(FramebufferHandle framebuffer) noexcept(false);
+        /* ============================================================= */
+        /**
+         * Gets a framebuffer.
+         * @param framebuffer           The framebuffer.
+         * @returns                     The framebuffer.
+         * @throw std::invalid_argument If the framebuffer was destroyed.
+        **/
+        /* ============================================================= */
+        Framebuffer &GetFramebuffer(FramebufferHandle framebuffer) noexcept(false);
+
+        /* ============================================================= */
+        /**
+         * Gets the width of the color buffer.
+         * @returns                     The width in pixels.
+        **/
+        /* ============================================================= */
+        unsigned GetWidth() const;
+        /* ============================================================= */
+        /**
+         * Gets the height of the color buffer.
+         * @returns                     The height in pixels.
+        **/
+        /* ============================================================= */
+        unsigned GetHeight() const;
+        /* ============================================================= */
+        /**
+         * Gets the distance between two rows of the buffers.
+         * @returns                     The pitch in pixels.
+        **/
+        /* ============================================================= */
+        unsigned GetPitch() const;
+        /* ============================================================= */
+        /**
+         * Gets a pixel of the color buffer.
+         * @param x                     The column of the pixel.
+         * @param y                     The row of the pixel.
+         * @returns                     The color of the pixel.
+        **/
+        /* ============================================================= */
+        Color GetPixel(unsigned x, unsigned y) const;
+        /* ============================================================= */
+        /**
+         * Gets the color buffer, row after row, the pitch apart.
+         * @returns                     A pointer to the first pixel.
+        **/
+        /* ============================================================= */
+        Color const *GetColorBuffer() const;
+        /* ============================================================= */
+        /**
+         * Gets the depth of a pixel, 0 at the near plane and 1 at the far.
+         * @param x                     The column of the pixel.
+         * @param y                     The row of the pixel.
+         * @returns                     The depth of the pixel.
+        **/
+        /* ============================================================= */
+        float GetDepth(unsigned x, unsigned y) const;
+        /* ============================================================= */
+        /**
+         * Gets the number of frames ended.
+         * @returns                     The current frame.
+        **/
+        /* ============================================================= */
+        std::uint64_t GetFrame() const;
+        /* ============================================================= */
+        /**
+         * Gets the pools of the resources, to look into their use.
+         * @returns                     The pool.
+        **/
+        /* ============================================================= */
+        ResourcePool<Buffer> const &GetBufferPool() const;
+        ResourcePool<Texture> const &GetTexturePool() const;
+        ResourcePool<Framebuffer> const &GetFramebufferPool() const;
+        /* ============================================================= */
+        /**
+         * Gets the upload ring, to look into its use.
+         * @returns                     The upload ring.
+        **/
+        /* ============================================================= */
+        UploadRing const &GetUploadRing() const;
+    private:
+        /* ============================================================= */
+        /** The texture a draw samples, if any. */
+        /* ============================================================= */
+        struct Sampler
+        {
+            /** The texture sampled at the nearest texel, or null. */
+            Texture const *nearest_;
+            /** The texture filtered between its levels, or null. */
+            SampledTexture const *filtered_;
+        };
+
+        /* ============================================================= */
+        /**
+         * Rasterizes quads, splitting the ones that aren't rectangles.
+         * @param vertices              The vertices of the quads.
+         * @param quadCount             The number of quads.
+         * @param sampler               The texture sampled.
+         * @param blend                 How the quads get blended.
+        **/
+        /* ============================================================= */
+        void RasterizeQuads(Vertex2D const *vertices, size_t quadCount,
+            Sampler const &sampler, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Fills a quad whose edges follow the axes, the common case for
+         * sprites, without going through the triangle setup.
+         * @param quad                  The four vertices of the quad.
+         * @param sampler               The texture sampled.
+         * @param blend                 How the quad gets blended.
+        **/
+        /* ============================================================= */
+        void FillRectangle(Vertex2D const *quad, Sampler const &sampler,
+            BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Rasterizes a single triangle.
+         * @param a                     The first vertex.
+         * @param b                     The second vertex.
+         * @param c                     The third vertex.
+         * @param sampler               The texture sampled.
+         * @param blend                 How the triangle gets blended.
+        **/
+        /* ============================================================= */
+        void FillTriangle(Vertex2D const &a, Vertex2D const &b,
+            Vertex2D const &c, Sampler const &sampler, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Shades a run of pixels of a row from the texture coordinates
+         * and tints gathered in the span arrays.
+         * @param pixels                The first pixel of the run.
+         * @param count                 The number of pixels.
+         * @param sampler               The texture sampled.
+         * @param lod                   The level of detail filtered.
+         * @param blend                 How the pixels get blended.
+        **/
+        /* ============================================================= */
+        void ShadeSpan(Color *pixels, size_t count, Sampler const &sampler,
+            float lod, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Writes a shaded fragment into the color buffer.
+         * @param pixel                 The pixel written.
+         * @param source                The color of the fragment.
+         * @param blend                 How the fragment gets blended.
+        **/
+        /* ============================================================= */
+        static void WritePixel(Color &pixel, Color source, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Rasterizes a single depth tested triangle in screen space.
+         * @param x                     The columns of the corners.
+         * @param y                     The rows of the corners.
+         * @param z                     The depths of the corners.
+         * @param color                 The color of the triangle.
+        **/
+        /* ============================================================= */
+        void FillDepthTriangle(float const *x, float const *y,
+            float const *z, Color color);
+
+        /** The width of the color buffer. */
+        unsigned width_;
+        /** The height of the color buffer. */
+        unsigned height_;
+        /** The pixels allocated per row. */
+        unsigned pitch_;
+        /** The rows allocated. */
+        unsigned rows_;
+        /** The color buffer, row after row. */
+        std::vector<Color> color_;
+        /** The depth buffer, row after row. */
+        std::vector<float> depth_;
+        /** The horizontal texture coordinates of a span, a row long. */
+        std::vector<float> spanU_;
+        /** The vertical texture coordinates of a span. */
+        std::vector<float> spanV_;
+        /** The levels of detail of a span. */
+        std::vector<float> spanLods_;
+        /** The tints of a span. */
+        std::vector<Color> spanTints_;
+        /** The texels sampled for a span. */
+        std::vector<Color> spanColors_;
+        /** The number of frames ended. */
+        std::uint64_t frame_;
+        /** The frames that may read resources after they're destroyed. */
+        unsigned framesInFlight_;
+        /** The buffers. */
+        ResourcePool<Buffer> buffers_;
+        /** The textures. */
+        ResourcePool<Texture> textures_;
+        /** The framebuffers. */
+        ResourcePool<Framebuffer> framebuffers_;
+        /** The most bytes uploaded per frame. */
+        size_t uploadSize_;
+        /** The memory the frames upload to. */
+        UploadRing uploads_;
     };
 }
 
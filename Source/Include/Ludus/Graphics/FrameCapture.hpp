@@ -0,0 +1,159 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            FrameCapture.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A single frame of render commands saved with everything they reference,
+ * so it can be run again in isolation from the rest of the engine.
+ * The file starts with a small header followed by one length prefixed
+ * array per kind of resource, all in the byte order of the machine that
+ * wrote it. Resources are referenced by their index in those arrays.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef FrameCapture_MODULE_H
+#define FrameCapture_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/Mesh.hpp"
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include "Ludus/Graphics/SampledTexture.hpp"
+#include "Ludus/Graphics/Texture.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ludus
+{
+    /** Forward declaration to the Renderer. */
+    class Renderer;
+
+    /* ===================================================================== */
+    /**
+     * The commands of one frame and copies of the resources they use.
+    **/
+    /* ===================================================================== */
+    class FrameCapture final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Copies the commands recorded so far in a renderer.
+         * @param renderer          The renderer to capture.
+        **/
+        /* ================================================================= */
+        explicit FrameCapture(Renderer const &renderer);
+        /* ================================================================= */
+        /**
+         * Reads a capture back from a file.
+         * @param path              The file to read.
+         * @returns                 The capture stored in the file.
+         * @throw std::runtime_error If the file can't be read or isn't a
+         *                          frame capture.
+        **/
+        /* ================================================================= */
+        static FrameCapture Load(std::string const &path) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Writes the capture to a file.
+         * @param path              The file to write.
+         * @throw std::runtime_error If the file can't be written.
+        **/
+        /* ================================================================= */
+        void Save(std::string const &path) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Records the captured commands into a renderer. The resources
+         * are owned by the capture, which must live until Submit.
+         * @param renderer          The renderer to record into.
+        **/
+        /* ================================================================= */
+        void Record(Renderer &renderer) const;
+
+        /* ================================================================= */
+        /**
+         * Gets the width of the device the frame was captured from.
+         * @returns                 The width in pixels.
+        **/
+        /* ================================================================= */
+        unsigned GetWidth() const;
+        /* ================================================================= */
+        /**
+         * Gets the height of the device the frame was captured from.
+         * @returns                 The height in pixels.
+        **/
+        /* ================================================================= */
+        unsigned GetHeight() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of captured commands.
+         * @returns                 The number of commands.
+        **/
+        /* ================================================================= */
+        size_t GetCommandCount() const;
+    private:
+        /* ================================================================= */
+        /** A recorded command with its resources replaced by indices. */
+        /* ================================================================= */
+        struct Command
+        {
+            /** The first quad, or the camera of the instances. */
+            std::uint64_t first_;
+            /** The number of quads or instances drawn. */
+            std::uint64_t count_;
+            /** The first captured instance drawn. */
+            std::uint64_t instances_;
+            /** The color cleared to. */
+            Color color_;
+            /** The texture sampled by the quads, or -1. */
+            std::int32_t texture_;
+            /** The mesh drawn by the instances, or -1. */
+            std::int32_t mesh_;
+            /** What the command does, as a Renderer command type. */
+            std::uint8_t type_;
+            /** How the drawn quads get blended. */
+            std::uint8_t blend_;
+            /** Whether texture_ indexes the sampled textures. */
+            std::uint8_t sampled_;
+            /** Spells out the padding so every byte written is known. */
+            std::uint8_t reserved_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Creates an empty capture, filled in by Load.
+        **/
+        /* ================================================================= */
+        FrameCapture();
+
+        /** The width of the captured device. */
+        unsigned width_;
+        /** The height of the captured device. */
+        unsigned height_;
+        /** The captured commands. */
+        std::vector<Command> commands_;
+        /** Every texture sampled by the frame. */
+        std::vector<Texture> textures_;
+        /** Every texture filtered between its mip levels by the frame. */
+        std::vector<SampledTexture> sampledTextures_;
+        /** Every mesh drawn by the frame. */
+        std::vector<Mesh> meshes_;
+        /** Every camera set during the frame. */
+        std::vector<Math::Mat4> cameras_;
+        /** The quad vertices of the frame. */
+        std::vector<Vertex2D> vertices_;
+        /** Every instance drawn by the frame, one draw after the other. */
+        std::vector<Instance> instances_;
+    };
+}
+
+/* ========================================================================= */
+#endif // FrameCapture_MODULE_H
+/* ========================================================================= */
@@ -59,6 +59,7 @@ namespace Ludus
         {
             OPENGL  = 0x01,  /* Use OpenGL for the rendering device. */
             DIRECTX = 0x02,  /* Use DirectX for the rendering device. */
+            SOFTWARE = 0x04, /* Rasterize on the CPU. */
         };
 
         /* ================================================================= */
@@ -69,6 +70,12 @@ namespace Ludus
         /* ================================================================= */
         Graphics(DeviceType const &renderAPI);
         /* ================================================================= */
+        /**
+         * Releases the window, the device and the renderer.
+        **/
+        /* ================================================================= */
+        ~Graphics();
+        /* ================================================================= */
         /**
          * Gets the window (and swapchain) for the graphics class.
          * @returns             A constant reference to the window class.
@@ -82,14 +89,28 @@ namespace Ludus
          **/
         /* ================================================================= */
         Window &GetWindow();
+        /* ================================================================= */
+        /**
+         * Gets the device used to create the assets.
+         * @returns             A reference to the device.
+         **/
+        /* ================================================================= */
+        Device &GetDevice();
+        /* ================================================================= */
+        /**
+         * Gets the renderer used to draw everything.
+         * @returns             A reference to the renderer.
+         **/
+        /* ================================================================= */
+        Renderer &GetRenderer();
     
     private:
         /** The window that holds the context used by the device. */
         std::unique_ptr<Window> window_;
         /** The graphics device used to create all the assets to render. */
-        //std::unique_ptr<Device> device_;
+        std::unique_ptr<Device> device_;
         /** The rendering device used to draw everything. */
-        //std::unique_ptr<Renderer> renderer_;
+        std::unique_ptr<Renderer> renderer_;
     };
 }
 
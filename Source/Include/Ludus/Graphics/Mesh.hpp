@@ -0,0 +1,123 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Mesh.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Triangle geometry drawn by the renderer.
+ * Positions are stored as one array per component so the renderer can
+ * transform them with the batch kernels, and the bounding sphere is
+ * computed once so instances can be culled without touching vertices.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Mesh_MODULE_H
+#define Mesh_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include "Ludus/Math/Batch.hpp"
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * A copy of a mesh placed in the world.
+    **/
+    /* ===================================================================== */
+    struct Instance
+    {
+        /** The matrix placing the mesh in the world. */
+        Math::Mat4 transform_;
+        /** The color of this copy. */
+        Color color_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * An indexed triangle list.
+    **/
+    /* ===================================================================== */
+    class Mesh final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a mesh.
+         * @param positions         The position of every vertex.
+         * @param indices           Three vertex indices per triangle.
+         * @throw std::invalid_argument If the indices don't form whole
+         *                          triangles or point past the vertices.
+        **/
+        /* ================================================================= */
+        Mesh(std::vector<Math::Vec3> const &positions,
+            std::vector<std::uint32_t> indices) noexcept(false);
+
+        /* ================================================================= */
+        /**
+         * Gets the positions of the vertices.
+         * @returns                 A view of the positions.
+        **/
+        /* ================================================================= */
+        Math::PointStream GetPositions() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of vertices.
+         * @returns                 The number of vertices.
+        **/
+        /* ================================================================= */
+        size_t GetVertexCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the vertex indices, three per triangle.
+         * @returns                 A pointer to the first index.
+        **/
+        /* ================================================================= */
+        std::uint32_t const *GetIndices() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of triangles.
+         * @returns                 The number of triangles.
+        **/
+        /* ================================================================= */
+        size_t GetTriangleCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the center of the bounding sphere.
+         * @returns                 The center in mesh space.
+        **/
+        /* ================================================================= */
+        Math::Vec3 const &GetBoundsCenter() const;
+        /* ================================================================= */
+        /**
+         * Gets the radius of the bounding sphere.
+         * @returns                 The radius in mesh space.
+        **/
+        /* ================================================================= */
+        float GetBoundsRadius() const;
+    private:
+        /** The x component of every position. */
+        std::vector<float> x_;
+        /** The y component of every position. */
+        std::vector<float> y_;
+        /** The z component of every position. */
+        std::vector<float> z_;
+        /** Three vertex indices per triangle. */
+        std::vector<std::uint32_t> indices_;
+        /** The center of the bounding sphere. */
+        Math::Vec3 center_;
+        /** The radius of the bounding sphere. */
+        float radius_;
+    };
+}
+
+/* ========================================================================= */
+#endif // Mesh_MODULE_H
+/* ========================================================================= */
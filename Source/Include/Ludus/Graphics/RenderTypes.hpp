@@ -0,0 +1,96 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            RenderTypes.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides the small types shared by the renderer and the device:
+ * - Colors, packed as 8 bit RGBA.
+ * - Blend modes.
+ * - The vertex format of 2D geometry.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef RenderTypes_MODULE_H
+#define RenderTypes_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <cstdint>
+
+namespace Ludus
+{
+    /** A color with 8 bits per channel, red in the lowest byte. */
+    using Color = std::uint32_t;
+
+    /* ===================================================================== */
+    /**
+     * Packs the channels of a color.
+     * @param r                 The red channel.
+     * @param g                 The green channel.
+     * @param b                 The blue channel.
+     * @param a                 The alpha channel.
+     * @returns                 The packed color.
+    **/
+    /* ===================================================================== */
+    constexpr Color PackColor(std::uint8_t r, std::uint8_t g, std::uint8_t b,
+        std::uint8_t a = 255)
+    {
+        return static_cast<Color>(r) | (static_cast<Color>(g) << 8) |
+            (static_cast<Color>(b) << 16) | (static_cast<Color>(a) << 24);
+    }
+
+    /* ===================================================================== */
+    /**
+     * Gets a single channel of a color.
+     * @param color             The packed color.
+     * @param channel           The channel, 0 for red up to 3 for alpha.
+     * @returns                 The value of the channel.
+    **/
+    /* ===================================================================== */
+    constexpr std::uint8_t GetChannel(Color color, unsigned channel)
+    {
+        return static_cast<std::uint8_t>(color >> (channel * 8));
+    }
+
+    /* ===================================================================== */
+    /**
+     * Defines how drawn pixels get combined with the framebuffer.
+     * @enum BlendMode
+    **/
+    /* ===================================================================== */
+    enum class BlendMode : std::uint8_t
+    {
+        OPAQUE   = 0x00,  /* Replaces the framebuffer. */
+        ALPHA    = 0x01,  /* Mixes with the framebuffer by source alpha. */
+        ADDITIVE = 0x02,  /* Adds to the framebuffer, scaled by alpha. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * A vertex of 2D geometry, positioned in framebuffer pixels.
+    **/
+    /* ===================================================================== */
+    struct Vertex2D
+    {
+        /** The horizontal position in pixels. */
+        float x_;
+        /** The vertical position in pixels, growing downwards. */
+        float y_;
+        /** The horizontal texture coordinate. */
+        float u_;
+        /** The vertical texture coordinate. */
+        float v_;
+        /** The color the texture gets multiplied by. */
+        Color color_;
+    };
+}
+
+/* ========================================================================= */
+#endif // RenderTypes_MODULE_H
+/* ========================================================================= */
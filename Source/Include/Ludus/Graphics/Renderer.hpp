@@ -8,6 +8,14 @@
  * @brief
  * Provides access to all graphical functions needed to draw the assets
  * to the swapchain.
+ * Drawing only records commands, the device runs them all on Submit.
+ * Vertices live in a single array owned by the renderer: callers reserve
+ * a range of quads, write into it, and then draw slices of that range.
+ * Instanced draws record a single command for any number of copies of a
+ * mesh; on Submit the copies are culled, their matrices are combined with
+ * the view projection in batches and every survivor is rasterized.
+ * Every command is timed as its own pass, and a frame can be captured to
+ * a file on Submit to be replayed later with the Replay tool.
  **/
 /* ========================================================================= */
 
@@ -19,10 +27,25 @@
 /* ========================================================================= */
 /* Includes */
 /* ========================================================================= */
+#include "Ludus/Graphics/Culling.hpp"
 #include "Ludus/Graphics/Graphics.hpp"
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include "Ludus/Math/Batch.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
 
 namespace Ludus
 {
+    /** Forward declaration to the Texture. */
+    class Texture;
+    /** Forward declaration to the SampledTexture. */
+    class SampledTexture;
+    /** Forward declaration to the Mesh. */
+    class Mesh;
+    /** Forward declaration to the Instance. */
+    struct Instance;
+
     /* ================================================================= */
     /**
      * The rendering pipeline used by this graphics class.
@@ -30,6 +53,236 @@ namespace Ludus
     /* ================================================================= */
     class Renderer
     {
+    public:
+        /* ============================================================= */
+        /** The work done by the last submitted frame. */
+        /* ============================================================= */
+        struct Statistics
+        {
+            /** The number of commands run. */
+            size_t commands_;
+            /** The number of draw commands run. */
+            size_t draws_;
+            /** The number of quads drawn. */
+            size_t quads_;
+            /** The number of instances submitted. */
+            size_t instances_;
+            /** The number of instances that survived culling. */
+            size_t visibleInstances_;
+            /** The number of triangles rasterized. */
+            size_t triangles_;
+        };
+
+        /* ============================================================= */
+        /** The time one command of the last submitted frame took. */
+        /* ============================================================= */
+        struct PassTiming
+        {
+            /** The kind of command run. */
+            char const *name_;
+            /** The time spent running it. */
+            std::chrono::nanoseconds duration_;
+        };
+
+        /* ============================================================= */
+        /**
+         * Creates the renderer.
+         * @param device                The device running the commands.
+        **/
+        /* ============================================================= */
+        explicit Renderer(Device &device);
+        /* ============================================================= */
+        /**
+         * Records a clear of the whole color buffer.
+         * @param color                 The color to clear to.
+        **/
+        /* ============================================================= */
+        void Clear(Color color);
+        /* ============================================================= */
+        /**
+         * Reserves room for quads in the vertex array of this frame.
+         * @param quadCount             The number of quads to reserve.
+         * @returns                     The index of the first quad
+         *                              reserved.
+        **/
+        /* ============================================================= */
+        size_t AllocateQuads(size_t quadCount);
+        /* ============================================================= */
+        /**
+         * Gets the vertices of a reserved quad. The pointer is only valid
+         * until the next call to AllocateQuads.
+         * @param firstQuad             The index of the quad.
+         * @returns                     A pointer to its four vertices,
+         *                              followed by the next quads.
+        **/
+        /* ============================================================= */
+        Vertex2D *GetQuadVertices(size_t firstQuad);
+        /* ============================================================= */
+        /**
+         * Records a draw of a range of reserved quads.
+         * @param firstQuad             The index of the first quad.
+         * @param quadCount             The number of quads to draw.
+         * @param texture               The texture sampled, or null. It
+         *                              must live until Submit.
+         * @param blend                 How the quads get blended.
+        **/
+        /* ============================================================= */
+        void DrawQuads(size_t firstQuad, size_t quadCount,
+            Texture const *texture, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Records a draw of a range of reserved quads filtering their
+         * texture between its mip levels.
+         * @param firstQuad             The index of the first quad.
+         * @param quadCount             The number of quads to draw.
+         * @param texture               The texture sampled, or null. It
+         *                              must live until Submit.
+         * @param blend                 How the quads get blended.
+        **/
+        /* ============================================================= */
+        void DrawSampledQuads(size_t firstQuad, size_t quadCount,
+            SampledTexture const *texture, BlendMode blend);
+        /* ============================================================= */
+        /**
+         * Sets the camera used by the instanced draws recorded after this.
+         * @param viewProjection        The matrix going from world to clip
+         *                              space.
+        **/
+        /* ============================================================= */
+        void SetViewProjection(Math::Mat4 const &viewProjection);
+        /* ============================================================= */
+        /**
+         * Records a draw of many copies of a mesh as a single command.
+         * The instances are not copied: the mesh and the instances must
+         * live until Submit.
+         * @param mesh                  The mesh every copy draws.
+         * @param instances             The copies to draw.
+         * @param instanceCount         The number of copies.
+        **/
+        /* ============================================================= */
+        void DrawInstanced(Mesh const &mesh, Instance const *instances,
+            size_t instanceCount);
+        /* ============================================================= */
+        /**
+         * Saves the commands of the next submitted frame, along with the
+         * resources they reference, before running them.
+         * @param path                  The file to save the frame to.
+        **/
+        /* ============================================================= */
+        void CaptureNextFrame(std::string path);
+        /* ============================================================= */
+        /**
+         * Runs every recorded command on the device and starts a new
+         * frame, on the device too.
+         * @throw std::runtime_error    If a capture was requested and
+         *                              can't be written. The frame is
+         *                              still drawn and cleared first.
+        **/
+        /* ============================================================= */
+        void Submit() noexcept(false);
+
+        /* ============================================================= */
+        /**
+         * Gets the number of commands recorded for the current frame.
+         * @returns                     The number of commands recorded.
+        **/
+        /* ============================================================= */
+        size_t GetCommandCount() const;
+        /* ============================================================= */
+        /**
+         * Gets the work done by the last submitted frame.
+         * @returns                     The statistics of the last frame.
+        **/
+        /* ============================================================= */
+        Statistics const &GetStatistics() const;
+        /* ============================================================= */
+        /**
+         * Gets the time every command of the last submitted frame took,
+         * in the order they ran.
+         * @returns                     The timing of every pass.
+        **/
+        /* ============================================================= */
+        std::vector<PassTiming> const &GetPassTimings() const;
+    private:
+        /** Captures need to see the recorded commands. */
+        friend class FrameCapture;
+
+        /* ============================================================= */
+        /** A single recorded command. */
+        /* ============================================================= */
+        struct Command
+        {
+            /* ========================================================= */
+            /**
+             * Defines what the command does.
+             * @enum Type
+            **/
+            /* ========================================================= */
+            enum Type : std::uint8_t
+            {
+                CLEAR          = 0x00,  /* Clears the color buffer. */
+                DRAW_QUADS     = 0x01,  /* Draws a range of quads. */
+                DRAW_INSTANCED = 0x02,  /* Draws copies of a mesh. */
+            };
+
+            /** What the command does. */
+            Type type_;
+            /** How the drawn quads get blended. */
+            BlendMode blend_;
+            /** The color cleared to. */
+            Color color_;
+            /** The texture sampled by the quads. */
+            Texture const *texture_;
+            /** The texture filtered by the quads, instead of texture_. */
+            SampledTexture const *sampled_;
+            /** The mesh drawn by the instances. */
+            Mesh const *mesh_;
+            /** The instances drawn. */
+            Instance const *instances_;
+            /** The first quad drawn, or the camera of the instances. */
+            size_t first_;
+            /** The number of quads or instances drawn. */
+            size_t count_;
+        };
+
+        /* ============================================================= */
+        /**
+         * Culls, transforms and rasterizes the copies of an instanced
+         * draw.
+         * @param command               The instanced draw.
+        **/
+        /* ============================================================= */
+        void RunInstanced(Command const &command);
+        /* ============================================================= */
+        /**
+         * Drops the commands of the frame, failed or not, and starts the
+         * next one, on the device too.
+        **/
+        /* ============================================================= */
+        void EndFrame();
+
+        /** The device running the commands. */
+        Device &device_;
+        /** The commands recorded for the current frame. */
+        std::vector<Command> commands_;
+        /** The vertices of every quad reserved this frame. */
+        std::vector<Vertex2D> vertices_;
+        /** The cameras set this frame. */
+        std::vector<Math::Mat4> cameras_;
+        /** Removes the instances outside of the view. */
+        InstanceCuller culler_;
+        /** The matrices of a batch of visible instances. */
+        std::vector<Math::Mat4> transforms_;
+        /** The matrices going from mesh to clip space for the batch. */
+        std::vector<Math::Mat4> clipTransforms_;
+        /** The clip space vertices of the instance being drawn. */
+        std::vector<float> clip_[4];
+        /** The work done by the last submitted frame. */
+        Statistics statistics_;
+        /** The time every command of the last frame took. */
+        std::vector<PassTiming> timings_;
+        /** Where to save the next frame, empty when not capturing. */
+        std::string capturePath_;
     };
 }
 
@@ -0,0 +1,203 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Resources.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * The resources the device creates for the renderer, named by handles.
+ * Every kind of resource lives in its own pool of slots. Destroyed slots
+ * wait until the frames that could still use them are done before going
+ * back to the free list, and keep their memory, so creating a resource
+ * like one destroyed before allocates nothing.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Resources_MODULE_H
+#define Resources_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Names a resource of a pool. The generation changes every time the
+     * resource is destroyed, so stale handles can be told apart from live
+     * ones. The default handle names nothing.
+     * @tparam T                    The kind of resource.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    struct ResourceHandle
+    {
+        /** The slot of the resource in its pool. */
+        std::uint32_t index_ = 0;
+        /** How many times the slot was reused, zero for no resource. */
+        std::uint32_t generation_ = 0;
+
+        /* ================================================================= */
+        /**
+         * Compares two handles.
+         * @param rhs               The other handle.
+         * @returns                 True if both name the same resource.
+        **/
+        /* ================================================================= */
+        bool operator==(ResourceHandle const &rhs) const = default;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Bytes read by the device, like vertices or constants.
+    **/
+    /* ===================================================================== */
+    struct Buffer
+    {
+        /** The bytes, as many as the buffer was created with. */
+        std::vector<std::uint8_t> bytes_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Color and depth the device can draw into.
+    **/
+    /* ===================================================================== */
+    struct Framebuffer
+    {
+        /** The width in pixels. */
+        unsigned width_ = 0;
+        /** The height in pixels. */
+        unsigned height_ = 0;
+        /** The colors, row after row. */
+        std::vector<Color> color_;
+        /** The depths, row after row. */
+        std::vector<float> depth_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The slots of one kind of resource.
+     * @tparam T                    The kind of resource, default
+     *                              constructible.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    class ResourcePool final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates an empty pool.
+        **/
+        /* ================================================================= */
+        ResourcePool();
+
+        /* ================================================================= */
+        /**
+         * Takes a free slot, or adds one if there are none. The resource
+         * in a reused slot is left as it was destroyed, for the caller to
+         * set up again without reallocating.
+         * @returns                 The handle of the slot.
+        **/
+        /* ================================================================= */
+        ResourceHandle<T> Allocate();
+        /* ================================================================= */
+        /**
+         * Destroys a resource. Its handle goes stale right away, but its
+         * slot is only reused once collected.
+         * @param handle            The resource.
+         * @param frame             The frame it was destroyed during.
+         * @throw std::invalid_argument If the handle is stale.
+        **/
+        /* ================================================================= */
+        void Release(ResourceHandle<T> handle, std::uint64_t frame) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Frees the slots destroyed up to a frame.
+         * @param frame             The last frame no longer running.
+        **/
+        /* ================================================================= */
+        void Collect(std::uint64_t frame);
+
+        /* ================================================================= */
+        /**
+         * Gets whether a handle names a live resource.
+         * @param handle            The handle.
+         * @returns                 True if it's live.
+        **/
+        /* ================================================================= */
+        bool IsAlive(ResourceHandle<T> handle) const;
+        /* ================================================================= */
+        /**
+         * Gets a resource. The reference is only valid until the next
+         * call to Allocate.
+         * @param handle            The resource.
+         * @returns                 The resource.
+         * @throw std::invalid_argument If the handle is stale.
+        **/
+        /* ================================================================= */
+        T &Get(ResourceHandle<T> handle) noexcept(false);
+        T const &Get(ResourceHandle<T> handle) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of live resources.
+         * @returns                 The number of live resources.
+        **/
+        /* ================================================================= */
+        size_t GetLiveCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of resources destroyed but not collected yet.
+         * @returns                 The number of resources waiting.
+        **/
+        /* ================================================================= */
+        size_t GetRetiredCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of slots, live or not.
+         * @returns                 The number of slots.
+        **/
+        /* ================================================================= */
+        size_t GetCapacity() const;
+    private:
+        /** Marks the end of the free list. */
+        static constexpr std::uint32_t None = 0xFFFFFFFFu;
+
+        /** A resource and its bookkeeping. */
+        struct Slot
+        {
+            /** The resource. */
+            T resource_;
+            /** How many times the slot was reused. */
+            std::uint32_t generation_;
+            /** The next free slot. */
+            std::uint32_t next_;
+            /** Whether the resource is live. */
+            bool live_;
+        };
+
+        /** The slots. */
+        std::vector<Slot> slots_;
+        /** The first free slot. */
+        std::uint32_t free_;
+        /** The slots destroyed and not collected yet, and when, oldest first. */
+        std::vector<std::pair<std::uint64_t, std::uint32_t> > retired_;
+        /** The number of live resources. */
+        size_t live_;
+    };
+}
+
+#include "Ludus/Graphics/Resources.tpp"
+
+/* ========================================================================= */
+#endif // Resources_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,119 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Resources.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Implements the pools of resources.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <stdexcept>
+
+namespace Ludus
+{
+    template <typename T>
+    ResourcePool<T>::ResourcePool() :
+        slots_(), free_(None), retired_(), live_(0)
+    {
+    }
+
+    template <typename T>
+    ResourceHandle<T> ResourcePool<T>::Allocate()
+    {
+        std::uint32_t index = free_;
+        if(index != None)
+        {
+            free_ = slots_[index].next_;
+        }
+        else
+        {
+            index = static_cast<std::uint32_t>(slots_.size());
+            // Generations start at one, so the default handle is never live.
+            slots_.push_back(Slot{ T(), 1, None, false });
+        }
+        Slot &slot = slots_[index];
+        slot.live_ = true;
+        ++live_;
+        return ResourceHandle<T>{ index, slot.generation_ };
+    }
+
+    template <typename T>
+    void ResourcePool<T>::Release(ResourceHandle<T> handle, std::uint64_t frame)
+    {
+        if(!IsAlive(handle))
+        {
+            throw std::invalid_argument("The resource was already destroyed.");
+        }
+        Slot &slot = slots_[handle.index_];
+        slot.live_ = false;
+        ++slot.generation_;
+        --live_;
+        retired_.emplace_back(frame, handle.index_);
+    }
+
+    template <typename T>
+    void ResourcePool<T>::Collect(std::uint64_t frame)
+    {
+        size_t collected = 0;
+        for(; collected < retired_.size() && retired_[collected].first <= frame; ++collected)
+        {
+            std::uint32_t const index = retired_[collected].second;
+            slots_[index].next_ = free_;
+            free_ = index;
+        }
+        // Only the frames still in flight are left, so the capacity stops
+        // growing once as many resources come and go every frame.
+        retired_.erase(retired_.begin(), retired_.begin() + collected);
+    }
+
+    template <typename T>
+    bool ResourcePool<T>::IsAlive(ResourceHandle<T> handle) const
+    {
+        return handle.index_ < slots_.size() && slots_[handle.index_].live_ &&
+            slots_[handle.index_].generation_ == handle.generation_;
+    }
+
+    template <typename T>
+    T &ResourcePool<T>::Get(ResourceHandle<T> handle)
+    {
+        if(!IsAlive(handle))
+        {
+            throw std::invalid_argument("The resource was destroyed.");
+        }
+        return slots_[handle.index_].resource_;
+    }
+
+    template <typename T>
+    T const &ResourcePool<T>::Get(ResourceHandle<T> handle) const
+    {
+        if(!IsAlive(handle))
+        {
+            throw std::invalid_argument("The resource was destroyed.");
+        }
+        return slots_[handle.index_].resource_;
+    }
+
+    template <typename T>
+    size_t ResourcePool<T>::GetLiveCount() const
+    {
+        return live_;
+    }
+
+    template <typename T>
+    size_t ResourcePool<T>::GetRetiredCount() const
+    {
+        return retired_.size();
+    }
+
+    template <typename T>
+    size_t ResourcePool<T>::GetCapacity() const
+    {
+        return slots_.size();
+    }
+}
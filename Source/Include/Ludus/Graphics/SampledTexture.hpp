@@ -0,0 +1,203 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            SampledTexture.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A texture laid out for filtered sampling on the CPU. It keeps every
+ * level of its mip chain, either as rows or as tiles of 4x4 texels so
+ * the texels a bilinear lookup reads mostly share a cache line. The
+ * kernels filter four samples at a time, one per lane of a register.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef SampledTexture_MODULE_H
+#define SampledTexture_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include "Ludus/Math/Simd.hpp"
+#include <vector>
+
+namespace Ludus
+{
+    /** Forward declaration to the Texture. */
+    class Texture;
+
+    /* ===================================================================== */
+    /**
+     * Defines how every level of the mip chain is made from the last.
+     * @enum MipFilter
+    **/
+    /* ===================================================================== */
+    enum class MipFilter : std::uint8_t
+    {
+        BOX    = 0x00,  /* Averages squares of 2x2 texels. */
+        KAISER = 0x01,  /* A Kaiser windowed sinc, sharper but slower. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * Defines how the texels of a level are ordered in memory.
+     * @enum TextureLayout
+    **/
+    /* ===================================================================== */
+    enum class TextureLayout : std::uint8_t
+    {
+        LINEAR = 0x00,  /* Row after row. */
+        TILED  = 0x01,  /* Tiles of 4x4 texels, a cache line each. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * A texture with its mip chain, ready to be sampled.
+    **/
+    /* ===================================================================== */
+    class SampledTexture final
+    {
+    public:
+        /** The side of a tile, in texels. */
+        static constexpr unsigned TileSize = 4;
+
+        /* ================================================================= */
+        /**
+         * Lays out a texture and makes its mip chain, down to a single
+         * texel.
+         * @param source            The texture.
+         * @param layout            How the texels are ordered.
+         * @param filter            How the mip chain is made.
+         * @throw std::invalid_argument If the texture is empty.
+        **/
+        /* ================================================================= */
+        explicit SampledTexture(Texture const &source,
+            TextureLayout layout = TextureLayout::TILED,
+            MipFilter filter = MipFilter::BOX) noexcept(false);
+
+        /* ================================================================= */
+        /**
+         * Samples a level, blending the four texels nearest to every
+         * texture coordinate. Coordinates outside of [0, 1) wrap.
+         * @param u                 The horizontal texture coordinates.
+         * @param v                 The vertical texture coordinates.
+         * @param count             The number of samples.
+         * @param level             The level sampled.
+         * @param colors            Gets the color of every sample.
+         * @throw std::out_of_range If there's no such level.
+        **/
+        /* ================================================================= */
+        void SampleBilinear(float const *u, float const *v, size_t count,
+            unsigned level, Color *colors) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Samples between the two levels nearest to the level of detail
+         * of every sample, bilinearly in each.
+         * @param u                 The horizontal texture coordinates.
+         * @param v                 The vertical texture coordinates.
+         * @param lod               The level of detail of every sample,
+         *                          clamped to the levels there are.
+         * @param count             The number of samples.
+         * @param colors            Gets the color of every sample.
+        **/
+        /* ================================================================= */
+        void SampleTrilinear(float const *u, float const *v, float const *lod,
+            size_t count, Color *colors) const;
+
+        /* ================================================================= */
+        /**
+         * Gets a single texel.
+         * @param level             The level.
+         * @param x                 The column of the texel.
+         * @param y                 The row of the texel.
+         * @returns                 The color of the texel.
+         * @throw std::out_of_range If there's no such level.
+        **/
+        /* ================================================================= */
+        Color GetTexel(unsigned level, unsigned x, unsigned y) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of levels of the mip chain.
+         * @returns                 The number of levels.
+        **/
+        /* ================================================================= */
+        unsigned GetLevelCount() const;
+        /* ================================================================= */
+        /**
+         * Gets the size of a level.
+         * @param level             The level.
+         * @returns                 The size in texels.
+         * @throw std::out_of_range If there's no such level.
+        **/
+        /* ================================================================= */
+        unsigned GetWidth(unsigned level = 0) const noexcept(false);
+        unsigned GetHeight(unsigned level = 0) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets how the texels are ordered.
+         * @returns                 The layout.
+        **/
+        /* ================================================================= */
+        TextureLayout GetLayout() const;
+        /* ================================================================= */
+        /**
+         * Gets how the mip chain was made.
+         * @returns                 The filter.
+        **/
+        /* ================================================================= */
+        MipFilter GetFilter() const;
+    private:
+        /** Where a level is and how big. */
+        struct Level
+        {
+            /** The width in texels. */
+            unsigned width_;
+            /** The height in texels. */
+            unsigned height_;
+            /** The tiles in a row of tiles. */
+            unsigned tilesPerRow_;
+            /** The first texel of the level. */
+            size_t offset_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Finds a texel of a level in memory.
+         * @param level             The level.
+         * @param x                 The column of the texel.
+         * @param y                 The row of the texel.
+         * @returns                 The index of the texel.
+        **/
+        /* ================================================================= */
+        size_t GetIndex(Level const &level, unsigned x, unsigned y) const;
+        /* ================================================================= */
+        /**
+         * Samples four texture coordinates bilinearly.
+         * @param u                 The four horizontal coordinates.
+         * @param v                 The four vertical coordinates.
+         * @param levels            The level sampled by every lane.
+         * @param channels          Gets every channel, a lane per sample.
+         * @throw std::out_of_range If a lane has no such level.
+        **/
+        /* ================================================================= */
+        void Bilinear4(float const *u, float const *v, unsigned const *levels,
+            Math::Simd::Float4 *channels) const noexcept(false);
+
+        /** How the texels are ordered. */
+        TextureLayout layout_;
+        /** How the mip chain was made. */
+        MipFilter filter_;
+        /** The levels, largest first. */
+        std::vector<Level> levels_;
+        /** The texels of every level. */
+        std::vector<Color> texels_;
+    };
+}
+
+/* ========================================================================= */
+#endif // SampledTexture_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,136 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            SpriteBatch.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Collects the sprites of a frame and hands them to the renderer in as few
+ * draws as possible.
+ * Sprites get sorted by layer, blend mode and atlas page, every run of
+ * sprites sharing all three becomes a single draw, and the vertices of
+ * all runs are written straight into the renderer's vertex array in
+ * parallel.
+ * Within a layer, sprites are not guaranteed to be drawn in the order
+ * they were added once they use different pages or blend modes; anything
+ * that has to be drawn on top belongs in a higher layer.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef SpriteBatch_MODULE_H
+#define SpriteBatch_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ludus
+{
+    /** Forward declaration to the TextureAtlas. */
+    class TextureAtlas;
+    /** Forward declaration to the Renderer. */
+    class Renderer;
+    /** Forward declaration to the JobSystem. */
+    class JobSystem;
+
+    /* ===================================================================== */
+    /**
+     * A textured rectangle drawn in framebuffer pixels.
+    **/
+    /* ===================================================================== */
+    struct Sprite
+    {
+        /** The horizontal position of the center. */
+        float x_;
+        /** The vertical position of the center. */
+        float y_;
+        /** The width of the sprite. */
+        float width_;
+        /** The height of the sprite. */
+        float height_;
+        /** The rotation around the center, in radians. */
+        float rotation_;
+        /** The color the image gets multiplied by. */
+        Color color_;
+        /** The atlas region of the image. */
+        std::uint32_t region_;
+        /** How the sprite gets blended. */
+        BlendMode blend_;
+        /** The layer of the sprite, lower layers are drawn first. */
+        std::int16_t layer_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Turns the sprites of a frame into batched draws.
+    **/
+    /* ===================================================================== */
+    class SpriteBatch final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a sprite batch.
+         * @param atlas             The atlas holding every image drawn.
+         * @param jobs              The job system used to build vertices
+         *                          in parallel, or null.
+        **/
+        /* ================================================================= */
+        explicit SpriteBatch(TextureAtlas const &atlas,
+            JobSystem *jobs = nullptr);
+        /* ================================================================= */
+        /**
+         * Queues a sprite for the next flush.
+         * @param sprite            The sprite to draw.
+        **/
+        /* ================================================================= */
+        void Draw(Sprite const &sprite);
+        /* ================================================================= */
+        /**
+         * Records every queued sprite into the renderer and empties
+         * the queue.
+         * @param renderer          The renderer to record into.
+        **/
+        /* ================================================================= */
+        void Flush(Renderer &renderer);
+        /* ================================================================= */
+        /**
+         * Gets the number of draws the last flush recorded.
+         * @returns                 The number of batches.
+        **/
+        /* ================================================================= */
+        size_t GetBatchCount() const;
+    private:
+        /* ================================================================= */
+        /**
+         * Writes the vertices of a range of sorted sprites.
+         * @param vertices          The vertices of the first sorted sprite.
+         * @param begin             The first sorted sprite to write.
+         * @param end               One past the last sorted sprite.
+        **/
+        /* ================================================================= */
+        void BuildVertices(Vertex2D *vertices, size_t begin, size_t end) const;
+
+        /** The atlas holding every image drawn. */
+        TextureAtlas const &atlas_;
+        /** The job system used to build vertices. */
+        JobSystem *jobs_;
+        /** The sprites queued for the next flush. */
+        std::vector<Sprite> sprites_;
+        /** The sort key of every sprite, followed by its index. */
+        std::vector<std::uint64_t> keys_;
+        /** The number of draws of the last flush. */
+        size_t batches_;
+    };
+}
+
+/* ========================================================================= */
+#endif // SpriteBatch_MODULE_H
+/* ========================================================================= */
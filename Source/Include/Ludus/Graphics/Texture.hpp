@@ -0,0 +1,139 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Texture.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * An image held in memory as rows of packed RGBA colors.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Texture_MODULE_H
+#define Texture_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * A two dimensional image the device can sample from.
+    **/
+    /* ===================================================================== */
+    class Texture final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates an empty texture.
+        **/
+        /* ================================================================= */
+        Texture();
+        /* ================================================================= */
+        /**
+         * Creates a texture filled with a single color.
+         * @param width             The width in texels.
+         * @param height            The height in texels.
+         * @param fill              The color of every texel.
+        **/
+        /* ================================================================= */
+        Texture(unsigned width, unsigned height, Color fill = 0);
+        /* ================================================================= */
+        /**
+         * Creates a texture from existing texels.
+         * @param width             The width in texels.
+         * @param height            The height in texels.
+         * @param texels            The rows of texels, top to bottom.
+         * @throw std::invalid_argument If there aren't width * height
+         *                          texels.
+        **/
+        /* ================================================================= */
+        Texture(unsigned width, unsigned height, std::vector<Color> texels)
+            noexcept(false);
+        /* ================================================================= */
+        /**
+         * Copies another texture into this one.
+         * @param source            The texture to copy.
+         * @param x                 The column to copy the source to.
+         * @param y                 The row to copy the source to.
+        **/
+        /* ================================================================= */
+        void Blit(Texture const &source, unsigned x, unsigned y);
+        /* ================================================================= */
+        /**
+         * Changes the size of the texture and fills it with a single
+         * color, reusing its memory when it's big enough.
+         * @param width             The width in texels.
+         * @param height            The height in texels.
+         * @param fill              The color of every texel.
+        **/
+        /* ================================================================= */
+        void Resize(unsigned width, unsigned height, Color fill = 0);
+
+        /* ================================================================= */
+        /**
+         * Gets the width of the texture.
+         * @returns                 The width in texels.
+        **/
+        /* ================================================================= */
+        unsigned GetWidth() const;
+        /* ================================================================= */
+        /**
+         * Gets the height of the texture.
+         * @returns                 The height in texels.
+        **/
+        /* ================================================================= */
+        unsigned GetHeight() const;
+        /* ================================================================= */
+        /**
+         * Gets a single texel.
+         * @param x                 The column of the texel.
+         * @param y                 The row of the texel.
+         * @returns                 The color of the texel.
+        **/
+        /* ================================================================= */
+        Color GetTexel(unsigned x, unsigned y) const;
+        /* ================================================================= */
+        /**
+         * Sets a single texel.
+         * @param x                 The column of the texel.
+         * @param y                 The row of the texel.
+         * @param color             The new color of the texel.
+        **/
+        /* ================================================================= */
+        void SetTexel(unsigned x, unsigned y, Color color);
+        /* ================================================================= */
+        /**
+         * Gets the texels, row after row.
+         * @returns                 A pointer to the first texel.
+        **/
+        /* ================================================================= */
+        Color const *GetData() const;
+        /* ================================================================= */
+        /**
+         * Gets the texels, row after row.
+         * @returns                 A pointer to the first texel.
+        **/
+        /* ================================================================= */
+        Color *GetData();
+    private:
+        /** The width in texels. */
+        unsigned width_;
+        /** The height in texels. */
+        unsigned height_;
+        /** The texels, row after row. */
+        std::vector<Color> texels_;
+    };
+}
+
+/* ========================================================================= */
+#endif // Texture_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,207 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            TextureAtlas.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Packs many small images into a few large pages, so sprites using
+ * different images can still be drawn together.
+ * Images are placed by a skyline packer: every page keeps the outline of
+ * the images already placed and a new image goes wherever its top ends
+ * up lowest.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef TextureAtlas_MODULE_H
+#define TextureAtlas_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Graphics/Texture.hpp"
+#include <memory>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Places rectangles inside a fixed size area.
+    **/
+    /* ===================================================================== */
+    class SkylinePacker final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates an empty packer.
+         * @param width             The width of the area.
+         * @param height            The height of the area.
+        **/
+        /* ================================================================= */
+        SkylinePacker(unsigned width, unsigned height);
+        /* ================================================================= */
+        /**
+         * Finds room for a rectangle and reserves it.
+         * @param width             The width of the rectangle.
+         * @param height            The height of the rectangle.
+         * @param x                 Set to the left of the rectangle placed.
+         * @param y                 Set to the top of the rectangle placed.
+         * @returns                 False if the rectangle doesn't fit.
+        **/
+        /* ================================================================= */
+        bool Pack(unsigned width, unsigned height, unsigned &x, unsigned &y);
+        /* ================================================================= */
+        /**
+         * Gets how much of the area is taken by packed rectangles.
+         * @returns                 The area used, between 0 and 1.
+        **/
+        /* ================================================================= */
+        float GetOccupancy() const;
+    private:
+        /* ================================================================= */
+        /** A horizontal piece of the outline. */
+        /* ================================================================= */
+        struct Segment
+        {
+            /** The left of the segment. */
+            unsigned x_;
+            /** The height of the outline along the segment. */
+            unsigned y_;
+            /** The width of the segment. */
+            unsigned width_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Finds where a rectangle starting at a segment would rest.
+         * @param index             The segment the rectangle starts at.
+         * @param width             The width of the rectangle.
+         * @param y                 Set to the top of the rectangle.
+         * @returns                 False if the rectangle goes past the
+         *                          right edge.
+        **/
+        /* ================================================================= */
+        bool Fit(size_t index, unsigned width, unsigned &y) const;
+
+        /** The width of the area. */
+        unsigned width_;
+        /** The height of the area. */
+        unsigned height_;
+        /** The area used by packed rectangles. */
+        size_t used_;
+        /** The outline of the packed rectangles, left to right. */
+        std::vector<Segment> skyline_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Where an image ended up in the atlas.
+    **/
+    /* ===================================================================== */
+    struct AtlasRegion
+    {
+        /** The page holding the image. */
+        unsigned page_;
+        /** The left texture coordinate. */
+        float u0_;
+        /** The top texture coordinate. */
+        float v0_;
+        /** The right texture coordinate. */
+        float u1_;
+        /** The bottom texture coordinate. */
+        float v1_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * A set of pages holding many images.
+    **/
+    /* ===================================================================== */
+    class TextureAtlas final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates an empty atlas.
+         * @param pageSize          The width and height of every page.
+         * @param padding           The empty texels kept around images so
+         *                          sampling doesn't bleed into neighbours.
+        **/
+        /* ================================================================= */
+        explicit TextureAtlas(unsigned pageSize = 1024, unsigned padding = 1);
+        /* ================================================================= */
+        /**
+         * Queues an image to be packed by the next call to Build.
+         * @param image             The image to add.
+         * @returns                 The identifier of the region the
+         *                          image will occupy.
+         * @throw std::invalid_argument If the image can't fit in a page.
+        **/
+        /* ================================================================= */
+        size_t Add(Texture image) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Packs every queued image, tallest first, opening new pages
+         * whenever the current ones are full.
+        **/
+        /* ================================================================= */
+        void Build();
+
+        /* ================================================================= */
+        /**
+         * Gets where an image was placed.
+         * @param region            The identifier returned by Add.
+         * @returns                 The region of the image.
+        **/
+        /* ================================================================= */
+        AtlasRegion const &GetRegion(size_t region) const;
+        /* ================================================================= */
+        /**
+         * Gets the number of pages.
+         * @returns                 The number of pages.
+        **/
+        /* ================================================================= */
+        unsigned GetPageCount() const;
+        /* ================================================================= */
+        /**
+         * Gets a page of the atlas.
+         * @param page              The index of the page.
+         * @returns                 The texture of the page.
+        **/
+        /* ================================================================= */
+        Texture const &GetPage(unsigned page) const;
+    private:
+        /* ================================================================= */
+        /** An image waiting for the next build. */
+        /* ================================================================= */
+        struct Pending
+        {
+            /** The region the image will fill. */
+            size_t region_;
+            /** The image itself. */
+            Texture image_;
+        };
+
+        /** The width and height of every page. */
+        unsigned pageSize_;
+        /** The empty texels kept around every image. */
+        unsigned padding_;
+        /** The texture of every page. */
+        std::vector<std::unique_ptr<Texture> > pages_;
+        /** The packer of every page. */
+        std::vector<SkylinePacker> packers_;
+        /** Where every image was placed. */
+        std::vector<AtlasRegion> regions_;
+        /** The images waiting to be packed. */
+        std::vector<Pending> pending_;
+    };
+}
+
+/* ========================================================================= */
+#endif // TextureAtlas_MODULE_H
+/* ========================================================================= */
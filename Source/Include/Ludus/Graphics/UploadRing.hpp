@@ -0,0 +1,144 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            UploadRing.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A ring of memory the data changing every frame gets written to, like
+ * dynamic vertices and constants. Allocating only moves the head of the
+ * ring forward, and every frame leaves a fence behind: once the frame is
+ * done the tail jumps to its fence, freeing everything it used at once.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef UploadRing_MODULE_H
+#define UploadRing_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * A piece of the upload ring.
+    **/
+    /* ===================================================================== */
+    struct UploadAllocation
+    {
+        /** Where to write the data, aligned to a cache line. */
+        std::uint8_t *data_;
+        /** Where the data is from the start of the ring. */
+        size_t offset_;
+        /** The number of bytes asked for. */
+        size_t size_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The memory written by the frames in flight, reused in a circle.
+    **/
+    /* ===================================================================== */
+    class UploadRing final
+    {
+    public:
+        /** The alignment of every allocation. */
+        static constexpr size_t Alignment = 64;
+
+        /* ================================================================= */
+        /**
+         * Creates a ring big enough for the frame being written and the
+         * frames in flight, and for the end of the ring an allocation
+         * skips when it doesn't fit there.
+         * @param bytesPerFrame     The most bytes a frame may allocate,
+         *                          each allocation rounded up to the
+         *                          Alignment.
+         * @param framesInFlight    The frames that may still read their
+         *                          data while the next one is written.
+        **/
+        /* ================================================================= */
+        UploadRing(size_t bytesPerFrame, unsigned framesInFlight);
+        UploadRing(UploadRing const &) = delete;
+        UploadRing &operator=(UploadRing const &) = delete;
+        UploadRing(UploadRing &&) = default;
+        UploadRing &operator=(UploadRing &&) = default;
+
+        /* ================================================================= */
+        /**
+         * Allocates memory for the current frame.
+         * @param size              The number of bytes.
+         * @returns                 The memory.
+         * @throw std::length_error If the frames in flight still use the
+         *                          memory needed.
+        **/
+        /* ================================================================= */
+        UploadAllocation Allocate(size_t size) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Ends the frame being written, leaving a fence at the head.
+         * @param frame             The frame ended.
+        **/
+        /* ================================================================= */
+        void Fence(std::uint64_t frame);
+        /* ================================================================= */
+        /**
+         * Frees the memory of the frames done.
+         * @param frame             The last frame no longer running.
+        **/
+        /* ================================================================= */
+        void Reclaim(std::uint64_t frame);
+
+        /* ================================================================= */
+        /**
+         * Gets the size of the ring.
+         * @returns                 The size in bytes.
+        **/
+        /* ================================================================= */
+        size_t GetCapacity() const;
+        /* ================================================================= */
+        /**
+         * Gets the memory not reclaimed yet, padding included.
+         * @returns                 The bytes in use.
+        **/
+        /* ================================================================= */
+        size_t GetUsed() const;
+    private:
+        /** A cache line, so the memory comes aligned. */
+        struct alignas(Alignment) Line
+        {
+            std::uint8_t bytes_[Alignment];
+        };
+
+        /** Where a frame ended. */
+        struct FrameFence
+        {
+            /** The frame. */
+            std::uint64_t frame_;
+            /** The head of the ring when it ended. */
+            std::uint64_t head_;
+        };
+
+        /** The memory of the ring. */
+        std::unique_ptr<Line[]> lines_;
+        /** The size of the ring in bytes. */
+        size_t capacity_;
+        /** The bytes ever allocated, wrapping waste included. */
+        std::uint64_t head_;
+        /** The bytes ever reclaimed. */
+        std::uint64_t tail_;
+        /** The fences not reached yet, oldest first. */
+        std::vector<FrameFence> fences_;
+    };
+}
+
+/* ========================================================================= */
+#endif // UploadRing_MODULE_H
+/* ========================================================================= */
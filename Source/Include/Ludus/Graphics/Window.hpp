@@ -8,6 +8,13 @@
  * @brief
  * Contains the data needed for the Engine's window to run.
  * The only requirement for a window to exist is that it needs a swapchain.
+ * Presenting copies the color buffer of the device into one of the images
+ * of the swapchain, which a display scans out once per refresh. How many
+ * images there are, how they get queued and how far the frames may run
+ * ahead of the display trade throughput for latency.
+ * Resizing waits for the end of the frame, so only the last size asked for
+ * is used, and the images are only reallocated when growing past their
+ * capacity. Otherwise the frames keep to a corner of the images.
  **/
 /* ========================================================================= */
 
@@ -20,9 +27,25 @@
 /* Includes */
 /* ========================================================================= */
 #include "Ludus/Graphics/Graphics.hpp"
+#include "Ludus/Graphics/RenderTypes.hpp"
+#include <cstdint>
+#include <vector>
 
 namespace Ludus
 {
+    /* ================================================================= */
+    /**
+     * Defines how presented images reach the display.
+     * @enum PresentMode
+    **/
+    /* ================================================================= */
+    enum class PresentMode : std::uint8_t
+    {
+        IMMEDIATE = 0x00,  /* Shown right away, tearing the refresh. */
+        FIFO      = 0x01,  /* Queued, one per refresh, Present waits. */
+        MAILBOX   = 0x02,  /* The newest replaces the one queued. */
+    };
+
     /* ================================================================= */
     /**
      * The window that holds all the information for the rendering 
@@ -51,14 +74,44 @@ namespace Ludus
             unsigned width_;
             /** The height of the swap chain. */
             unsigned height_;
+            /** The number of images, two or three. */
+            unsigned buffers_ = 2;
+            /** How presented images reach the display. */
+            PresentMode presentMode_ = PresentMode::FIFO;
+            /** The frames presented but not shown yet before a frame waits. */
+            unsigned framesInFlight_ = 2;
+            /** The refreshes of the display per second. */
+            unsigned refreshRate_ = 60;
+        };
+        /* ============================================================= */
+        /** What happened to the presented frames. */
+        /* ============================================================= */
+        struct PresentStatistics
+        {
+            /** The number of frames presented. */
+            size_t presented_;
+            /** The number of frames shown on the display. */
+            size_t displayed_;
+            /** The number of frames replaced before they were shown. */
+            size_t dropped_;
+            /** The time from input to display of the last frame shown. */
+            std::int64_t lastLatency_;
+            /** The longest time from input to display. */
+            std::int64_t maxLatency_;
+            /** The average time from input to display. */
+            std::int64_t averageLatency_;
         };
 
         /* ============================================================= */
         /**
          * The creation of the window itself.
+         * @throw std::invalid_argument If the swapchain doesn't have two or
+         *                              three images, lets no frame in
+         *                              flight or has no refresh rate.
         **/
         /* ============================================================= */
-        Window(Settings const &settings, Swapchain const &swapchain);
+        Window(Settings const &settings, Swapchain const &swapchain)
+            noexcept(false);
         /* ============================================================= */
         /**
          * Sets the title of the window.
@@ -68,7 +121,8 @@ namespace Ludus
         void SetTitle(std::wstring const &title);
         /* ============================================================= */
         /**
-         * Sets the dimensions of the swap chain.
+         * Sets the dimensions of the swap chain. The swapchain and the
+         * device follow when the frame is presented.
          * @param width                 The new width of the swapchain.
          * @param height                The new height of the swapchain.
          */
@@ -82,17 +136,37 @@ namespace Ludus
          */
         /* ============================================================= */
         void SetRenderingAPI(Graphics::DeviceType const &api);
+        /* ============================================================= */
+        /**
+         * Waits until fewer frames than allowed are waiting for the
+         * display. Called before sampling the input of a frame, the
+         * lower the limit the fresher the input.
+        **/
+        /* ============================================================= */
+        void WaitForFrame();
+        /* ============================================================= */
+        /**
+         * Copies the color buffer of the device into an image of the
+         * swapchain and hands it to the display. Ends the frame, so the
+         * swapchain and the device take the last dimensions set.
+         * @param device                The device that drew the frame.
+         * @param inputTime             When the oldest input of the frame
+         *                              happened, on the clock of
+         *                              Input::Now, or negative.
+        **/
+        /* ============================================================= */
+        void Present(Device &device, std::int64_t inputTime = -1);
 
         /* ============================================================= */
         /**
-         * Gets the width of the swapchain.
+         * Gets the width of the swapchain, as last set.
          * @returns                     The width of the swapchain.
         **/
         /* ============================================================= */
         unsigned GetWidth() const;
         /* ============================================================= */
         /**
-         * Gets the height of the swapchain.
+         * Gets the height of the swapchain, as last set.
          * @returns                     The height of the swapchain.
         **/
         /* ============================================================= */
@@ -111,12 +185,122 @@ namespace Ludus
          */
         /* ============================================================= */
         Graphics::DeviceType const &GetRenderingAPI() const;
+        /* ============================================================= */
+        /**
+         * Gets the settings of the swapchain.
+         * @returns                     The settings of the swapchain.
+        **/
+        /* ============================================================= */
+        Swapchain const &GetSwapchain() const;
+        /* ============================================================= */
+        /**
+         * Gets the image shown on the display, row after row, the pitch
+         * apart.
+         * @returns                     A pointer to the first pixel.
+        **/
+        /* ============================================================= */
+        Color const *GetFrontBuffer();
+        /* ============================================================= */
+        /**
+         * Gets the distance between two rows of the images.
+         * @returns                     The pitch in pixels.
+        **/
+        /* ============================================================= */
+        unsigned GetPitch() const;
+        /* ============================================================= */
+        /**
+         * Gets how many times the images were reallocated to grow.
+         * @returns                     The number of reallocations.
+        **/
+        /* ============================================================= */
+        size_t GetReallocationCount() const;
+        /* ============================================================= */
+        /**
+         * Gets what happened to the presented frames.
+         * @returns                     The statistics.
+        **/
+        /* ============================================================= */
+        PresentStatistics GetPresentStatistics();
 
     private:
+        /* ============================================================= */
+        /** An image of the swapchain. */
+        /* ============================================================= */
+        struct Image
+        {
+            /** The pixels, row after row. */
+            std::vector<Color> pixels_;
+            /** When the oldest input of its frame happened. */
+            std::int64_t inputTime_;
+        };
+
+        /* ============================================================= */
+        /**
+         * Gives the images and the device the dimensions last set.
+         * @param device                The device drawing the frames.
+        **/
+        /* ============================================================= */
+        void Resize(Device &device);
+        /* ============================================================= */
+        /**
+         * Shows the queued images the display got to by now.
+         * @param now                   The current time.
+        **/
+        /* ============================================================= */
+        void Refresh(std::int64_t now);
+        /* ============================================================= */
+        /**
+         * Sleeps until the next refresh and shows what's queued.
+        **/
+        /* ============================================================= */
+        void WaitForRefresh();
+        /* ============================================================= */
+        /**
+         * Shows an image on the display.
+         * @param image                 The image.
+         * @param time                  When it shows.
+        **/
+        /* ============================================================= */
+        void Show(unsigned image, std::int64_t time);
+        /* ============================================================= */
+        /**
+         * Finds an image neither shown nor queued.
+         * @returns                     The image, or the count of images
+         *                              if they're all taken.
+        **/
+        /* ============================================================= */
+        unsigned FindFreeImage() const;
+
+
         /** The settings relating to the window itself. */
         Settings settings_;
         /** The settings for the swap chain of this window. */
         Swapchain swapchain_;
+        /** The images of the swapchain. */
+        std::vector<Image> images_;
+        /** The image shown on the display. */
+        unsigned front_;
+        /** The images waiting for the display, oldest first. */
+        std::vector<unsigned> queued_;
+        /** The pixels allocated per row of the images. */
+        unsigned pitch_;
+        /** The rows allocated for the images. */
+        unsigned rows_;
+        /** The dimensions last set, used from the next frame. */
+        unsigned width_;
+        unsigned height_;
+        /** The times the images were reallocated. */
+        size_t reallocations_;
+        /** The time between refreshes, in nanoseconds. */
+        std::int64_t period_;
+        /** The time of the next refresh. */
+        std::int64_t vblank_;
+        /** What happened to the presented frames. */
+        PresentStatistics statistics_;
+        /** The total latency of the frames shown with an input time. */
+        std::int64_t latencySum_;
+        /** The frames shown with an input time. */
+        size_t latencyCount_;
     };
 }
 
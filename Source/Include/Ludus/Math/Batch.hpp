@@ -0,0 +1,176 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Batch.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides kernels running the same math operation over many values.
+ * Points and quaternions are passed as structures of arrays, one array per
+ * component, so every register load grabs the same component of four
+ * values. Matrices stay as arrays of Mat4, since a single Mat4 already
+ * fills four registers.
+ * The Scalar namespace holds plain loop versions of every kernel, used on
+ * platforms without vector registers and as the reference in tests.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Batch_MODULE_H
+#define Batch_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Math/Math.hpp"
+#include <cstddef>
+
+namespace Ludus
+{
+    namespace Math
+    {
+        /* ================================================================= */
+        /**
+         * A read only view of points stored as one array per component.
+        **/
+        /* ================================================================= */
+        struct PointStream
+        {
+            /** The x component of every point. */
+            float const *x_;
+            /** The y component of every point. */
+            float const *y_;
+            /** The z component of every point. */
+            float const *z_;
+        };
+
+        /* ================================================================= */
+        /**
+         * A writable view of points stored as one array per component.
+        **/
+        /* ================================================================= */
+        struct PointOutput
+        {
+            /** The x component of every point. */
+            float *x_;
+            /** The y component of every point. */
+            float *y_;
+            /** The z component of every point. */
+            float *z_;
+        };
+
+        /* ================================================================= */
+        /**
+         * A writable view of quaternions stored as one array per component.
+        **/
+        /* ================================================================= */
+        struct QuatStream
+        {
+            /** The x component of every quaternion. */
+            float *x_;
+            /** The y component of every quaternion. */
+            float *y_;
+            /** The z component of every quaternion. */
+            float *z_;
+            /** The w component of every quaternion. */
+            float *w_;
+        };
+
+        /* ================================================================= */
+        /**
+         * A writable view of four dimensional vectors stored as one array
+         * per component.
+        **/
+        /* ================================================================= */
+        struct Vec4Stream
+        {
+            /** The x component of every vector. */
+            float *x_;
+            /** The y component of every vector. */
+            float *y_;
+            /** The z component of every vector. */
+            float *z_;
+            /** The w component of every vector. */
+            float *w_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Transforms points by a matrix, treating them as having w = 1.
+         * The output may alias the input.
+         * @param mat               The matrix to transform by.
+         * @param points            The points to transform.
+         * @param output            Where to write the transformed points.
+         * @param count             The number of points.
+        **/
+        /* ================================================================= */
+        void TransformPoints(Mat4 const &mat, PointStream points,
+            PointOutput output, size_t count);
+        /* ================================================================= */
+        /**
+         * Transforms points by a projection, keeping the w component
+         * needed for the perspective divide.
+         * @param mat               The matrix to transform by.
+         * @param points            The points to transform, with w = 1.
+         * @param output            Where to write the transformed points.
+         * @param count             The number of points.
+        **/
+        /* ================================================================= */
+        void ProjectPoints(Mat4 const &mat, PointStream points,
+            Vec4Stream output, size_t count);
+        /* ================================================================= */
+        /**
+         * Multiplies pairs of matrices, output[i] = lhs[i] * rhs[i].
+         * @param lhs               The matrices on the left hand side.
+         * @param rhs               The matrices on the right hand side.
+         * @param output            Where to write the products.
+         * @param count             The number of pairs.
+        **/
+        /* ================================================================= */
+        void MultiplyMatrices(Mat4 const *lhs, Mat4 const *rhs, Mat4 *output,
+            size_t count);
+        /* ================================================================= */
+        /**
+         * Multiplies one matrix by many, output[i] = lhs * rhs[i].
+         * @param lhs               The matrix on the left hand side.
+         * @param rhs               The matrices on the right hand side.
+         * @param output            Where to write the products.
+         * @param count             The number of matrices.
+        **/
+        /* ================================================================= */
+        void MultiplyMatrices(Mat4 const &lhs, Mat4 const *rhs, Mat4 *output,
+            size_t count);
+        /* ================================================================= */
+        /**
+         * Normalizes quaternions in place.
+         * @param quats             The quaternions to normalize.
+         * @param count             The number of quaternions.
+        **/
+        /* ================================================================= */
+        void NormalizeQuats(QuatStream quats, size_t count);
+
+        /* ================================================================= */
+        /**
+         * Defines the plain loop versions of the batch kernels.
+        **/
+        /* ================================================================= */
+        namespace Scalar
+        {
+            void TransformPoints(Mat4 const &mat, PointStream points,
+                PointOutput output, size_t count);
+            void ProjectPoints(Mat4 const &mat, PointStream points,
+                Vec4Stream output, size_t count);
+            void MultiplyMatrices(Mat4 const *lhs, Mat4 const *rhs,
+                Mat4 *output, size_t count);
+            void MultiplyMatrices(Mat4 const &lhs, Mat4 const *rhs,
+                Mat4 *output, size_t count);
+            void NormalizeQuats(QuatStream quats, size_t count);
+        }
+    }
+}
+
+/* ========================================================================= */
+#endif // Batch_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,284 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Math.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides the basic math types used throughout the engine:
+ * - Vec3, a three dimensional vector.
+ * - Vec4, a four dimensional vector.
+ * - Quat, a rotation quaternion.
+ * - Mat4, a column major 4x4 matrix.
+ * Vec4, Quat and Mat4 are aligned to fit the vector registers, and their
+ * operations go through the wrappers in Simd.hpp.
+ * All the functions are small and defined inline in Math.inl.
+ * Kernels working on many values at once live in Batch.hpp.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Math_MODULE_H
+#define Math_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Math/Simd.hpp"
+#include "Ludus/System/Reflection.hpp"
+#include <cmath>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Defines the namespace all the math types of the engine live in.
+    **/
+    /* ===================================================================== */
+    namespace Math
+    {
+        /* ================================================================= */
+        /**
+         * A three dimensional vector of floats.
+        **/
+        /* ================================================================= */
+        struct Vec3
+        {
+            /** The x component of the vector. */
+            float x_;
+            /** The y component of the vector. */
+            float y_;
+            /** The z component of the vector. */
+            float z_;
+
+            /* ============================================================= */
+            /**
+             * Creates a vector with all of its components set.
+             * @param x             The x component.
+             * @param y             The y component.
+             * @param z             The z component.
+            **/
+            /* ============================================================= */
+            constexpr Vec3(float x = 0.0f, float y = 0.0f, float z = 0.0f);
+        };
+
+        /* ================================================================= */
+        /**
+         * A four dimensional vector of floats, fitting a single register.
+        **/
+        /* ================================================================= */
+        struct alignas(16) Vec4
+        {
+            /** The x component of the vector. */
+            float x_;
+            /** The y component of the vector. */
+            float y_;
+            /** The z component of the vector. */
+            float z_;
+            /** The w component of the vector. */
+            float w_;
+
+            /* ============================================================= */
+            /**
+             * Creates a vector with all of its components set.
+             * @param x             The x component.
+             * @param y             The y component.
+             * @param z             The z component.
+             * @param w             The w component.
+            **/
+            /* ============================================================= */
+            constexpr Vec4(float x = 0.0f, float y = 0.0f, float z = 0.0f,
+                float w = 0.0f);
+            /* ============================================================= */
+            /**
+             * Creates a vector from a three dimensional one.
+             * @param xyz           The x, y and z components.
+             * @param w             The w component.
+            **/
+            /* ============================================================= */
+            constexpr Vec4(Vec3 const &xyz, float w);
+            /* ============================================================= */
+            /**
+             * Loads the vector into a register.
+             * @returns             The register holding x, y, z, w.
+            **/
+            /* ============================================================= */
+            Simd::Float4 Load() const;
+            /* ============================================================= */
+            /**
+             * Creates a vector from a register.
+             * @param value         The register holding x, y, z, w.
+             * @returns             The vector stored.
+            **/
+            /* ============================================================= */
+            static Vec4 Store(Simd::Float4 value);
+        };
+
+        /* ================================================================= */
+        /**
+         * A unit quaternion used to represent rotations.
+        **/
+        /* ================================================================= */
+        struct alignas(16) Quat
+        {
+            /** The x component of the imaginary part. */
+            float x_;
+            /** The y component of the imaginary part. */
+            float y_;
+            /** The z component of the imaginary part. */
+            float z_;
+            /** The real part of the quaternion. */
+            float w_;
+
+            /* ============================================================= */
+            /**
+             * Creates a quaternion, defaulting to the identity rotation.
+             * @param x             The x component of the imaginary part.
+             * @param y             The y component of the imaginary part.
+             * @param z             The z component of the imaginary part.
+             * @param w             The real part.
+            **/
+            /* ============================================================= */
+            constexpr Quat(float x = 0.0f, float y = 0.0f, float z = 0.0f,
+                float w = 1.0f);
+            /* ============================================================= */
+            /**
+             * Creates a rotation around an axis.
+             * @param axis          The normalized axis to rotate around.
+             * @param radians       The angle to rotate by.
+             * @returns             The quaternion for the rotation.
+            **/
+            /* ============================================================= */
+            static Quat FromAxisAngle(Vec3 const &axis, float radians);
+        };
+
+        /** The fields of the vectors and quaternions, for serializers. */
+        LUDUS_REFLECT_TYPE(Vec3, LUDUS_FIELD(x_), LUDUS_FIELD(y_), LUDUS_FIELD(z_))
+        LUDUS_REFLECT_TYPE(Vec4, LUDUS_FIELD(x_), LUDUS_FIELD(y_), LUDUS_FIELD(z_),
+            LUDUS_FIELD(w_))
+        LUDUS_REFLECT_TYPE(Quat, LUDUS_FIELD(x_), LUDUS_FIELD(y_), LUDUS_FIELD(z_),
+            LUDUS_FIELD(w_))
+
+        /* ================================================================= */
+        /**
+         * A 4x4 matrix of floats stored in column major order, so
+         * m_[column * 4 + row] is the element at (row, column).
+        **/
+        /* ================================================================= */
+        struct alignas(16) Mat4
+        {
+            /** The elements of the matrix in column major order. */
+            float m_[16];
+
+            /* ============================================================= */
+            /**
+             * Gets the identity matrix.
+             * @returns             The identity matrix.
+            **/
+            /* ============================================================= */
+            static Mat4 Identity();
+            /* ============================================================= */
+            /**
+             * Builds the matrix that scales, then rotates, then translates.
+             * @param translation   The translation of the matrix.
+             * @param rotation      The rotation of the matrix.
+             * @param scale         The scale of the matrix.
+             * @returns             The composed matrix.
+            **/
+            /* ============================================================= */
+            static Mat4 Compose(Vec3 const &translation, Quat const &rotation,
+                Vec3 const &scale);
+            /* ============================================================= */
+            /**
+             * Builds a perspective projection mapping the view volume to
+             * [-1, 1] on every axis, looking down -z.
+             * @param fovY          The vertical field of view in radians.
+             * @param aspect        The width divided by the height.
+             * @param near          The distance to the near plane.
+             * @param far           The distance to the far plane.
+             * @returns             The projection matrix.
+            **/
+            /* ============================================================= */
+            static Mat4 Perspective(float fovY, float aspect, float near,
+                float far);
+            /* ============================================================= */
+            /**
+             * Builds the view matrix of a camera looking at a point.
+             * @param eye           The position of the camera.
+             * @param target        The point looked at.
+             * @param up            The up direction of the world.
+             * @returns             The view matrix.
+            **/
+            /* ============================================================= */
+            static Mat4 LookAt(Vec3 const &eye, Vec3 const &target,
+                Vec3 const &up);
+            /* ============================================================= */
+            /**
+             * Gets an element of the matrix.
+             * @param row           The row of the element.
+             * @param column        The column of the element.
+             * @returns             The element at that row and column.
+            **/
+            /* ============================================================= */
+            float operator()(unsigned row, unsigned column) const;
+            /* ============================================================= */
+            /**
+             * Loads a column of the matrix into a register.
+             * @param column        The column to load.
+             * @returns             The register holding the column.
+            **/
+            /* ============================================================= */
+            Simd::Float4 Column(unsigned column) const;
+        };
+
+        /* ================================================================= */
+        /* Vector operations */
+        /* ================================================================= */
+        Vec3 operator+(Vec3 const &lhs, Vec3 const &rhs);
+        Vec3 operator-(Vec3 const &lhs, Vec3 const &rhs);
+        Vec3 operator*(Vec3 const &lhs, float rhs);
+        float Dot(Vec3 const &lhs, Vec3 const &rhs);
+        Vec3 Cross(Vec3 const &lhs, Vec3 const &rhs);
+        float Length(Vec3 const &vec);
+        Vec3 Normalize(Vec3 const &vec);
+        Vec4 operator+(Vec4 const &lhs, Vec4 const &rhs);
+        Vec4 operator-(Vec4 const &lhs, Vec4 const &rhs);
+        Vec4 operator*(Vec4 const &lhs, float rhs);
+        float Dot(Vec4 const &lhs, Vec4 const &rhs);
+        float Length(Vec4 const &vec);
+        Vec4 Normalize(Vec4 const &vec);
+
+        /* ================================================================= */
+        /* Quaternion operations */
+        /* ================================================================= */
+        Quat operator*(Quat const &lhs, Quat const &rhs);
+        Quat Normalize(Quat const &quat);
+        Vec3 Rotate(Quat const &quat, Vec3 const &vec);
+
+        /* ================================================================= */
+        /* Matrix operations */
+        /* ================================================================= */
+        Mat4 operator*(Mat4 const &lhs, Mat4 const &rhs);
+        Vec4 operator*(Mat4 const &mat, Vec4 const &vec);
+        Vec3 TransformPoint(Mat4 const &mat, Vec3 const &point);
+        /* ============================================================= */
+        /**
+         * Checks if two matrices are the same within a tolerance.
+         * @param lhs               The matrix on the left hand side.
+         * @param rhs               The matrix on the right hand side.
+         * @param epsilon           The largest difference allowed between
+         *                          two elements.
+         * @returns                 True if every element is close enough.
+        **/
+        /* ============================================================= */
+        bool NearlyEqual(Mat4 const &lhs, Mat4 const &rhs,
+            float epsilon = 1e-5f);
+    }
+}
+
+#include "Math.inl"
+/* ========================================================================= */
+#endif // Math_MODULE_H
+/* ========================================================================= */
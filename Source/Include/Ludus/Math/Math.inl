@@ -0,0 +1,272 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Math.inl
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Defines the inline functions of the basic math types.
+ **/
+/* ========================================================================= */
+
+namespace Ludus
+{
+    namespace Math
+    {
+        constexpr Vec3::Vec3(float x, float y, float z) :
+            x_(x), y_(y), z_(z)
+        {
+        }
+
+        constexpr Vec4::Vec4(float x, float y, float z, float w) :
+            x_(x), y_(y), z_(z), w_(w)
+        {
+        }
+
+        constexpr Vec4::Vec4(Vec3 const &xyz, float w) :
+            x_(xyz.x_), y_(xyz.y_), z_(xyz.z_), w_(w)
+        {
+        }
+
+        inline Simd::Float4 Vec4::Load() const
+        {
+            return Simd::Load(&x_);
+        }
+
+        inline Vec4 Vec4::Store(Simd::Float4 value)
+        {
+            Vec4 result;
+            Simd::Store(&result.x_, value);
+            return result;
+        }
+
+        constexpr Quat::Quat(float x, float y, float z, float w) :
+            x_(x), y_(y), z_(z), w_(w)
+        {
+        }
+
+        inline Quat Quat::FromAxisAngle(Vec3 const &axis, float radians)
+        {
+            float const s = std::sin(radians * 0.5f);
+            return Quat(axis.x_ * s, axis.y_ * s, axis.z_ * s,
+                std::cos(radians * 0.5f));
+        }
+
+        inline Mat4 Mat4::Identity()
+        {
+            return Mat4{ { 1.0f, 0.0f, 0.0f, 0.0f,
+                           0.0f, 1.0f, 0.0f, 0.0f,
+                           0.0f, 0.0f, 1.0f, 0.0f,
+                           0.0f, 0.0f, 0.0f, 1.0f } };
+        }
+
+        inline Mat4 Mat4::Compose(Vec3 const &translation,
+            Quat const &rotation, Vec3 const &scale)
+        {
+            float const x = rotation.x_, y = rotation.y_, z = rotation.z_;
+            float const w = rotation.w_;
+            float const xx = x * x, yy = y * y, zz = z * z;
+            float const xy = x * y, xz = x * z, yz = y * z;
+            float const wx = w * x, wy = w * y, wz = w * z;
+
+            Mat4 result;
+            // The rotation columns scaled by each axis of the scale.
+            result.m_[0]  = (1.0f - 2.0f * (yy + zz)) * scale.x_;
+            result.m_[1]  = (2.0f * (xy + wz)) * scale.x_;
+            result.m_[2]  = (2.0f * (xz - wy)) * scale.x_;
+            result.m_[3]  = 0.0f;
+            result.m_[4]  = (2.0f * (xy - wz)) * scale.y_;
+            result.m_[5]  = (1.0f - 2.0f * (xx + zz)) * scale.y_;
+            result.m_[6]  = (2.0f * (yz + wx)) * scale.y_;
+            result.m_[7]  = 0.0f;
+            result.m_[8]  = (2.0f * (xz + wy)) * scale.z_;
+            result.m_[9]  = (2.0f * (yz - wx)) * scale.z_;
+            result.m_[10] = (1.0f - 2.0f * (xx + yy)) * scale.z_;
+            result.m_[11] = 0.0f;
+            // The translation column.
+            result.m_[12] = translation.x_;
+            result.m_[13] = translation.y_;
+            result.m_[14] = translation.z_;
+            result.m_[15] = 1.0f;
+            return result;
+        }
+
+        inline Mat4 Mat4::Perspective(float fovY, float aspect, float near,
+            float far)
+        {
+            float const focal = 1.0f / std::tan(fovY * 0.5f);
+            Mat4 result = {};
+            result.m_[0] = focal / aspect;
+            result.m_[5] = focal;
+            result.m_[10] = (far + near) / (near - far);
+            result.m_[11] = -1.0f;
+            result.m_[14] = 2.0f * far * near / (near - far);
+            return result;
+        }
+
+        inline Mat4 Mat4::LookAt(Vec3 const &eye, Vec3 const &target,
+            Vec3 const &up)
+        {
+            Vec3 const forward = Normalize(target - eye);
+            Vec3 const right = Normalize(Cross(forward, up));
+            Vec3 const cameraUp = Cross(right, forward);
+            return Mat4{ { right.x_, cameraUp.x_, -forward.x_, 0.0f,
+                           right.y_, cameraUp.y_, -forward.y_, 0.0f,
+                           right.z_, cameraUp.z_, -forward.z_, 0.0f,
+                           -Dot(right, eye), -Dot(cameraUp, eye), Dot(forward, eye), 1.0f } };
+        }
+
+        inline float Mat4::operator()(unsigned row, unsigned column) const
+        {
+            return m_[column * 4 + row];
+        }
+
+        inline Simd::Float4 Mat4::Column(unsigned column) const
+        {
+            return Simd::Load(m_ + column * 4);
+        }
+
+        inline Vec3 operator+(Vec3 const &lhs, Vec3 const &rhs)
+        {
+            return Vec3(lhs.x_ + rhs.x_, lhs.y_ + rhs.y_, lhs.z_ + rhs.z_);
+        }
+
+        inline Vec3 operator-(Vec3 const &lhs, Vec3 const &rhs)
+        {
+            return Vec3(lhs.x_ - rhs.x_, lhs.y_ - rhs.y_, lhs.z_ - rhs.z_);
+        }
+
+        inline Vec3 operator*(Vec3 const &lhs, float rhs)
+        {
+            return Vec3(lhs.x_ * rhs, lhs.y_ * rhs, lhs.z_ * rhs);
+        }
+
+        inline float Dot(Vec3 const &lhs, Vec3 const &rhs)
+        {
+            return lhs.x_ * rhs.x_ + lhs.y_ * rhs.y_ + lhs.z_ * rhs.z_;
+        }
+
+        inline Vec3 Cross(Vec3 const &lhs, Vec3 const &rhs)
+        {
+            return Vec3(lhs.y_ * rhs.z_ - lhs.z_ * rhs.y_,
+                        lhs.z_ * rhs.x_ - lhs.x_ * rhs.z_,
+                        lhs.x_ * rhs.y_ - lhs.y_ * rhs.x_);
+        }
+
+        inline float Length(Vec3 const &vec)
+        {
+            return std::sqrt(Dot(vec, vec));
+        }
+
+        inline Vec3 Normalize(Vec3 const &vec)
+        {
+            return vec * (1.0f / Length(vec));
+        }
+
+        inline Vec4 operator+(Vec4 const &lhs, Vec4 const &rhs)
+        {
+            return Vec4::Store(Simd::Add(lhs.Load(), rhs.Load()));
+        }
+
+        inline Vec4 operator-(Vec4 const &lhs, Vec4 const &rhs)
+        {
+            return Vec4::Store(Simd::Sub(lhs.Load(), rhs.Load()));
+        }
+
+        inline Vec4 operator*(Vec4 const &lhs, float rhs)
+        {
+            return Vec4::Store(Simd::Mul(lhs.Load(), Simd::Splat(rhs)));
+        }
+
+        inline float Dot(Vec4 const &lhs, Vec4 const &rhs)
+        {
+            return Simd::GetX(Simd::Dot4(lhs.Load(), rhs.Load()));
+        }
+
+        inline float Length(Vec4 const &vec)
+        {
+            Simd::Float4 const value = vec.Load();
+            return Simd::GetX(Simd::Sqrt(Simd::Dot4(value, value)));
+        }
+
+        inline Vec4 Normalize(Vec4 const &vec)
+        {
+            Simd::Float4 const value = vec.Load();
+            return Vec4::Store(Simd::Div(value,
+                Simd::Sqrt(Simd::Dot4(value, value))));
+        }
+
+        inline Quat operator*(Quat const &lhs, Quat const &rhs)
+        {
+            return Quat(
+                lhs.w_ * rhs.x_ + lhs.x_ * rhs.w_ + lhs.y_ * rhs.z_ - lhs.z_ * rhs.y_,
+                lhs.w_ * rhs.y_ - lhs.x_ * rhs.z_ + lhs.y_ * rhs.w_ + lhs.z_ * rhs.x_,
+                lhs.w_ * rhs.z_ + lhs.x_ * rhs.y_ - lhs.y_ * rhs.x_ + lhs.z_ * rhs.w_,
+                lhs.w_ * rhs.w_ - lhs.x_ * rhs.x_ - lhs.y_ * rhs.y_ - lhs.z_ * rhs.z_);
+        }
+
+        inline Quat Normalize(Quat const &quat)
+        {
+            Simd::Float4 const value = Simd::Load(&quat.x_);
+            Quat result;
+            Simd::Store(&result.x_, Simd::Div(value,
+                Simd::Sqrt(Simd::Dot4(value, value))));
+            return result;
+        }
+
+        inline Vec3 Rotate(Quat const &quat, Vec3 const &vec)
+        {
+            // v' = v + 2w(q x v) + 2(q x (q x v))
+            Vec3 const q(quat.x_, quat.y_, quat.z_);
+            Vec3 const t = Cross(q, vec) * 2.0f;
+            return vec + t * quat.w_ + Cross(q, t);
+        }
+
+        inline Mat4 operator*(Mat4 const &lhs, Mat4 const &rhs)
+        {
+            // Every column of the result is a combination of the columns
+            // of lhs weighted by a column of rhs.
+            Simd::Float4 const c0 = lhs.Column(0), c1 = lhs.Column(1);
+            Simd::Float4 const c2 = lhs.Column(2), c3 = lhs.Column(3);
+            Mat4 result;
+            for(unsigned column = 0; column < 4; ++column)
+            {
+                float const *weights = rhs.m_ + column * 4;
+                Simd::Float4 sum = Simd::Mul(c0, Simd::Splat(weights[0]));
+                sum = Simd::MulAdd(c1, Simd::Splat(weights[1]), sum);
+                sum = Simd::MulAdd(c2, Simd::Splat(weights[2]), sum);
+                sum = Simd::MulAdd(c3, Simd::Splat(weights[3]), sum);
+                Simd::Store(result.m_ + column * 4, sum);
+            }
+            return result;
+        }
+
+        inline Vec4 operator*(Mat4 const &mat, Vec4 const &vec)
+        {
+            Simd::Float4 sum = Simd::Mul(mat.Column(0), Simd::Splat(vec.x_));
+            sum = Simd::MulAdd(mat.Column(1), Simd::Splat(vec.y_), sum);
+            sum = Simd::MulAdd(mat.Column(2), Simd::Splat(vec.z_), sum);
+            sum = Simd::MulAdd(mat.Column(3), Simd::Splat(vec.w_), sum);
+            return Vec4::Store(sum);
+        }
+
+        inline Vec3 TransformPoint(Mat4 const &mat, Vec3 const &point)
+        {
+            Vec4 const result = mat * Vec4(point, 1.0f);
+            return Vec3(result.x_, result.y_, result.z_);
+        }
+
+        inline bool NearlyEqual(Mat4 const &lhs, Mat4 const &rhs, float epsilon)
+        {
+            for(unsigned i = 0; i < 16; ++i)
+            {
+                if(std::fabs(lhs.m_[i] - rhs.m_[i]) > epsilon)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,168 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Simd.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Wraps the four wide float registers of the platform behind a single set
+ * of functions:
+ * - SSE on x86.
+ * - NEON on ARM.
+ * - Plain arrays everywhere else, or when LUDUS_NO_SIMD is defined.
+ * The math types and the batch kernels are written against these
+ * functions only.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Simd_MODULE_H
+#define Simd_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#if !defined(LUDUS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #define LUDUS_SIMD_SSE 1
+    #include <xmmintrin.h>
+    #include <emmintrin.h>
+#elif !defined(LUDUS_NO_SIMD) && defined(__ARM_NEON)
+    #define LUDUS_SIMD_NEON 1
+    #include <arm_neon.h>
+#else
+    #define LUDUS_SIMD_SCALAR 1
+#endif
+
+namespace Ludus
+{
+    namespace Math
+    {
+        /* ================================================================= */
+        /**
+         * Defines the namespace of the thin wrappers around the vector
+         * registers.
+        **/
+        /* ================================================================= */
+        namespace Simd
+        {
+#if defined(LUDUS_SIMD_SSE)
+            /** Four floats held in a single register. */
+            using Float4 = __m128;
+#elif defined(LUDUS_SIMD_NEON)
+            /** Four floats held in a single register. */
+            using Float4 = float32x4_t;
+#else
+            /** Four floats emulating a register. */
+            struct Float4
+            {
+                /** The lanes of the register. */
+                float v_[4];
+            };
+#endif
+            /** The number of floats in a register. */
+            constexpr unsigned Width = 4;
+
+            /* ============================================================= */
+            /**
+             * Loads four floats from a 16 byte aligned address.
+             * @param data          The address to load from.
+             * @returns             The register holding the floats.
+            **/
+            /* ============================================================= */
+            Float4 Load(float const *data);
+            /* ============================================================= */
+            /**
+             * Loads four floats from any address.
+             * @param data          The address to load from.
+             * @returns             The register holding the floats.
+            **/
+            /* ============================================================= */
+            Float4 LoadUnaligned(float const *data);
+            /* ============================================================= */
+            /**
+             * Stores four floats to a 16 byte aligned address.
+             * @param data          The address to store to.
+             * @param value         The register to store.
+            **/
+            /* ============================================================= */
+            void Store(float *data, Float4 value);
+            /* ============================================================= */
+            /**
+             * Stores four floats to any address.
+             * @param data          The address to store to.
+             * @param value         The register to store.
+            **/
+            /* ============================================================= */
+            void StoreUnaligned(float *data, Float4 value);
+            /* ============================================================= */
+            /**
+             * Copies a single float to all four lanes.
+             * @param value         The value to copy.
+             * @returns             The register with every lane set.
+            **/
+            /* ============================================================= */
+            Float4 Splat(float value);
+            /* ============================================================= */
+            /**
+             * Creates a register from four floats.
+             * @returns             The register holding x, y, z, w.
+            **/
+            /* ============================================================= */
+            Float4 Set(float x, float y, float z, float w);
+            /* ============================================================= */
+            /**
+             * Gets the first lane of a register.
+             * @param value         The register.
+             * @returns             The value of the first lane.
+            **/
+            /* ============================================================= */
+            float GetX(Float4 value);
+
+            Float4 Add(Float4 lhs, Float4 rhs);
+            Float4 Sub(Float4 lhs, Float4 rhs);
+            Float4 Mul(Float4 lhs, Float4 rhs);
+            Float4 Div(Float4 lhs, Float4 rhs);
+            Float4 Sqrt(Float4 value);
+            Float4 Min(Float4 lhs, Float4 rhs);
+            Float4 Max(Float4 lhs, Float4 rhs);
+            /* ============================================================= */
+            /**
+             * Rounds every lane down, for lanes within the range of an int.
+             * @param value         The register.
+             * @returns             The largest integers not above the lanes.
+            **/
+            /* ============================================================= */
+            Float4 Floor(Float4 value);
+            /* ============================================================= */
+            /**
+             * Gathers the sign bit of every lane.
+             * @param value         The register.
+             * @returns             A mask with bit i set if lane i is
+             *                      negative.
+            **/
+            /* ============================================================= */
+            int SignMask(Float4 value);
+            /* ============================================================= */
+            /**
+             * Multiplies two registers and adds a third one.
+             * @returns             lhs * rhs + add for every lane.
+            **/
+            /* ============================================================= */
+            Float4 MulAdd(Float4 lhs, Float4 rhs, Float4 add);
+            /* ============================================================= */
+            /**
+             * Computes the dot product of all four lanes.
+             * @returns             The dot product copied to every lane.
+            **/
+            /* ============================================================= */
+            Float4 Dot4(Float4 lhs, Float4 rhs);
+        }
+    }
+}
+
+#include "Simd.inl"
+/* ========================================================================= */
+#endif // Simd_MODULE_H
+/* ========================================================================= */
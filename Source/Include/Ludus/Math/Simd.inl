@@ -0,0 +1,207 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Simd.inl
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Defines the register wrappers for every supported instruction set.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <cmath>
+
+namespace Ludus
+{
+    namespace Math
+    {
+        namespace Simd
+        {
+#if defined(LUDUS_SIMD_SSE)
+            inline Float4 Load(float const *data) { return _mm_load_ps(data); }
+            inline Float4 LoadUnaligned(float const *data) { return _mm_loadu_ps(data); }
+            inline void Store(float *data, Float4 value) { _mm_store_ps(data, value); }
+            inline void StoreUnaligned(float *data, Float4 value) { _mm_storeu_ps(data, value); }
+            inline Float4 Splat(float value) { return _mm_set1_ps(value); }
+            inline Float4 Set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+            inline float GetX(Float4 value) { return _mm_cvtss_f32(value); }
+            inline Float4 Add(Float4 lhs, Float4 rhs) { return _mm_add_ps(lhs, rhs); }
+            inline Float4 Sub(Float4 lhs, Float4 rhs) { return _mm_sub_ps(lhs, rhs); }
+            inline Float4 Mul(Float4 lhs, Float4 rhs) { return _mm_mul_ps(lhs, rhs); }
+            inline Float4 Div(Float4 lhs, Float4 rhs) { return _mm_div_ps(lhs, rhs); }
+            inline Float4 Sqrt(Float4 value) { return _mm_sqrt_ps(value); }
+            inline Float4 Min(Float4 lhs, Float4 rhs) { return _mm_min_ps(lhs, rhs); }
+            inline Float4 Max(Float4 lhs, Float4 rhs) { return _mm_max_ps(lhs, rhs); }
+            inline Float4 Floor(Float4 value)
+            {
+                // Truncating rounds negative lanes up, those take one off.
+                Float4 const truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+                return _mm_sub_ps(truncated,
+                    _mm_and_ps(_mm_cmpgt_ps(truncated, value), _mm_set1_ps(1.0f)));
+            }
+            inline int SignMask(Float4 value) { return _mm_movemask_ps(value); }
+            inline Float4 MulAdd(Float4 lhs, Float4 rhs, Float4 add)
+            {
+                return _mm_add_ps(_mm_mul_ps(lhs, rhs), add);
+            }
+            inline Float4 Dot4(Float4 lhs, Float4 rhs)
+            {
+                // Two rounds of swapping halves and adding.
+                Float4 const product = _mm_mul_ps(lhs, rhs);
+                Float4 const pairs = _mm_add_ps(product,
+                    _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm_add_ps(pairs,
+                    _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+            }
+#elif defined(LUDUS_SIMD_NEON)
+            inline Float4 Load(float const *data) { return vld1q_f32(data); }
+            inline Float4 LoadUnaligned(float const *data) { return vld1q_f32(data); }
+            inline void Store(float *data, Float4 value) { vst1q_f32(data, value); }
+            inline void StoreUnaligned(float *data, Float4 value) { vst1q_f32(data, value); }
+            inline Float4 Splat(float value) { return vdupq_n_f32(value); }
+            inline Float4 Set(float x, float y, float z, float w)
+            {
+                float const values[4] = { x, y, z, w };
+                return vld1q_f32(values);
+            }
+            inline float GetX(Float4 value) { return vgetq_lane_f32(value, 0); }
+            inline Float4 Add(Float4 lhs, Float4 rhs) { return vaddq_f32(lhs, rhs); }
+            inline Float4 Sub(Float4 lhs, Float4 rhs) { return vsubq_f32(lhs, rhs); }
+            inline Float4 Mul(Float4 lhs, Float4 rhs) { return vmulq_f32(lhs, rhs); }
+            inline Float4 Min(Float4 lhs, Float4 rhs) { return vminq_f32(lhs, rhs); }
+            inline Float4 Max(Float4 lhs, Float4 rhs) { return vmaxq_f32(lhs, rhs); }
+            inline Float4 Floor(Float4 value)
+            {
+                Float4 const truncated = vcvtq_f32_s32(vcvtq_s32_f32(value));
+                return vsubq_f32(truncated, vreinterpretq_f32_u32(vandq_u32(
+                    vcgtq_f32(truncated, value), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+            }
+            inline int SignMask(Float4 value)
+            {
+                uint32x4_t const signs = vshrq_n_u32(vreinterpretq_u32_f32(value), 31);
+                return static_cast<int>(vgetq_lane_u32(signs, 0) |
+                    (vgetq_lane_u32(signs, 1) << 1) |
+                    (vgetq_lane_u32(signs, 2) << 2) |
+                    (vgetq_lane_u32(signs, 3) << 3));
+            }
+    #if defined(__aarch64__)
+            inline Float4 Div(Float4 lhs, Float4 rhs) { return vdivq_f32(lhs, rhs); }
+            inline Float4 Sqrt(Float4 value) { return vsqrtq_f32(value); }
+    #else
+            inline Float4 Div(Float4 lhs, Float4 rhs)
+            {
+                // Refine the estimate twice with Newton-Raphson steps.
+                Float4 inverse = vrecpeq_f32(rhs);
+                inverse = vmulq_f32(vrecpsq_f32(rhs, inverse), inverse);
+                inverse = vmulq_f32(vrecpsq_f32(rhs, inverse), inverse);
+                return vmulq_f32(lhs, inverse);
+            }
+            inline Float4 Sqrt(Float4 value)
+            {
+                float lanes[4];
+                vst1q_f32(lanes, value);
+                for(float &lane : lanes)
+                {
+                    lane = std::sqrt(lane);
+                }
+                return vld1q_f32(lanes);
+            }
+    #endif
+            inline Float4 MulAdd(Float4 lhs, Float4 rhs, Float4 add)
+            {
+                return vmlaq_f32(add, lhs, rhs);
+            }
+            inline Float4 Dot4(Float4 lhs, Float4 rhs)
+            {
+                Float4 const product = vmulq_f32(lhs, rhs);
+                float32x2_t const pairs = vadd_f32(vget_low_f32(product),
+                    vget_high_f32(product));
+                float32x2_t const sum = vpadd_f32(pairs, pairs);
+                return vcombine_f32(sum, sum);
+            }
+#else
+            inline Float4 Load(float const *data)
+            {
+                return Float4{ { data[0], data[1], data[2], data[3] } };
+            }
+            inline Float4 LoadUnaligned(float const *data) { return Load(data); }
+            inline void Store(float *data, Float4 value)
+            {
+                for(unsigned i = 0; i < Width; ++i)
+                {
+                    data[i] = value.v_[i];
+                }
+            }
+            inline void StoreUnaligned(float *data, Float4 value) { Store(data, value); }
+            inline Float4 Splat(float value)
+            {
+                return Float4{ { value, value, value, value } };
+            }
+            inline Float4 Set(float x, float y, float z, float w)
+            {
+                return Float4{ { x, y, z, w } };
+            }
+            inline float GetX(Float4 value) { return value.v_[0]; }
+            inline Float4 Add(Float4 lhs, Float4 rhs)
+            {
+                return Float4{ { lhs.v_[0] + rhs.v_[0], lhs.v_[1] + rhs.v_[1],
+                                 lhs.v_[2] + rhs.v_[2], lhs.v_[3] + rhs.v_[3] } };
+            }
+            inline Float4 Sub(Float4 lhs, Float4 rhs)
+            {
+                return Float4{ { lhs.v_[0] - rhs.v_[0], lhs.v_[1] - rhs.v_[1],
+                                 lhs.v_[2] - rhs.v_[2], lhs.v_[3] - rhs.v_[3] } };
+            }
+            inline Float4 Mul(Float4 lhs, Float4 rhs)
+            {
+                return Float4{ { lhs.v_[0] * rhs.v_[0], lhs.v_[1] * rhs.v_[1],
+                                 lhs.v_[2] * rhs.v_[2], lhs.v_[3] * rhs.v_[3] } };
+            }
+            inline Float4 Div(Float4 lhs, Float4 rhs)
+            {
+                return Float4{ { lhs.v_[0] / rhs.v_[0], lhs.v_[1] / rhs.v_[1],
+                                 lhs.v_[2] / rhs.v_[2], lhs.v_[3] / rhs.v_[3] } };
+            }
+            inline Float4 Sqrt(Float4 value)
+            {
+                return Float4{ { std::sqrt(value.v_[0]), std::sqrt(value.v_[1]),
+                                 std::sqrt(value.v_[2]), std::sqrt(value.v_[3]) } };
+            }
+            inline Float4 Min(Float4 lhs, Float4 rhs)
+            {
+                return Float4{ { std::fmin(lhs.v_[0], rhs.v_[0]), std::fmin(lhs.v_[1], rhs.v_[1]),
+                                 std::fmin(lhs.v_[2], rhs.v_[2]), std::fmin(lhs.v_[3], rhs.v_[3]) } };
+            }
+            inline Float4 Max(Float4 lhs, Float4 rhs)
+            {
+                return Float4{ { std::fmax(lhs.v_[0], rhs.v_[0]), std::fmax(lhs.v_[1], rhs.v_[1]),
+                                 std::fmax(lhs.v_[2], rhs.v_[2]), std::fmax(lhs.v_[3], rhs.v_[3]) } };
+            }
+            inline Float4 Floor(Float4 value)
+            {
+                return Float4{ { std::floor(value.v_[0]), std::floor(value.v_[1]),
+                                 std::floor(value.v_[2]), std::floor(value.v_[3]) } };
+            }
+            inline int SignMask(Float4 value)
+            {
+                return (std::signbit(value.v_[0]) ? 1 : 0) | (std::signbit(value.v_[1]) ? 2 : 0) |
+                    (std::signbit(value.v_[2]) ? 4 : 0) | (std::signbit(value.v_[3]) ? 8 : 0);
+            }
+            inline Float4 MulAdd(Float4 lhs, Float4 rhs, Float4 add)
+            {
+                return Add(Mul(lhs, rhs), add);
+            }
+            inline Float4 Dot4(Float4 lhs, Float4 rhs)
+            {
+                Float4 const product = Mul(lhs, rhs);
+                return Splat(product.v_[0] + product.v_[1] +
+                    product.v_[2] + product.v_[3]);
+            }
+#endif
+        }
+    }
+}
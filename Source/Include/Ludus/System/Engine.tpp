@@ -16,17 +16,31 @@
 /* ========================================================================= */
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 
 namespace Ludus
 {
     template <class T>
     void Engine::AddOn()
     {
+        static_assert(std::is_base_of<Node, T>::value,
+            "Systems added to the engine must derive from Node.");
+        AddChild(std::make_shared<T>());
     }
 
     template <class T>
     T& Engine::Find() const noexcept(false)
     {
+        for(size_t i = 0; i < Size(); ++i)
+        {
+            // The systems are owned by the engine, not by its constness.
+            T *system = dynamic_cast<T *>(const_cast<Node *>(&At(
+                static_cast<unsigned>(i))));
+            if(system)
+            {
+                return *system;
+            }
+        }
         std::stringstream builder;
         builder << "Failed to find the system ";
         builder << typeid(T).name();
@@ -0,0 +1,334 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            EventBus.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Lets the systems of the engine talk without knowing each other.
+ * Any thread publishes events into the queue of their type without
+ * taking a lock: a publish is a single atomic exchange, into an entry
+ * recycled from earlier drains, so the allocator is only called while
+ * the pool of entries grows. The queues are
+ * drained on the main thread at two points of every frame, BeginFrame
+ * and PreDraw, and each handler gets all the events of its type queued
+ * since the last drain in a single call.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef EventBus_MODULE_H
+#define EventBus_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/System/Node.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Ludus
+{
+    /** The id given to an event type. */
+    using EventId = std::uint32_t;
+    /** The most event types a program can use. */
+    static constexpr EventId MaxEventTypes = 64;
+
+    /* ===================================================================== */
+    /**
+     * The queue and the handlers of one event type, whatever it is.
+    **/
+    /* ===================================================================== */
+    class EventChannelBase
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Frees the events never delivered.
+        **/
+        /* ================================================================= */
+        virtual ~EventChannelBase() = default;
+        /* ================================================================= */
+        /**
+         * Delivers the events queued so far to every handler.
+         * @returns                 The number of events delivered.
+        **/
+        /* ================================================================= */
+        virtual size_t Dispatch() = 0;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The queue and the handlers of one event type.
+     * The queue is an intrusive multiple producer, single consumer list:
+     * publishers swap themselves in as the newest event and link the
+     * previous one to it, the main thread walks from the oldest.
+     * Drained entries go back to a free list of the channel. A publisher
+     * whose thread has no entry left takes the whole list at once into a
+     * cache of its thread, which never races with another taker.
+     * @tparam E                    The type of the events.
+    **/
+    /* ===================================================================== */
+    template <typename E>
+    class EventChannel final : public EventChannelBase
+    {
+    public:
+        /** Receives a batch of events. */
+        using Handler = std::function<void(E const *events, size_t count)>;
+
+        /* ================================================================= */
+        /**
+         * Creates an empty channel.
+        **/
+        /* ================================================================= */
+        EventChannel();
+        /* ================================================================= */
+        /**
+         * Frees the events never delivered.
+        **/
+        /* ================================================================= */
+        ~EventChannel();
+
+        /* ================================================================= */
+        /**
+         * Queues an event. Safe from any thread.
+         * @param event             The event.
+        **/
+        /* ================================================================= */
+        void Publish(E &&event);
+        /* ================================================================= */
+        /**
+         * Adds a handler. Main thread only. Handlers added by a handler
+         * start with the next drain.
+         * @param handler           The handler.
+        **/
+        /* ================================================================= */
+        void Subscribe(Handler handler);
+        /* ================================================================= */
+        /**
+         * Delivers the events queued so far to every handler. Events
+         * published by the handlers wait for the next drain.
+         * @returns                 The number of events delivered.
+        **/
+        /* ================================================================= */
+        size_t Dispatch() override;
+        /* ================================================================= */
+        /**
+         * Gets the number of entries allocated, the most events that were
+         * ever queued or free at once.
+         * @returns                 The number of entries.
+        **/
+        /* ================================================================= */
+        size_t GetEntryCount() const;
+    private:
+        /** A link of the queue, or of a free list. */
+        struct Link
+        {
+            /** The next newer link, or the next free one. */
+            std::atomic<Link *> next_;
+        };
+        /** An event, queued or not. */
+        struct Entry : Link
+        {
+            /** The event, only there while queued. */
+            std::optional<E> event_;
+        };
+        /** The entries a thread took back, ready for its next publishes. */
+        struct Cache
+        {
+            /** The first free entry. */
+            Link *free_ = nullptr;
+
+            /* ============================================================= */
+            /**
+             * Frees the entries left once the thread exits.
+            **/
+            /* ============================================================= */
+            ~Cache();
+        };
+
+        /* ================================================================= */
+        /**
+         * Moves the handlers added while dispatching to the others.
+        **/
+        /* ================================================================= */
+        void AddPending();
+        /* ================================================================= */
+        /**
+         * Gets the cache of the calling thread, shared by every channel of
+         * the type.
+         * @returns                 The cache.
+        **/
+        /* ================================================================= */
+        static Cache &GetCache();
+        /* ================================================================= */
+        /**
+         * Takes a free entry, allocating one if there is none.
+         * @returns                 The entry.
+        **/
+        /* ================================================================= */
+        Entry *Acquire();
+        /* ================================================================= */
+        /**
+         * Frees a list of entries. Main thread only.
+         * @param first             The first entry.
+         * @param last              The last entry.
+        **/
+        /* ================================================================= */
+        void Recycle(Link *first, Link *last);
+        /* ================================================================= */
+        /**
+         * Deletes a list of free entries.
+         * @param first             The first entry, or null.
+        **/
+        /* ================================================================= */
+        static void Delete(Link *first);
+
+        /* ================================================================= */
+        /**
+         * Links an entry as the newest.
+         * @param link              The entry.
+        **/
+        /* ================================================================= */
+        void Push(Link *link);
+        /* ================================================================= */
+        /**
+         * Unlinks the oldest entry.
+         * @returns                 The entry, or null if there is none or
+         *                          the next one isn't fully linked yet.
+        **/
+        /* ================================================================= */
+        Entry *Pop();
+
+        /** The newest link, swapped by the publishers. */
+        std::atomic<Link *> head_;
+        /** The oldest link, only touched by the main thread. */
+        Link *tail_;
+        /** Keeps the queue from ever being empty. */
+        Link stub_;
+        /** The entries drained, pushed by the main thread alone. */
+        std::atomic<Link *> free_;
+        /** The number of entries allocated. */
+        std::atomic<size_t> entryCount_;
+        /** The batch delivered, kept to reuse its memory. */
+        std::vector<E> batch_;
+        /** The handlers. */
+        std::vector<Handler> handlers_;
+        /** The handlers added while dispatching, kept out of handlers_. */
+        std::vector<Handler> pending_;
+        /** Whether the handlers are being called. */
+        bool dispatching_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The engine system carrying the events between the other systems.
+    **/
+    /* ===================================================================== */
+    class EventBus final : public Node
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a bus with no events.
+        **/
+        /* ================================================================= */
+        EventBus();
+        /* ================================================================= */
+        /**
+         * Frees the events never delivered.
+        **/
+        /* ================================================================= */
+        ~EventBus();
+        EventBus(EventBus const &) = delete;
+        EventBus &operator=(EventBus const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Queues an event for the next drain. Safe from any thread,
+         * never takes a lock.
+         * @tparam E                The type of the event.
+         * @param event             The event.
+         * @throw std::length_error If more than MaxEventTypes types are
+         *                          used.
+        **/
+        /* ================================================================= */
+        template <typename E>
+        void Publish(E event) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Adds a handler for an event type. Main thread only.
+         * @tparam E                The type of the events.
+         * @param handler           Receives every batch of events.
+         * @throw std::length_error If more than MaxEventTypes types are
+         *                          used.
+        **/
+        /* ================================================================= */
+        template <typename E>
+        void Subscribe(typename EventChannel<E>::Handler handler) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Delivers every event queued so far, one type after the other.
+         * Main thread only.
+         * @returns                 The number of events delivered.
+        **/
+        /* ================================================================= */
+        size_t Dispatch();
+        /* ================================================================= */
+        /**
+         * Delivers what other threads and the last frame published.
+        **/
+        /* ================================================================= */
+        void BeginFrame() override;
+        /* ================================================================= */
+        /**
+         * Delivers what the updates of this frame published.
+        **/
+        /* ================================================================= */
+        void PreDraw() override;
+
+        /* ================================================================= */
+        /**
+         * Gets the id of an event type, registering it on first use.
+         * @tparam E                The type of the events.
+         * @returns                 The id of the type.
+         * @throw std::length_error If more than MaxEventTypes types are
+         *                          used.
+        **/
+        /* ================================================================= */
+        template <typename E>
+        static EventId GetEventId() noexcept(false);
+    private:
+        /* ================================================================= */
+        /**
+         * Gives a new id to an event type.
+         * @returns                 The new id.
+         * @throw std::length_error If every id is taken.
+        **/
+        /* ================================================================= */
+        static EventId Register() noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the channel of an event type, creating it on first use.
+         * @tparam E                The type of the events.
+         * @returns                 The channel.
+        **/
+        /* ================================================================= */
+        template <typename E>
+        EventChannel<E> &GetChannel();
+
+        /** The channel of every event type used, by id. */
+        std::array<std::atomic<EventChannelBase *>, MaxEventTypes> channels_;
+    };
+}
+
+#include "EventBus.tpp"
+/* ========================================================================= */
+#endif // EventBus_MODULE_H
+/* ========================================================================= */
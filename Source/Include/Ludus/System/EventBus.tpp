@@ -0,0 +1,259 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            EventBus.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Implements the typed side of the event bus.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <type_traits>
+#include <utility>
+
+namespace Ludus
+{
+    template <typename E>
+    EventChannel<E>::Cache::~Cache()
+    {
+        Delete(free_);
+    }
+
+    template <typename E>
+    EventChannel<E>::EventChannel() :
+        head_(&stub_), tail_(&stub_), free_(nullptr), entryCount_(0), batch_(),
+        handlers_(), pending_(), dispatching_(false)
+    {
+        stub_.next_.store(nullptr, std::memory_order_relaxed);
+    }
+
+    template <typename E>
+    EventChannel<E>::~EventChannel()
+    {
+        while(Entry *entry = Pop())
+        {
+            delete entry;
+        }
+        Delete(free_.load(std::memory_order_acquire));
+    }
+
+    template <typename E>
+    void EventChannel<E>::Publish(E &&event)
+    {
+        Entry *const entry = Acquire();
+        entry->event_.emplace(std::move(event));
+        Push(entry);
+    }
+
+    template <typename E>
+    void EventChannel<E>::Subscribe(Handler handler)
+    {
+        // Growing handlers_ now would move the handler that is running.
+        (dispatching_ ? pending_ : handlers_).push_back(std::move(handler));
+    }
+
+    template <typename E>
+    size_t EventChannel<E>::Dispatch()
+    {
+        // Gather the whole batch first, so what the handlers publish
+        // waits for the next drain.
+        batch_.clear();
+        Link *first = nullptr;
+        Link *last = nullptr;
+        while(Entry *entry = Pop())
+        {
+            batch_.push_back(std::move(*entry->event_));
+            entry->event_.reset();
+            entry->next_.store(first, std::memory_order_relaxed);
+            last = first ? last : entry;
+            first = entry;
+        }
+        if(first)
+        {
+            Recycle(first, last);
+        }
+        if(batch_.empty())
+        {
+            return 0;
+        }
+        // Handlers may subscribe more handlers, those start next drain.
+        dispatching_ = true;
+        try
+        {
+            for(Handler &handler : handlers_)
+            {
+                handler(batch_.data(), batch_.size());
+            }
+        }
+        catch(...)
+        {
+            AddPending();
+            throw;
+        }
+        AddPending();
+        return batch_.size();
+    }
+
+    template <typename E>
+    void EventChannel<E>::AddPending()
+    {
+        dispatching_ = false;
+        for(Handler &handler : pending_)
+        {
+            handlers_.push_back(std::move(handler));
+        }
+        pending_.clear();
+    }
+
+    template <typename E>
+    size_t EventChannel<E>::GetEntryCount() const
+    {
+        return entryCount_.load(std::memory_order_relaxed);
+    }
+
+    template <typename E>
+    typename EventChannel<E>::Cache &EventChannel<E>::GetCache()
+    {
+        static thread_local Cache cache;
+        return cache;
+    }
+
+    template <typename E>
+    typename EventChannel<E>::Entry *EventChannel<E>::Acquire()
+    {
+        Cache &cache = GetCache();
+        if(!cache.free_ && free_.load(std::memory_order_relaxed))
+        {
+            // Taking the whole list can't be fooled by an entry that left
+            // and came back, the way popping a single one could.
+            cache.free_ = free_.exchange(nullptr, std::memory_order_acquire);
+        }
+        if(!cache.free_)
+        {
+            entryCount_.fetch_add(1, std::memory_order_relaxed);
+            return new Entry();
+        }
+        Entry *const entry = static_cast<Entry *>(cache.free_);
+        cache.free_ = entry->next_.load(std::memory_order_relaxed);
+        return entry;
+    }
+
+    template <typename E>
+    void EventChannel<E>::Recycle(Link *first, Link *last)
+    {
+        // Publishers only ever empty the list, so nothing else pushes.
+        Link *head = free_.load(std::memory_order_relaxed);
+        do
+        {
+            last->next_.store(head, std::memory_order_relaxed);
+        }
+        while(!free_.compare_exchange_weak(head, first, std::memory_order_release,
+            std::memory_order_relaxed));
+    }
+
+    template <typename E>
+    void EventChannel<E>::Delete(Link *first)
+    {
+        while(first)
+        {
+            Link *const next = first->next_.load(std::memory_order_relaxed);
+            delete static_cast<Entry *>(first);
+            first = next;
+        }
+    }
+
+    template <typename E>
+    void EventChannel<E>::Push(Link *link)
+    {
+        link->next_.store(nullptr, std::memory_order_relaxed);
+        Link *const previous = head_.exchange(link, std::memory_order_acq_rel);
+        // Until this store the main thread sees the queue end at previous.
+        previous->next_.store(link, std::memory_order_release);
+    }
+
+    template <typename E>
+    typename EventChannel<E>::Entry *EventChannel<E>::Pop()
+    {
+        Link *tail = tail_;
+        Link *next = tail->next_.load(std::memory_order_acquire);
+        if(tail == &stub_)
+        {
+            if(!next)
+            {
+                return nullptr;
+            }
+            tail_ = next;
+            tail = next;
+            next = next->next_.load(std::memory_order_acquire);
+        }
+        if(next)
+        {
+            tail_ = next;
+            return static_cast<Entry *>(tail);
+        }
+        // A publisher swapped in a newer link but hasn't linked it yet,
+        // it gets picked up next drain.
+        if(tail != head_.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        // The last entry can only leave once something follows it.
+        Push(&stub_);
+        next = tail->next_.load(std::memory_order_acquire);
+        if(next)
+        {
+            tail_ = next;
+            return static_cast<Entry *>(tail);
+        }
+        return nullptr;
+    }
+
+    template <typename E>
+    void EventBus::Publish(E event)
+    {
+        GetChannel<E>().Publish(std::move(event));
+    }
+
+    template <typename E>
+    void EventBus::Subscribe(typename EventChannel<E>::Handler handler)
+    {
+        GetChannel<E>().Subscribe(std::move(handler));
+    }
+
+    template <typename E>
+    EventId EventBus::GetEventId()
+    {
+        static_assert(std::is_same<E, std::decay_t<E> >::value,
+            "Events are registered by their plain type.");
+        // Registered once per type, the first time any thread asks.
+        static EventId const id = Register();
+        return id;
+    }
+
+    template <typename E>
+    EventChannel<E> &EventBus::GetChannel()
+    {
+        std::atomic<EventChannelBase *> &slot = channels_[GetEventId<E>()];
+        EventChannelBase *channel = slot.load(std::memory_order_acquire);
+        if(!channel)
+        {
+            // Two threads may race to create it, only one channel stays.
+            EventChannelBase *const created = new EventChannel<E>();
+            if(slot.compare_exchange_strong(channel, created, std::memory_order_acq_rel,
+                std::memory_order_acquire))
+            {
+                channel = created;
+            }
+            else
+            {
+                delete created;
+            }
+        }
+        return static_cast<EventChannel<E> &>(*channel);
+    }
+}
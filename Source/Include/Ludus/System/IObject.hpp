@@ -10,6 +10,7 @@
  * Provides the following functions:
  * - dtor
  * - Initialize
+ * - BeginFrame
  * - Update
  * - FixedUpdate
  * - PreDraw
@@ -55,6 +56,14 @@ namespace Ludus
         /* ================================================================= */
         virtual void Initialize();
         /* ================================================================= */
+        /**
+         * Runs on the main thread at the start of every frame, before
+         * any update. Work finished on other threads is handed back to
+         * the game here.
+         **/
+        /* ================================================================= */
+        virtual void BeginFrame();
+        /* ================================================================= */
         /**
          * Updates the object with a variadic delta time.
          * @param dt            The amount of time the last frame took.
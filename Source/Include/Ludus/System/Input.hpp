@@ -0,0 +1,415 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Input.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Collects the input of the keyboard, the mouse and the gamepads.
+ * Whatever reads the devices pushes timestamped events into a ring of
+ * fixed size, from any thread and without a lock. At the start of every
+ * frame the ring is drained into a snapshot of what is held down for
+ * Update, and the events are kept so every fixed step gets exactly the
+ * ones that happened during the time it stands for. Sources polled at
+ * the start of the frame can script input, to measure latency without
+ * a window.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Input_MODULE_H
+#define Input_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/System/Node.hpp"
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Ludus
+{
+    class Input;
+
+    /* ===================================================================== */
+    /**
+     * The kind of device an event comes from.
+    **/
+    /* ===================================================================== */
+    enum class InputDevice : std::uint8_t
+    {
+        KEYBOARD = 0x00,  /* Codes are USB HID keyboard usages. */
+        MOUSE    = 0x01,  /* Codes are buttons, moves give the position. */
+        GAMEPAD  = 0x02,  /* Codes are buttons, or axes when moved. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * What happened to the key, button or axis.
+    **/
+    /* ===================================================================== */
+    enum class InputAction : std::uint8_t
+    {
+        PRESS   = 0x00,  /* Went down. */
+        RELEASE = 0x01,  /* Went up. */
+        MOVE    = 0x02,  /* An axis or the pointer moved. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * One change of one device.
+    **/
+    /* ===================================================================== */
+    struct InputEvent
+    {
+        /** When it happened, on the clock of Input::Now. */
+        std::int64_t time_;
+        /** The kind of device. */
+        InputDevice device_;
+        /** What happened. */
+        InputAction action_;
+        /** The gamepad, zero for the others. */
+        std::uint8_t player_;
+        /** The key, button or axis. */
+        std::uint16_t code_;
+        /** The value of an axis, or where the pointer is. */
+        float x_;
+        float y_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * What every device holds at some point in time.
+    **/
+    /* ===================================================================== */
+    class InputState
+    {
+    public:
+        /** The keys tracked. */
+        static constexpr unsigned KeyCount = 512;
+        /** The mouse buttons tracked. */
+        static constexpr unsigned MouseButtonCount = 8;
+        /** The gamepads tracked. */
+        static constexpr unsigned PlayerCount = 4;
+        /** The buttons tracked per gamepad. */
+        static constexpr unsigned GamepadButtonCount = 32;
+        /** The axes tracked per gamepad. */
+        static constexpr unsigned GamepadAxisCount = 8;
+
+        /* ================================================================= */
+        /**
+         * Creates a state with nothing held.
+        **/
+        /* ================================================================= */
+        InputState();
+
+        /* ================================================================= */
+        /**
+         * Applies an event. Codes out of range are ignored.
+         * @param event             The event.
+        **/
+        /* ================================================================= */
+        void Apply(InputEvent const &event);
+        /* ================================================================= */
+        /**
+         * Gets whether a key or button is held.
+         * @param device            The kind of device.
+         * @param code              The key or button.
+         * @param player            The gamepad.
+         * @returns                 True if it's held.
+        **/
+        /* ================================================================= */
+        bool IsDown(InputDevice device, std::uint16_t code, std::uint8_t player = 0) const;
+        /* ================================================================= */
+        /**
+         * Gets the value of a gamepad axis.
+         * @param axis              The axis.
+         * @param player            The gamepad.
+         * @returns                 The value, zero if out of range.
+        **/
+        /* ================================================================= */
+        float GetAxis(std::uint16_t axis, std::uint8_t player = 0) const;
+        /* ================================================================= */
+        /**
+         * Gets where the pointer is.
+         * @returns                 The position of the pointer.
+        **/
+        /* ================================================================= */
+        float GetPointerX() const;
+        float GetPointerY() const;
+    private:
+        /** The keys held. */
+        std::bitset<KeyCount> keys_;
+        /** The mouse buttons held. */
+        std::bitset<MouseButtonCount> mouseButtons_;
+        /** The buttons held on every gamepad. */
+        std::bitset<GamepadButtonCount> gamepadButtons_[PlayerCount];
+        /** The axes of every gamepad. */
+        float axes_[PlayerCount][GamepadAxisCount];
+        /** Where the pointer is. */
+        float pointerX_;
+        float pointerY_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Something polled for input at the start of every frame.
+    **/
+    /* ===================================================================== */
+    class InputSource
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Defines a virtual destructor so sources can be cleaned up.
+        **/
+        /* ================================================================= */
+        virtual ~InputSource() = default;
+        /* ================================================================= */
+        /**
+         * Pushes the events that happened since the last poll.
+         * @param input             The input system to push them to.
+         * @param now               The time of the frame starting.
+        **/
+        /* ================================================================= */
+        virtual void Poll(Input &input, std::int64_t now) = 0;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Plays back a script of events at the times it gives them.
+    **/
+    /* ===================================================================== */
+    class ScriptedInput final : public InputSource
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a source playing a script.
+         * @param script            The events, their times in nanoseconds
+         *                          after the first poll, in order.
+        **/
+        /* ================================================================= */
+        explicit ScriptedInput(std::vector<InputEvent> script);
+        /* ================================================================= */
+        /**
+         * Pushes the events due, stamped with when the script puts them.
+         * @param input             The input system to push them to.
+         * @param now               The time of the frame starting.
+        **/
+        /* ================================================================= */
+        void Poll(Input &input, std::int64_t now) override;
+        /* ================================================================= */
+        /**
+         * Gets whether the whole script was played.
+         * @returns                 True once every event was pushed.
+        **/
+        /* ================================================================= */
+        bool IsDone() const;
+    private:
+        /** The events, timed from the first poll. */
+        std::vector<InputEvent> script_;
+        /** The next event to push. */
+        size_t next_;
+        /** The time of the first poll, negative before. */
+        std::int64_t start_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The engine system collecting the input.
+    **/
+    /* ===================================================================== */
+    class Input final : public Node
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates an input system queuing up to 4096 events between frames.
+        **/
+        /* ================================================================= */
+        Input();
+        /* ================================================================= */
+        /**
+         * Creates an input system.
+         * @param capacity          The events queued between frames,
+         *                          rounded up to a power of two.
+        **/
+        /* ================================================================= */
+        explicit Input(size_t capacity);
+        Input(Input const &) = delete;
+        Input &operator=(Input const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Queues an event. Safe from any thread, never blocks.
+         * @param event             The event, with the time it happened.
+         * @returns                 False if the ring was full and the event
+         *                          dropped.
+        **/
+        /* ================================================================= */
+        bool Push(InputEvent const &event);
+        /* ================================================================= */
+        /**
+         * Adds a source polled at the start of every frame.
+         * @param source            The source.
+        **/
+        /* ================================================================= */
+        void AddSource(std::unique_ptr<InputSource> source);
+
+        /* ================================================================= */
+        /**
+         * Polls the sources and takes the events queued so far.
+        **/
+        /* ================================================================= */
+        void BeginFrame() override;
+        /* ================================================================= */
+        /**
+         * Takes the events that happened during the next fixed step.
+         * @param fixedDt           The length of a fixed step.
+        **/
+        /* ================================================================= */
+        void FixedUpdate(double const &fixedDt) override;
+
+        /* ================================================================= */
+        /**
+         * Gets what was held at the start of the frame.
+         * @returns                 The state.
+        **/
+        /* ================================================================= */
+        InputState const &GetState() const;
+        /* ================================================================= */
+        /**
+         * Gets what was held at the start of the last frame.
+         * @returns                 The state.
+        **/
+        /* ================================================================= */
+        InputState const &GetPreviousState() const;
+        /* ================================================================= */
+        /**
+         * Gets the events taken at the start of the frame, in order.
+         * @returns                 The events.
+        **/
+        /* ================================================================= */
+        std::vector<InputEvent> const &GetFrameEvents() const;
+        /* ================================================================= */
+        /**
+         * Gets whether a key or button went down during the last frame,
+         * even if it went back up.
+         * @param device            The kind of device.
+         * @param code              The key or button.
+         * @param player            The gamepad.
+         * @returns                 True if it was pressed.
+        **/
+        /* ================================================================= */
+        bool WasPressed(InputDevice device, std::uint16_t code, std::uint8_t player = 0) const;
+        /* ================================================================= */
+        /**
+         * Gets whether a key or button went up during the last frame.
+         * @param device            The kind of device.
+         * @param code              The key or button.
+         * @param player            The gamepad.
+         * @returns                 True if it was released.
+        **/
+        /* ================================================================= */
+        bool WasReleased(InputDevice device, std::uint16_t code, std::uint8_t player = 0) const;
+        /* ================================================================= */
+        /**
+         * Gets what was held at the end of the current fixed step.
+         * @returns                 The state.
+        **/
+        /* ================================================================= */
+        InputState const &GetStepState() const;
+        /* ================================================================= */
+        /**
+         * Gets the events that happened during the current fixed step.
+         * @returns                 The events.
+        **/
+        /* ================================================================= */
+        std::vector<InputEvent> const &GetStepEvents() const;
+        /* ================================================================= */
+        /**
+         * Gets the time the current fixed step ends at.
+         * @returns                 The time, on the clock of Now.
+        **/
+        /* ================================================================= */
+        std::int64_t GetStepTime() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of events dropped because the ring was full.
+         * @returns                 The number of events dropped.
+        **/
+        /* ================================================================= */
+        size_t GetDroppedCount() const;
+
+        /* ================================================================= */
+        /**
+         * Gets the time of the clock the events are stamped with.
+         * @returns                 The time of the steady clock, in
+         *                          nanoseconds.
+        **/
+        /* ================================================================= */
+        static std::int64_t Now();
+    private:
+        /** A slot of the ring. */
+        struct Cell
+        {
+            /** Tells the writers and the reader whose turn it is. */
+            std::atomic<size_t> sequence_;
+            /** The event. */
+            InputEvent event_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Looks for an event of the frame on a key or button.
+         * @param device            The kind of device.
+         * @param code              The key or button.
+         * @param player            The gamepad.
+         * @param action            What happened.
+         * @returns                 True if there was one.
+        **/
+        /* ================================================================= */
+        bool Happened(InputDevice device, std::uint16_t code, std::uint8_t player,
+            InputAction action) const;
+
+        /** The ring of events. */
+        std::unique_ptr<Cell[]> cells_;
+        /** The slots of the ring, less one. */
+        size_t mask_;
+        /** The next slot written, shared by the writers. */
+        alignas(64) std::atomic<size_t> enqueue_;
+        /** The next slot read, by the main thread. */
+        alignas(64) size_t dequeue_;
+        /** The events dropped. */
+        std::atomic<size_t> dropped_;
+        /** The sources. */
+        std::vector<std::unique_ptr<InputSource> > sources_;
+        /** The state at the start of this frame and the last one. */
+        InputState current_;
+        InputState previous_;
+        /** The events of this frame. */
+        std::vector<InputEvent> frameEvents_;
+        /** The events not given to a fixed step yet. */
+        std::vector<InputEvent> pending_;
+        /** The events of the current fixed step. */
+        std::vector<InputEvent> stepEvents_;
+        /** The state at the end of the current fixed step. */
+        InputState stepState_;
+        /** The time the fixed steps got to. */
+        std::int64_t stepTime_;
+        /** The length of the last fixed step, in nanoseconds. */
+        std::int64_t stepLength_;
+        /** The time the last frame started, negative before the first. */
+        std::int64_t frameTime_;
+    };
+}
+
+/* ========================================================================= */
+#endif // Input_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,218 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            JobSystem.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides the worker threads of the engine.
+ * Work is handed to the workers as jobs, and a JobCounter keeps track of
+ * when a group of jobs has finished. Threads waiting on a counter help
+ * run queued jobs instead of sleeping. An exception thrown by a job is
+ * kept on its counter and thrown again by whoever waits on it.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef JobSystem_MODULE_H
+#define JobSystem_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/System/Node.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Keeps track of how many jobs of a group are still pending, and of the
+     * first one of them that failed.
+    **/
+    /* ===================================================================== */
+    class JobCounter
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a counter with no pending jobs.
+        **/
+        /* ================================================================= */
+        JobCounter();
+        /* ================================================================= */
+        /**
+         * Checks whether every job attached to the counter has finished.
+         * @returns             True if there is no job pending.
+        **/
+        /* ================================================================= */
+        bool IsDone() const;
+    private:
+        friend class JobSystem;
+        /** The number of jobs still pending. */
+        std::atomic<size_t> pending_;
+        /** Set by the first job to fail, which gets to write the error. */
+        std::atomic<bool> failed_;
+        /** The exception of the first job that failed. */
+        std::exception_ptr error_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The pool of worker threads used to run jobs.
+    **/
+    /* ===================================================================== */
+    class JobSystem final : public Node
+    {
+    public:
+        /** The signature of a job. */
+        using Job = std::function<void()>;
+        /** The signature of the body of a parallel loop over [begin, end). */
+        using RangeJob = std::function<void(size_t begin, size_t end)>;
+
+        /* ================================================================= */
+        /**
+         * Creates the job system with one worker less than the number of
+         * hardware threads, since the calling thread also runs jobs.
+        **/
+        /* ================================================================= */
+        JobSystem();
+        /* ================================================================= */
+        /**
+         * Creates the job system.
+         * @param workerCount       The number of worker threads to create.
+         *                          Zero runs every job on the thread
+         *                          waiting for it.
+        **/
+        /* ================================================================= */
+        explicit JobSystem(unsigned workerCount);
+        /* ================================================================= */
+        /**
+         * Finishes the queued jobs and joins all the workers.
+        **/
+        /* ================================================================= */
+        ~JobSystem();
+        /* ================================================================= */
+        /**
+         * Queues a job to be run by any worker.
+         * @param job               The job to run.
+         * @param counter           The counter tracking the job, or null
+         *                          if nobody waits on it.
+        **/
+        /* ================================================================= */
+        void Schedule(Job job, JobCounter *counter = nullptr);
+        /* ================================================================= */
+        /**
+         * Counts jobs that will only be scheduled later, with
+         * ScheduleExpected, so the counter can be waited on right away.
+         * Used when the jobs come out of another thread, like I/O.
+         * @param counter           The counter tracking the jobs.
+         * @param count             The number of jobs to expect.
+        **/
+        /* ================================================================= */
+        void Expect(JobCounter &counter, size_t count);
+        /* ================================================================= */
+        /**
+         * Queues a job already counted with Expect.
+         * @param job               The job to run.
+         * @param counter           The counter the job was expected on, or
+         *                          null if nobody waits on it.
+        **/
+        /* ================================================================= */
+        void ScheduleExpected(Job job, JobCounter *counter);
+        /* ================================================================= */
+        /**
+         * Runs queued jobs on the calling thread until the counter
+         * reaches zero.
+         * @param counter           The counter to wait on.
+         * @throw                   The exception of the first job of the
+         *                          counter that failed, once all are done.
+        **/
+        /* ================================================================= */
+        void Wait(JobCounter const &counter) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Splits the range [0, count) in pieces of at most grain elements
+         * and runs them across the workers, returning once all are done.
+         * @param count             The number of elements in the range.
+         * @param grain             The number of elements per job.
+         * @param job               The body of the loop.
+         * @throw                   The exception of the first piece that
+         *                          failed, once all pieces are done.
+        **/
+        /* ================================================================= */
+        void ParallelFor(size_t count, size_t grain, RangeJob const &job) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of worker threads.
+         * @returns                 The number of worker threads.
+        **/
+        /* ================================================================= */
+        unsigned GetWorkerCount() const;
+    private:
+        /* ================================================================= */
+        /** A job waiting in the queue. */
+        /* ================================================================= */
+        struct Entry
+        {
+            /** The function to run. */
+            Job job_;
+            /** The counter to decrement once the job finishes. */
+            JobCounter *counter_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Runs a single job from the queue if there is any.
+         * @returns                 True if a job was run.
+        **/
+        /* ================================================================= */
+        bool RunOne();
+        /* ================================================================= */
+        /**
+         * Runs the job and signals its counter. An exception thrown by the
+         * job goes to the counter, or is dropped if nobody waits on it.
+         * @param entry             The job to run.
+        **/
+        /* ================================================================= */
+        static void Execute(Entry &entry);
+        /* ================================================================= */
+        /**
+         * Keeps an exception on a counter, unless a job already failed.
+         * @param counter           The counter.
+         * @param error             The exception.
+        **/
+        /* ================================================================= */
+        static void Fail(JobCounter &counter, std::exception_ptr error);
+        /* ================================================================= */
+        /**
+         * The loop run by every worker thread.
+        **/
+        /* ================================================================= */
+        void WorkerLoop();
+
+        /** The worker threads. */
+        std::vector<std::thread> workers_;
+        /** The jobs waiting to be run. */
+        std::deque<Entry> queue_;
+        /** Guards the queue. */
+        std::mutex mutex_;
+        /** Wakes the workers when jobs get queued. */
+        std::condition_variable available_;
+        /** Set when the workers should exit. */
+        bool stopping_;
+    };
+}
+
+/* ========================================================================= */
+#endif // JobSystem_MODULE_H
+/* ========================================================================= */
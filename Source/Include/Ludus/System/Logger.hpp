@@ -0,0 +1,560 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Logger.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Logs from anywhere without slowing down the thread logging.
+ * Every thread writes into its own ring of bytes, which only a background
+ * thread reads, so logging never takes a lock. A message isn't formatted
+ * where it's logged: the ring gets the call site, which holds the format,
+ * and the raw arguments, and the background thread builds the text and
+ * hands it to the sinks. Levels below LUDUS_LOG_LEVEL are compiled out,
+ * the others can be filtered by level and category while running.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Logger_MODULE_H
+#define Logger_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+/* ========================================================================= */
+/**
+ * The lowest level compiled in, as the value of a LogLevel.
+ **/
+/* ========================================================================= */
+#ifndef LUDUS_LOG_LEVEL
+    #ifdef NDEBUG
+        #define LUDUS_LOG_LEVEL 0x02
+    #else
+        #define LUDUS_LOG_LEVEL 0x00
+    #endif
+#endif
+
+/* ========================================================================= */
+/**
+ * Logs a message to a logger. The arguments are only evaluated if the
+ * message passes the filters.
+ * @param logger            The logger.
+ * @param level             The name of the LogLevel.
+ * @param category          The name of the LogCategory.
+ * @param format            A string literal, with {} for every argument.
+ * @param ...               The arguments: numbers, pointers and strings.
+ **/
+/* ========================================================================= */
+#define LUDUS_LOG_TO(logger, level, category, format, ...) \
+    do \
+    { \
+        if constexpr(::Ludus::IsLogLevelCompiled(::Ludus::LogLevel::level, LUDUS_LOG_LEVEL)) \
+        { \
+            static_assert(::Ludus::CountPlaceholders(format) == std::tuple_size_v< \
+                decltype(std::forward_as_tuple(__VA_ARGS__))>, \
+                "The format needs one {} per argument."); \
+            static constexpr ::Ludus::LogSite logSite = { ::Ludus::LogLevel::level, \
+                ::Ludus::LogCategory::category, format, __FILE__, __LINE__ }; \
+            ::Ludus::Logger &logTarget = (logger); \
+            if(logTarget.IsEnabled(logSite.level_, logSite.category_)) \
+            { \
+                logTarget.Write(logSite __VA_OPT__(,) __VA_ARGS__); \
+            } \
+        } \
+    } \
+    while(false)
+
+/* ========================================================================= */
+/**
+ * Logs a message to the default logger.
+ * @param level             The name of the LogLevel.
+ * @param category          The name of the LogCategory.
+ * @param format            A string literal, with {} for every argument.
+ * @param ...               The arguments: numbers, pointers and strings.
+ **/
+/* ========================================================================= */
+#define LUDUS_LOG(level, category, format, ...) \
+    LUDUS_LOG_TO(::Ludus::Logger::GetDefault(), level, category, format __VA_OPT__(,) __VA_ARGS__)
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * How much a message matters.
+    **/
+    /* ===================================================================== */
+    enum class LogLevel : std::uint8_t
+    {
+        TRACE   = 0x00,  /* Step by step detail. */
+        DEBUG   = 0x01,  /* Useful while debugging. */
+        INFO    = 0x02,  /* Normal operation. */
+        WARNING = 0x03,  /* Something looks wrong, the engine goes on. */
+        ERROR   = 0x04,  /* Something failed. */
+        FATAL   = 0x05,  /* The engine can't go on. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * The part of the engine a message comes from.
+    **/
+    /* ===================================================================== */
+    enum class LogCategory : std::uint8_t
+    {
+        GENERAL  = 0x00,  /* Anything else. */
+        ENGINE   = 0x01,  /* The frame loop and its systems. */
+        ASSETS   = 0x02,  /* Loading assets. */
+        GRAPHICS = 0x03,  /* Rendering. */
+        ENTITY   = 0x04,  /* Entities and their components. */
+        INPUT    = 0x05,  /* Input devices. */
+        GAMEPLAY = 0x06,  /* The game itself. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * A place that logs, stored once per call site. Its address stands for
+     * the format in the rings.
+    **/
+    /* ===================================================================== */
+    struct LogSite
+    {
+        /** How much the message matters. */
+        LogLevel level_;
+        /** The part of the engine it comes from. */
+        LogCategory category_;
+        /** The format of the message. */
+        char const *format_;
+        /** The file logging. */
+        char const *file_;
+        /** The line logging. */
+        unsigned line_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * A formatted message, as the sinks get it.
+    **/
+    /* ===================================================================== */
+    struct LogRecord
+    {
+        /** The call site. */
+        LogSite const *site_;
+        /** The nanoseconds since the logger was created. */
+        std::int64_t time_;
+        /** The order the threads first logged in, starting at zero. */
+        unsigned thread_;
+        /** The message. */
+        std::string message_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Gets whether messages of a level are compiled in.
+     * @param level             The level.
+     * @param lowest            The lowest level compiled in, LUDUS_LOG_LEVEL.
+     * @returns                 True if the level is compiled in.
+    **/
+    /* ===================================================================== */
+    constexpr bool IsLogLevelCompiled(LogLevel level, int lowest)
+    {
+        return static_cast<int>(level) >= lowest;
+    }
+
+    /* ===================================================================== */
+    /**
+     * Counts the {} in a format.
+     * @param format            The format.
+     * @returns                 The number of arguments it takes.
+    **/
+    /* ===================================================================== */
+    constexpr size_t CountPlaceholders(char const *format)
+    {
+        size_t count = 0;
+        for(; *format; ++format)
+        {
+            if(format[0] == '{' && format[1] == '}')
+            {
+                ++count;
+                ++format;
+            }
+        }
+        return count;
+    }
+
+    /* ===================================================================== */
+    /**
+     * Stores an argument in the ring and formats it back.
+     * Numbers, enums and pointers are stored as they are.
+     * @tparam T                    The decayed type of the argument.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    struct LogArgument
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>,
+            "Only numbers, enums, pointers and strings can be logged.");
+
+        /* ================================================================= */
+        /**
+         * Gets the bytes an argument takes in the ring.
+         * @param value             The argument.
+         * @returns                 The size.
+        **/
+        /* ================================================================= */
+        static size_t GetSize(T const &value);
+        /* ================================================================= */
+        /**
+         * Stores an argument.
+         * @param bytes             Where to store it, moved past it.
+         * @param value             The argument.
+        **/
+        /* ================================================================= */
+        static void Encode(std::uint8_t *&bytes, T const &value);
+        /* ================================================================= */
+        /**
+         * Formats a stored argument.
+         * @param bytes             The argument, moved past it.
+         * @param message           The message to append it to.
+        **/
+        /* ================================================================= */
+        static void Append(std::uint8_t const *&bytes, std::string &message);
+    };
+
+    /* ===================================================================== */
+    /**
+     * Stores a string argument, copying the characters: what it points
+     * to may be gone when the message is formatted.
+    **/
+    /* ===================================================================== */
+    struct LogStringArgument
+    {
+        /** The same as for the other arguments, see LogArgument. */
+        static size_t GetSize(std::string_view value);
+        static void Encode(std::uint8_t *&bytes, std::string_view value);
+        static void Append(std::uint8_t const *&bytes, std::string &message);
+    };
+
+    template <>
+    struct LogArgument<char const *> : LogStringArgument
+    {
+    };
+
+    template <>
+    struct LogArgument<char *> : LogStringArgument
+    {
+    };
+
+    template <>
+    struct LogArgument<std::string> : LogStringArgument
+    {
+    };
+
+    template <>
+    struct LogArgument<std::string_view> : LogStringArgument
+    {
+    };
+
+    /* ===================================================================== */
+    /**
+     * Collects the messages of every thread and hands them to the sinks
+     * from a background thread.
+    **/
+    /* ===================================================================== */
+    class Logger
+    {
+    public:
+        /** Receives every message, on the background thread. */
+        using Sink = std::function<void(LogRecord const &record)>;
+
+        /* ================================================================= */
+        /**
+         * Creates a logger with no sinks and starts its thread.
+         * @param ringSize          The bytes of the ring of every thread,
+         *                          rounded up to a power of two.
+        **/
+        /* ================================================================= */
+        explicit Logger(size_t ringSize = 1 << 16);
+        /* ================================================================= */
+        /**
+         * Hands over what was logged and stops the thread.
+        **/
+        /* ================================================================= */
+        ~Logger();
+        Logger(Logger const &) = delete;
+        Logger &operator=(Logger const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Adds a sink.
+         * @param sink              The sink.
+        **/
+        /* ================================================================= */
+        void AddSink(Sink sink);
+        /* ================================================================= */
+        /**
+         * Sets the lowest level logged.
+         * @param level             The level.
+        **/
+        /* ================================================================= */
+        void SetLevel(LogLevel level);
+        /* ================================================================= */
+        /**
+         * Turns a category on or off.
+         * @param category          The category.
+         * @param enabled           Whether its messages are logged.
+        **/
+        /* ================================================================= */
+        void SetCategoryEnabled(LogCategory category, bool enabled);
+        /* ================================================================= */
+        /**
+         * Gets whether messages pass the filters.
+         * @param level             The level of the message.
+         * @param category          The category of the message.
+         * @returns                 True if they're logged.
+        **/
+        /* ================================================================= */
+        bool IsEnabled(LogLevel level, LogCategory category) const;
+        /* ================================================================= */
+        /**
+         * Queues a message without formatting it. Never blocks, a message
+         * that doesn't fit in the ring of the thread is dropped.
+         * Use LUDUS_LOG_TO rather than calling this.
+         * @tparam Args             The types of the arguments.
+         * @param site              The call site.
+         * @param arguments         The arguments.
+        **/
+        /* ================================================================= */
+        template <typename... Args>
+        void Write(LogSite const &site, Args const &...arguments);
+        /* ================================================================= */
+        /**
+         * Waits until everything logged before has reached the sinks.
+         * Not from a sink.
+        **/
+        /* ================================================================= */
+        void Flush();
+        /* ================================================================= */
+        /**
+         * Gets the number of messages dropped for lack of room.
+         * @returns                 The number of messages dropped.
+        **/
+        /* ================================================================= */
+        size_t GetDroppedCount() const;
+
+        /* ================================================================= */
+        /**
+         * Gets the logger used by LUDUS_LOG, writing to the console.
+         * @returns                 The default logger.
+        **/
+        /* ================================================================= */
+        static Logger &GetDefault();
+        /* ================================================================= */
+        /**
+         * Formats a message as a line, with its time, level and category.
+         * @param record            The message.
+         * @returns                 The line, without a line break.
+        **/
+        /* ================================================================= */
+        static std::string FormatLine(LogRecord const &record);
+        /* ================================================================= */
+        /**
+         * Writes a message to the standard error stream.
+         * @param record            The message.
+        **/
+        /* ================================================================= */
+        static void WriteToConsole(LogRecord const &record);
+        /* ================================================================= */
+        /**
+         * Gets the name of a level.
+         * @param level             The level.
+         * @returns                 The name.
+        **/
+        /* ================================================================= */
+        static char const *GetLevelName(LogLevel level);
+        /* ================================================================= */
+        /**
+         * Gets the name of a category.
+         * @param category          The category.
+         * @returns                 The name.
+        **/
+        /* ================================================================= */
+        static char const *GetCategoryName(LogCategory category);
+    private:
+        /** Formats the arguments of a message into its format. */
+        using Decoder = void (*)(char const *format, std::uint8_t const *arguments,
+            std::string &message);
+
+        /* ================================================================= */
+        /** What comes before the arguments of a message in a ring. */
+        /* ================================================================= */
+        struct Header
+        {
+            /** The bytes of the message, header included. */
+            std::uint32_t size_;
+            /** The call site, or null for padding up to the end. */
+            LogSite const *site_;
+            /** Formats the arguments. */
+            Decoder decoder_;
+            /** The time of the steady clock, in nanoseconds. */
+            std::int64_t time_;
+        };
+
+        /* ================================================================= */
+        /**
+         * The messages of one thread: it writes them, the background
+         * thread reads them.
+        **/
+        /* ================================================================= */
+        struct Ring
+        {
+            /* ============================================================= */
+            /**
+             * Creates an empty ring.
+             * @param size          The bytes, a power of two.
+             * @param thread        The number of the thread writing.
+            **/
+            /* ============================================================= */
+            Ring(size_t size, unsigned thread);
+            /* ============================================================= */
+            /**
+             * Takes room for a message, in one piece.
+             * @param size          The bytes of the message.
+             * @returns             The room, or null if the ring is full.
+            **/
+            /* ============================================================= */
+            std::uint8_t *Reserve(size_t size);
+            /* ============================================================= */
+            /**
+             * Hands the message reserved to the background thread.
+            **/
+            /* ============================================================= */
+            void Commit();
+
+            /** The bytes of the ring. */
+            std::vector<std::uint8_t> bytes_;
+            /** The number of the thread writing. */
+            unsigned thread_;
+            /** Where the writing thread is, only it moves it. */
+            alignas(64) std::atomic<std::uint64_t> head_;
+            /** Where the head goes once the reserved message is written. */
+            std::uint64_t reserved_;
+            /** The last tail the writing thread saw. */
+            std::uint64_t cachedTail_;
+            /** Where the background thread is, only it moves it. */
+            alignas(64) std::atomic<std::uint64_t> tail_;
+            /** The messages dropped for lack of room. */
+            std::atomic<size_t> dropped_;
+            /** Set once the thread writing exited. */
+            std::atomic<bool> abandoned_;
+            /** Set once the logger is gone. */
+            std::atomic<bool> closed_;
+        };
+        /** The ring of a thread, as the thread holds it. */
+        struct LocalRing;
+
+        /* ================================================================= */
+        /**
+         * Gets the ring of the calling thread, creating it on first use.
+         * @returns                 The ring.
+        **/
+        /* ================================================================= */
+        Ring &GetRing();
+        /* ================================================================= */
+        /**
+         * Reads the messages of a ring.
+         * @param ring              The ring.
+         * @param records           Gets the messages.
+         * @returns                 True if there were any.
+        **/
+        /* ================================================================= */
+        bool Drain(Ring &ring, std::vector<LogRecord> &records) const;
+        /* ================================================================= */
+        /**
+         * Formats and hands over the messages until stopped.
+        **/
+        /* ================================================================= */
+        void WriterLoop();
+        /* ================================================================= */
+        /**
+         * Gets the time of the steady clock.
+         * @returns                 The time, in nanoseconds.
+        **/
+        /* ================================================================= */
+        static std::int64_t Now();
+        /* ================================================================= */
+        /**
+         * Copies a format up to its next {}.
+         * @param format            The format.
+         * @param message           The message to append it to.
+         * @returns                 The format after the {}, or its end.
+        **/
+        /* ================================================================= */
+        static char const *AppendLiteral(char const *format, std::string &message);
+        /* ================================================================= */
+        /**
+         * Formats stored arguments into a format.
+         * @tparam Args             The decayed types of the arguments.
+         * @param format            The format.
+         * @param arguments         The arguments.
+         * @param message           Gets the message.
+        **/
+        /* ================================================================= */
+        template <typename... Args>
+        static void Decode(char const *format, std::uint8_t const *arguments,
+            std::string &message);
+
+        /** Tells apart the loggers for the rings of the threads. */
+        std::uint64_t id_;
+        /** The bytes of every ring. */
+        size_t ringSize_;
+        /** The time the logger was created. */
+        std::int64_t start_;
+        /** The lowest level logged. */
+        std::atomic<LogLevel> level_;
+        /** One bit per category logged. */
+        std::atomic<std::uint32_t> categories_;
+        /** The rings of every thread that logged. */
+        std::vector<std::shared_ptr<Ring> > rings_;
+        /** The sinks. */
+        std::vector<Sink> sinks_;
+        /** The number of threads that logged. */
+        unsigned threadCount_;
+        /** The messages dropped by the rings of threads gone. */
+        size_t droppedGone_;
+        /** Guards the rings, the sinks and the flushes. */
+        mutable std::mutex mutex_;
+        /** Wakes the background thread early. */
+        std::condition_variable wake_;
+        /** Wakes the threads flushing. */
+        std::condition_variable flushed_;
+        /** The last flush asked for. */
+        std::uint64_t flushRequested_;
+        /** The last flush done. */
+        std::uint64_t flushCompleted_;
+        /** Whether the background thread should stop. */
+        bool stopping_;
+        /** The background thread. */
+        std::thread writer_;
+    };
+}
+
+#include "Logger.tpp"
+/* ========================================================================= */
+#endif // Logger_MODULE_H
+/* ========================================================================= */
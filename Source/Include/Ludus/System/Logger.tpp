@@ -0,0 +1,104 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Logger.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Implements storing the arguments of messages and formatting them back.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <charconv>
+#include <cstring>
+
+namespace Ludus
+{
+    template <typename T>
+    size_t LogArgument<T>::GetSize(T const &value)
+    {
+        UNREFERENCED(value);
+        return sizeof(T);
+    }
+
+    template <typename T>
+    void LogArgument<T>::Encode(std::uint8_t *&bytes, T const &value)
+    {
+        std::memcpy(bytes, &value, sizeof(T));
+        bytes += sizeof(T);
+    }
+
+    template <typename T>
+    void LogArgument<T>::Append(std::uint8_t const *&bytes, std::string &message)
+    {
+        T value;
+        std::memcpy(&value, bytes, sizeof(T));
+        bytes += sizeof(T);
+        if constexpr(std::is_same_v<T, bool>)
+        {
+            message += value ? "true" : "false";
+        }
+        else if constexpr(std::is_same_v<T, char>)
+        {
+            message += value;
+        }
+        else
+        {
+            char text[32];
+            char *end;
+            if constexpr(std::is_pointer_v<T>)
+            {
+                text[0] = '0';
+                text[1] = 'x';
+                end = std::to_chars(text + 2, text + sizeof(text),
+                    reinterpret_cast<std::uintptr_t>(value), 16).ptr;
+            }
+            else if constexpr(std::is_enum_v<T>)
+            {
+                end = std::to_chars(text, text + sizeof(text),
+                    static_cast<std::underlying_type_t<T> >(value)).ptr;
+            }
+            else
+            {
+                end = std::to_chars(text, text + sizeof(text), value).ptr;
+            }
+            message.append(text, end);
+        }
+    }
+
+    template <typename... Args>
+    void Logger::Write(LogSite const &site, Args const &...arguments)
+    {
+        size_t const size = (sizeof(Header) + ... +
+            LogArgument<std::decay_t<Args> >::GetSize(arguments));
+        // Kept aligned, so the headers can be copied in one go.
+        size_t const aligned = (size + alignof(Header) - 1) & ~(alignof(Header) - 1);
+        Ring &ring = GetRing();
+        std::uint8_t *bytes = ring.Reserve(aligned);
+        if(!bytes)
+        {
+            return;
+        }
+        Header const header = { static_cast<std::uint32_t>(aligned), &site,
+            &Decode<std::decay_t<Args>...>, Now() };
+        std::memcpy(bytes, &header, sizeof(Header));
+        bytes += sizeof(Header);
+        (LogArgument<std::decay_t<Args> >::Encode(bytes, arguments), ...);
+        ring.Commit();
+    }
+
+    template <typename... Args>
+    void Logger::Decode(char const *format, std::uint8_t const *arguments,
+        std::string &message)
+    {
+        // Unused by messages without arguments.
+        UNREFERENCED(arguments);
+        ((format = AppendLiteral(format, message),
+            LogArgument<Args>::Append(arguments, message)), ...);
+        AppendLiteral(format, message);
+    }
+}
@@ -0,0 +1,78 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            MappedFile.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Maps a whole file read only into memory. Nothing is read up front, the
+ * operating system brings pages in the first time they are touched and
+ * may drop them again under pressure, since the file backs them.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef MappedFile_MODULE_H
+#define MappedFile_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * A read only view of a file, kept mapped until destroyed.
+    **/
+    /* ===================================================================== */
+    class MappedFile final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Maps a file.
+         * @param path              The file to map.
+         * @throw std::runtime_error If the file can't be opened or mapped.
+        **/
+        /* ================================================================= */
+        explicit MappedFile(std::string const &path) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Unmaps the file.
+        **/
+        /* ================================================================= */
+        ~MappedFile();
+        MappedFile(MappedFile const &) = delete;
+        MappedFile &operator=(MappedFile const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Gets the contents of the file, aligned to a page.
+         * @returns                 The first byte of the file.
+        **/
+        /* ================================================================= */
+        std::uint8_t const *GetData() const;
+        /* ================================================================= */
+        /**
+         * Gets the size of the file.
+         * @returns                 The number of bytes mapped.
+        **/
+        /* ================================================================= */
+        size_t GetSize() const;
+    private:
+        /** The mapped contents, null for an empty file. */
+        std::uint8_t const *data_;
+        /** The size of the file. */
+        size_t size_;
+    };
+}
+
+/* ========================================================================= */
+#endif // MappedFile_MODULE_H
+/* ========================================================================= */
@@ -28,6 +28,7 @@
 #include <memory>
 #include <iterator>
 #include "Ludus/System/IObject.hpp"
+#include "Ludus/System/Transform.hpp"
 
 namespace Ludus
 {
@@ -214,6 +215,22 @@ namespace Ludus
         /* ================================================================= */
         const std::string& GetName() const;
         /* ================================================================= */
+        /**
+         * Gets a constant reference to the transform of the node.
+         * @returns             The transform placing the node relative
+         *                      to its parent.
+         **/
+        /* ================================================================= */
+        const Transform &GetTransform() const;
+        /* ================================================================= */
+        /**
+         * Gets a reference to the transform of the node.
+         * @returns             The transform placing the node relative
+         *                      to its parent.
+         **/
+        /* ================================================================= */
+        Transform &GetTransform();
+        /* ================================================================= */
         /**
          * Gets a constant reference to a child element given an index.
          * @param i             The index to access a child.
@@ -390,12 +407,21 @@ namespace Ludus
         /* ================================================================= */
         Iterator const CEnd() const;
     private:
+        // Scenes build whole trees at once.
+        friend class Scene;
+
         /** The name of the node to identiy it. */
         std::string name_;
         /** The list of children this node has. */
         std::vector<std::shared_ptr<Node> > children_;
         /** The parent node of this element. */
         Node *parent_;
+        /** The position, rotation and scale relative to the parent. */
+        Transform transform_;
+
+        // The children and the parent are the shape of the tree, which
+        // serializers walk on their own.
+        LUDUS_REFLECT(Node, LUDUS_FIELD(name_), LUDUS_FIELD(transform_))
     };
 }
 
@@ -0,0 +1,299 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Reflection.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Describes the fields of a type at compile time: the name, the member
+ * and the kind of every field, in declaration order.
+ * A type lists its fields once with LUDUS_REFLECT inside the class, or
+ * LUDUS_REFLECT_TYPE next to it when the type can't be changed. The list
+ * is a constexpr tuple found through argument dependent lookup, so there
+ * is no registration at startup and no map to search: serializers and
+ * editors walking the fields unroll into plain member accesses.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Reflection_MODULE_H
+#define Reflection_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/* ========================================================================= */
+/**
+ * Lists the reflected fields of a class, from inside its definition.
+ * Doesn't change the access of the declarations after it.
+ * @param Class             The class being described.
+ * @param ...               LUDUS_FIELD and LUDUS_BASE entries, in order.
+ **/
+/* ========================================================================= */
+#define LUDUS_REFLECT(Class, ...) \
+    friend constexpr auto LudusReflect(Class const *) \
+    { \
+        using Self = Class; \
+        return ::Ludus::MakeReflection(#Class, __VA_ARGS__); \
+    }
+
+/* ========================================================================= */
+/**
+ * Lists the reflected fields of a type with public members, from the
+ * namespace the type was declared in.
+ * @param Type              The type being described.
+ * @param ...               LUDUS_FIELD and LUDUS_BASE entries, in order.
+ **/
+/* ========================================================================= */
+#define LUDUS_REFLECT_TYPE(Type, ...) \
+    constexpr auto LudusReflect(Type const *) \
+    { \
+        using Self = Type; \
+        return ::Ludus::MakeReflection(#Type, __VA_ARGS__); \
+    }
+
+/* ========================================================================= */
+/**
+ * Names a field in a LUDUS_REFLECT list.
+ * @param member            The data member.
+ **/
+/* ========================================================================= */
+#define LUDUS_FIELD(member) ::Ludus::MakeField(#member, &Self::member)
+
+/* ========================================================================= */
+/**
+ * Pulls the fields of a reflected base class into a LUDUS_REFLECT list.
+ * @param Base              The base class.
+ **/
+/* ========================================================================= */
+#define LUDUS_BASE(Base) ::Ludus::GetFields<Base>()
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * The broad kind of a field, enough to pick how to store it.
+    **/
+    /* ===================================================================== */
+    enum class FieldKind : std::uint8_t
+    {
+        BOOL     = 0x00,  /* A bool. */
+        SIGNED   = 0x01,  /* A signed integer. */
+        UNSIGNED = 0x02,  /* An unsigned integer. */
+        FLOAT    = 0x03,  /* A float or a double. */
+        STRING   = 0x04,  /* A std::string. */
+        OBJECT   = 0x05,  /* A reflected type, walked field by field. */
+        OTHER    = 0x06,  /* Anything else, only known by its size. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * The description of the type of a field.
+    **/
+    /* ===================================================================== */
+    struct TypeDescriptor
+    {
+        /** The broad kind of the type. */
+        FieldKind kind_;
+        /** The size of the type. */
+        size_t size_;
+        /** The alignment of the type. */
+        size_t alignment_;
+        /** The name of the type, as reflected or as spelled in C++. */
+        char const *name_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * A reflected data member.
+     * @tparam Class                The class declaring the member.
+     * @tparam T                    The type of the member.
+    **/
+    /* ===================================================================== */
+    template <typename Class, typename T>
+    struct Field
+    {
+        /** The class declaring the member. */
+        using Owner = Class;
+        /** The type of the member. */
+        using Type = T;
+
+        /** The name of the member. */
+        char const *name_;
+        /** The member itself. */
+        T Class::*member_;
+        /** The description of the type of the member. */
+        TypeDescriptor type_;
+
+        /* ================================================================= */
+        /**
+         * Gets the member of an object.
+         * @param object            The object, of Class or derived from it.
+         * @returns                 The member.
+        **/
+        /* ================================================================= */
+        template <typename Object>
+        constexpr T &Get(Object &object) const;
+        /* ================================================================= */
+        /**
+         * Gets the member of an object.
+         * @param object            The object, of Class or derived from it.
+         * @returns                 The member.
+        **/
+        /* ================================================================= */
+        template <typename Object>
+        constexpr T const &Get(Object const &object) const;
+        /* ================================================================= */
+        /**
+         * Gets the offset of the member from the start of Class. Pointers
+         * to members can't be turned into offsets in a constant
+         * expression, so this is computed on every call.
+         * @returns                 The offset in bytes.
+        **/
+        /* ================================================================= */
+        size_t GetOffset() const;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The reflected name and fields of a type.
+     * @tparam Fields               A std::tuple of Field.
+    **/
+    /* ===================================================================== */
+    template <typename Fields>
+    struct Reflection
+    {
+        /** The name of the type. */
+        char const *name_;
+        /** Every field of the type, in declaration order. */
+        Fields fields_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Whether a type was reflected with LUDUS_REFLECT or
+     * LUDUS_REFLECT_TYPE, by itself or by a base class.
+     * @tparam T                    The type to check.
+    **/
+    /* ===================================================================== */
+    template <typename T, typename = void>
+    struct IsReflected : std::false_type
+    {
+    };
+
+    /** A reflected type. */
+    template <typename T>
+    struct IsReflected<T, std::void_t<decltype(LudusReflect(
+        static_cast<T const *>(nullptr)))> > : std::true_type
+    {
+    };
+
+    /* ===================================================================== */
+    /**
+     * Describes a type.
+     * @tparam T                    The type to describe.
+     * @returns                     The description of the type.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    constexpr TypeDescriptor DescribeType();
+
+    /* ===================================================================== */
+    /**
+     * Makes a field, used by LUDUS_FIELD.
+     * @param name                  The name of the member.
+     * @param member                The member.
+     * @returns                     The field.
+    **/
+    /* ===================================================================== */
+    template <typename Class, typename T>
+    constexpr Field<Class, T> MakeField(char const *name, T Class::*member);
+
+    /* ===================================================================== */
+    /**
+     * Makes the reflection of a type, used by LUDUS_REFLECT.
+     * @param name                  The name of the type.
+     * @param entries               Fields, or tuples of fields of a base.
+     * @returns                     The reflection of the type.
+    **/
+    /* ===================================================================== */
+    template <typename... Entries>
+    constexpr auto MakeReflection(char const *name, Entries const &...entries);
+
+    /* ===================================================================== */
+    /**
+     * Gets the name a type was reflected with.
+     * @tparam T                    A reflected type.
+     * @returns                     The name of the type.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    constexpr char const *GetTypeName();
+
+    /* ===================================================================== */
+    /**
+     * Gets every field of a type.
+     * @tparam T                    A reflected type.
+     * @returns                     A tuple of Field, in declaration order.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    constexpr auto GetFields();
+
+    /* ===================================================================== */
+    /**
+     * Gets the number of fields of a type.
+     * @tparam T                    A reflected type.
+     * @returns                     The number of fields.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    constexpr size_t GetFieldCount();
+
+    /* ===================================================================== */
+    /**
+     * Finds a field by name.
+     * @tparam T                    A reflected type.
+     * @param name                  The name of the member.
+     * @returns                     The index of the field, or
+     *                              GetFieldCount<T>() if there's none.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    constexpr size_t FindField(std::string_view name);
+
+    /* ===================================================================== */
+    /**
+     * Calls a function with every field of a type.
+     * @tparam T                    A reflected type.
+     * @param function              Called as function(field).
+    **/
+    /* ===================================================================== */
+    template <typename T, typename Function>
+    constexpr void ForEachField(Function &&function);
+
+    /* ===================================================================== */
+    /**
+     * Calls a function with every field of an object and its value.
+     * @param object                The object, of a reflected type.
+     * @param function              Called as function(field, value).
+    **/
+    /* ===================================================================== */
+    template <typename T, typename Function>
+    void VisitFields(T &object, Function &&function);
+}
+
+#include "Reflection.tpp"
+/* ========================================================================= */
+#endif // Reflection_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,174 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Reflection.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Describes the fields of a type at compile time.
+ **/
+/* ========================================================================= */
+
+namespace Ludus
+{
+    template <typename Class, typename T>
+    template <typename Object>
+    constexpr T &Field<Class, T>::Get(Object &object) const
+    {
+        return static_cast<Class &>(object).*member_;
+    }
+
+    template <typename Class, typename T>
+    template <typename Object>
+    constexpr T const &Field<Class, T>::Get(Object const &object) const
+    {
+        return static_cast<Class const &>(object).*member_;
+    }
+
+    template <typename Class, typename T>
+    size_t Field<Class, T>::GetOffset() const
+    {
+        // Only the address of the member is taken, the object never lives.
+        union Storage
+        {
+            Storage() {}
+            ~Storage() {}
+            Class object_;
+        };
+        static Storage storage;
+        return static_cast<size_t>(reinterpret_cast<char const *>(
+            &(storage.object_.*member_)) -
+            reinterpret_cast<char const *>(&storage.object_));
+    }
+
+    template <typename T>
+    constexpr TypeDescriptor DescribeType()
+    {
+        constexpr char const *integers[2][4] = {
+            { "uint8", "uint16", "uint32", "uint64" },
+            { "int8", "int16", "int32", "int64" } };
+        constexpr size_t width = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 :
+            sizeof(T) == 4 ? 2 : 3;
+        if constexpr(std::is_same<T, bool>::value)
+        {
+            return { FieldKind::BOOL, sizeof(T), alignof(T), "bool" };
+        }
+        else if constexpr(std::is_integral<T>::value)
+        {
+            return { std::is_signed<T>::value ? FieldKind::SIGNED :
+                FieldKind::UNSIGNED, sizeof(T), alignof(T),
+                integers[std::is_signed<T>::value][width] };
+        }
+        else if constexpr(std::is_floating_point<T>::value)
+        {
+            return { FieldKind::FLOAT, sizeof(T), alignof(T),
+                sizeof(T) == 4 ? "float" : "double" };
+        }
+        else if constexpr(std::is_same<T, std::string>::value)
+        {
+            return { FieldKind::STRING, sizeof(T), alignof(T), "string" };
+        }
+        else if constexpr(IsReflected<T>::value)
+        {
+            return { FieldKind::OBJECT, sizeof(T), alignof(T), GetTypeName<T>() };
+        }
+        else
+        {
+            return { FieldKind::OTHER, sizeof(T), alignof(T), "other" };
+        }
+    }
+
+    template <typename Class, typename T>
+    constexpr Field<Class, T> MakeField(char const *name, T Class::*member)
+    {
+        return Field<Class, T>{ name, member, DescribeType<T>() };
+    }
+
+    /* ===================================================================== */
+    /**
+     * Wraps a single field of a LUDUS_REFLECT list in a tuple.
+     * @param field                 The field.
+     * @returns                     A tuple holding the field.
+    **/
+    /* ===================================================================== */
+    template <typename Class, typename T>
+    constexpr std::tuple<Field<Class, T> > MakeFieldList(Field<Class, T> const &field)
+    {
+        return std::tuple<Field<Class, T> >(field);
+    }
+
+    /* ===================================================================== */
+    /**
+     * Passes the fields of a base class through.
+     * @param fields                The fields of the base.
+     * @returns                     The same fields.
+    **/
+    /* ===================================================================== */
+    template <typename... Fields>
+    constexpr std::tuple<Fields...> MakeFieldList(std::tuple<Fields...> const &fields)
+    {
+        return fields;
+    }
+
+    template <typename... Entries>
+    constexpr auto MakeReflection(char const *name, Entries const &...entries)
+    {
+        auto fields = std::tuple_cat(MakeFieldList(entries)...);
+        return Reflection<decltype(fields)>{ name, fields };
+    }
+
+    template <typename T>
+    constexpr char const *GetTypeName()
+    {
+        static_assert(IsReflected<T>::value, "The type isn't reflected.");
+        return LudusReflect(static_cast<T const *>(nullptr)).name_;
+    }
+
+    template <typename T>
+    constexpr auto GetFields()
+    {
+        static_assert(IsReflected<T>::value, "The type isn't reflected.");
+        return LudusReflect(static_cast<T const *>(nullptr)).fields_;
+    }
+
+    template <typename T>
+    constexpr size_t GetFieldCount()
+    {
+        return std::tuple_size<decltype(GetFields<T>())>::value;
+    }
+
+    template <typename T>
+    constexpr size_t FindField(std::string_view name)
+    {
+        size_t found = GetFieldCount<T>();
+        size_t index = 0;
+        ForEachField<T>([&](auto const &field)
+        {
+            if(found == GetFieldCount<T>() && name == field.name_)
+            {
+                found = index;
+            }
+            ++index;
+        });
+        return found;
+    }
+
+    template <typename T, typename Function>
+    constexpr void ForEachField(Function &&function)
+    {
+        std::apply([&function](auto const &...fields)
+        {
+            (function(fields), ...);
+        }, GetFields<T>());
+    }
+
+    template <typename T, typename Function>
+    void VisitFields(T &object, Function &&function)
+    {
+        ForEachField<std::remove_const_t<T> >([&object, &function](auto const &field)
+        {
+            function(field, field.Get(object));
+        });
+    }
+}
@@ -0,0 +1,312 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Scene.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Saves a Node subtree to a compact binary scene and loads it back.
+ * A scene holds a table of the names, one fixed size record per node in
+ * breadth first order and blocks of typed payloads, one element per node,
+ * packed from the reflected fields. Every section is found through an
+ * offset from the start of the file and aligned for its contents, so a
+ * mapped scene is usable in place: SceneView and NodeView read names,
+ * children and transforms straight from the file, and only the pages
+ * actually looked at are ever read from disk.
+ * Loading builds every node of the scene in a single allocation instead
+ * of one make_shared per node.
+ * Only what a plain Node holds is saved, subclasses load back as Nodes.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Scene_MODULE_H
+#define Scene_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/System/MappedFile.hpp"
+#include "Ludus/System/Node.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Ludus
+{
+    /** Forward declaration to the SceneView. */
+    class SceneView;
+
+    /* ===================================================================== */
+    /**
+     * The kinds of payload blocks a scene may hold. Loaders skip the
+     * kinds they don't know.
+    **/
+    /* ===================================================================== */
+    enum class SceneBlock : std::uint32_t
+    {
+        TRANSFORMS = 0x01,  /* The local transform of every node. */
+    };
+
+    /* ===================================================================== */
+    /**
+     * Writes and reads binary scenes.
+    **/
+    /* ===================================================================== */
+    class Scene final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Turns a subtree into a scene.
+         * @param root              The root of the subtree.
+         * @returns                 The bytes of the scene.
+         * @throw std::length_error If the subtree is too large for the
+         *                          format.
+        **/
+        /* ================================================================= */
+        static std::vector<std::uint8_t> Serialize(Node const &root) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Rebuilds a subtree from a scene. Every node lives in one block
+         * owned by the returned root, so nodes of the subtree must not
+         * outlive it.
+         * @param data              The bytes of the scene, aligned to 8.
+         * @param size              The number of bytes.
+         * @returns                 The root of the subtree.
+         * @throw std::runtime_error If the bytes aren't a valid scene.
+        **/
+        /* ================================================================= */
+        static std::shared_ptr<Node> Deserialize(std::uint8_t const *data,
+            size_t size) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Rebuilds a subtree from a scene, as Deserialize does.
+         * @param scene             The scene to build.
+         * @returns                 The root of the subtree.
+         * @throw std::runtime_error If the scene holds broken nodes.
+        **/
+        /* ================================================================= */
+        static std::shared_ptr<Node> Instantiate(SceneView const &scene) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Saves a subtree to a file.
+         * @param root              The root of the subtree.
+         * @param path              The file to write.
+         * @throw std::runtime_error If the file can't be written.
+        **/
+        /* ================================================================= */
+        static void Save(Node const &root, std::string const &path) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Loads a subtree from a file, as Deserialize does.
+         * @param path              The file to read.
+         * @returns                 The root of the subtree.
+         * @throw std::runtime_error If the file can't be read or isn't a
+         *                          valid scene.
+        **/
+        /* ================================================================= */
+        static std::shared_ptr<Node> Load(std::string const &path) noexcept(false);
+    };
+
+    /* ===================================================================== */
+    /**
+     * A node read in place from a scene. Views are small values, valid as
+     * long as their SceneView.
+    **/
+    /* ===================================================================== */
+    class NodeView final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Gets the name of the node.
+         * @returns                 The name, pointing into the scene.
+         * @throw std::runtime_error If the name is out of the scene.
+        **/
+        /* ================================================================= */
+        std::string_view GetName() const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of children of the node.
+         * @returns                 The number of children.
+        **/
+        /* ================================================================= */
+        size_t Size() const;
+        /* ================================================================= */
+        /**
+         * Gets a child of the node.
+         * @param i                 The index of the child.
+         * @returns                 The child.
+         * @throw NodeNotFound      If there's no child at that index.
+         * @throw std::runtime_error If the child is out of the scene.
+        **/
+        /* ================================================================= */
+        NodeView At(size_t i) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the first child of the node with a name.
+         * @param name              The name of the child.
+         * @returns                 The child.
+         * @throw NodeNotFound      If no child has that name.
+        **/
+        /* ================================================================= */
+        NodeView Find(std::string_view name) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets whether the node has a parent, which only the root lacks.
+         * @returns                 True if the node has a parent.
+        **/
+        /* ================================================================= */
+        bool HasParent() const;
+        /* ================================================================= */
+        /**
+         * Gets the parent of the node.
+         * @returns                 The parent.
+         * @throw NodeNotFound      If the node is the root.
+        **/
+        /* ================================================================= */
+        NodeView GetParent() const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the position relative to the parent.
+         * @returns                 The local position, the origin if the
+         *                          scene has no transforms.
+        **/
+        /* ================================================================= */
+        Math::Vec3 GetPosition() const;
+        /* ================================================================= */
+        /**
+         * Gets the rotation relative to the parent.
+         * @returns                 The local rotation, none if the scene
+         *                          has no transforms.
+        **/
+        /* ================================================================= */
+        Math::Quat GetRotation() const;
+        /* ================================================================= */
+        /**
+         * Gets the scale relative to the parent.
+         * @returns                 The local scale, one if the scene has
+         *                          no transforms.
+        **/
+        /* ================================================================= */
+        Math::Vec3 GetScale() const;
+        /* ================================================================= */
+        /**
+         * Gets the index of the node, in breadth first order.
+         * @returns                 The index of the node.
+        **/
+        /* ================================================================= */
+        std::uint32_t GetIndex() const;
+    private:
+        friend class Scene;
+        friend class SceneView;
+
+        /* ================================================================= */
+        /**
+         * Creates a view of a node.
+         * @param scene             The scene holding the node.
+         * @param index             The index of the node.
+        **/
+        /* ================================================================= */
+        NodeView(SceneView const &scene, std::uint32_t index);
+
+        /** The scene holding the node. */
+        SceneView const *scene_;
+        /** The index of the node. */
+        std::uint32_t index_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * A scene used in place, from a mapped file or bytes in memory.
+     * Opening only checks the header and where the sections are, nodes
+     * are checked as they get visited.
+    **/
+    /* ===================================================================== */
+    class SceneView final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Maps a scene file.
+         * @param path              The file to map.
+         * @throw std::runtime_error If the file can't be mapped or isn't a
+         *                          valid scene.
+        **/
+        /* ================================================================= */
+        explicit SceneView(std::string const &path) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Views a scene in memory, which must outlive the view.
+         * @param data              The bytes of the scene, aligned to 8.
+         * @param size              The number of bytes.
+         * @throw std::runtime_error If the bytes aren't a valid scene.
+        **/
+        /* ================================================================= */
+        SceneView(std::uint8_t const *data, size_t size) noexcept(false);
+        SceneView(SceneView const &) = delete;
+        SceneView &operator=(SceneView const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Gets the root of the scene.
+         * @returns                 The root.
+        **/
+        /* ================================================================= */
+        NodeView GetRoot() const;
+        /* ================================================================= */
+        /**
+         * Gets a node by its index.
+         * @param index             The index of the node, in breadth first
+         *                          order.
+         * @returns                 The node.
+         * @throw std::out_of_range If there's no node at that index.
+        **/
+        /* ================================================================= */
+        NodeView GetNode(size_t index) const noexcept(false);
+        /* ================================================================= */
+        /**
+         * Gets the number of nodes in the scene.
+         * @returns                 The number of nodes.
+        **/
+        /* ================================================================= */
+        size_t GetNodeCount() const;
+    private:
+        friend class NodeView;
+        friend class Scene;
+
+        /* ================================================================= */
+        /**
+         * Finds the sections of the scene.
+         * @throw std::runtime_error If the bytes aren't a valid scene.
+        **/
+        /* ================================================================= */
+        void Open() noexcept(false);
+
+        /** The mapped file, if the scene came from one. */
+        std::unique_ptr<MappedFile> file_;
+        /** The bytes of the scene. */
+        std::uint8_t const *data_;
+        /** The number of bytes. */
+        size_t size_;
+        /** The number of nodes. */
+        std::uint32_t nodeCount_;
+        /** The table of names. */
+        char const *strings_;
+        /** The size of the table of names. */
+        std::uint64_t stringBytes_;
+        /** The records of the nodes, in breadth first order. */
+        void const *records_;
+        /** The transform of every node, or null. */
+        std::uint8_t const *transforms_;
+    };
+}
+
+/* ========================================================================= */
+#endif // Scene_MODULE_H
+/* ========================================================================= */
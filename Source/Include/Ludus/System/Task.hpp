@@ -0,0 +1,456 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Task.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Lets gameplay code that spans many frames be written top to bottom.
+ * A task is a coroutine that suspends on what it waits for: the next
+ * frame, the next fixed step, some seconds, an asset or a job. The
+ * scheduler parks it with what it waits for and resumes it from the
+ * frame loop once that happens, so nothing runs or polls in between.
+ * The frames of the coroutines come from pools, a task started every
+ * frame doesn't go to the heap once the pools are warm.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Task_MODULE_H
+#define Task_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Assets/AssetManager.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include "Ludus/System/Node.hpp"
+#include "Ludus/System/TimerWheel.hpp"
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Ludus
+{
+    class TaskScheduler;
+
+    /* ===================================================================== */
+    /**
+     * A coroutine run by the scheduler. Tasks start suspended: either the
+     * scheduler starts one, or another task awaits it and resumes when it
+     * returns, getting what it threw.
+    **/
+    /* ===================================================================== */
+    class Task
+    {
+    public:
+        class promise_type;
+        /** The coroutine of a task. */
+        using Handle = std::coroutine_handle<promise_type>;
+
+        /* ================================================================= */
+        /**
+         * The state the compiler keeps with the coroutine. The names the
+         * language looks for are kept as they are.
+        **/
+        /* ================================================================= */
+        class promise_type
+        {
+        public:
+            /* ============================================================= */
+            /**
+             * Frees the frame of the coroutine when it finishes, if the
+             * scheduler owns it. Otherwise, hands back to the task that
+             * awaited it.
+            **/
+            /* ============================================================= */
+            struct FinalAwaiter
+            {
+                /** Called by co_await to wait. */
+                bool await_ready() const noexcept;
+                std::coroutine_handle<> await_suspend(Handle task) noexcept;
+                void await_resume() const noexcept;
+            };
+
+            /** Called by the language to run the coroutine. */
+            Task get_return_object();
+            std::suspend_always initial_suspend() const noexcept;
+            FinalAwaiter final_suspend() const noexcept;
+            void return_void() const;
+            void unhandled_exception();
+
+            /* ============================================================= */
+            /**
+             * Takes the frame of a coroutine from the pool of its size.
+             * @param size          The size of the frame.
+             * @returns             The frame.
+            **/
+            /* ============================================================= */
+            static void *operator new(size_t size);
+            /* ============================================================= */
+            /**
+             * Hands the frame of a coroutine back to its pool.
+             * @param frame         The frame.
+             * @param size          The size of the frame.
+            **/
+            /* ============================================================= */
+            static void operator delete(void *frame, size_t size);
+
+            /** The scheduler running the task, set once started. */
+            TaskScheduler *scheduler_ = nullptr;
+            /** The task awaiting this one, resumed when it returns. */
+            std::coroutine_handle<> continuation_;
+            /** What the task threw. */
+            std::exception_ptr exception_;
+            /** What the job the task waited on threw. */
+            std::exception_ptr resumeError_;
+            /** The neighbours in the scheduler's list of running tasks. */
+            promise_type *previous_ = nullptr;
+            promise_type *next_ = nullptr;
+        };
+
+        /* ================================================================= */
+        /**
+         * Awaits another task, starting it in place.
+        **/
+        /* ================================================================= */
+        class Awaiter
+        {
+        public:
+            explicit Awaiter(Handle task);
+            /** Called by co_await to wait. */
+            bool await_ready() const noexcept;
+            std::coroutine_handle<> await_suspend(Handle parent) const noexcept;
+            void await_resume() const noexcept(false);
+        private:
+            /** The task awaited. */
+            Handle task_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Creates a task holding no coroutine.
+        **/
+        /* ================================================================= */
+        Task() = default;
+        /* ================================================================= */
+        /**
+         * Takes the coroutine of another task.
+         * @param task              The task.
+        **/
+        /* ================================================================= */
+        Task(Task &&task) noexcept;
+        /* ================================================================= */
+        /**
+         * Takes the coroutine of another task, freeing the one held.
+         * @param task              The task.
+         * @returns                 This task.
+        **/
+        /* ================================================================= */
+        Task &operator=(Task &&task) noexcept;
+        /* ================================================================= */
+        /**
+         * Frees the coroutine if the task still holds it.
+        **/
+        /* ================================================================= */
+        ~Task();
+        Task(Task const &) = delete;
+        Task &operator=(Task const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Gets whether the task has returned.
+         * @returns                 True if the task returned or threw.
+        **/
+        /* ================================================================= */
+        bool IsDone() const;
+        /* ================================================================= */
+        /**
+         * Starts the task from another one and waits for it to return.
+         * @returns                 The awaiter.
+        **/
+        /* ================================================================= */
+        Awaiter operator co_await() && noexcept;
+    private:
+        friend class TaskScheduler;
+
+        /* ================================================================= */
+        /**
+         * Wraps a coroutine.
+         * @param handle            The coroutine.
+        **/
+        /* ================================================================= */
+        explicit Task(Handle handle);
+
+        /** The coroutine, until the scheduler takes it. */
+        Handle handle_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Resumes the task at the start of the next frame.
+    **/
+    /* ===================================================================== */
+    struct NextFrame
+    {
+        /** Called by co_await to wait. */
+        bool await_ready() const noexcept;
+        void await_suspend(Task::Handle task) const noexcept(false);
+        void await_resume() const noexcept;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Resumes the task on the next fixed step.
+    **/
+    /* ===================================================================== */
+    struct NextFixedStep
+    {
+        /** Called by co_await to wait. */
+        bool await_ready() const noexcept;
+        void await_suspend(Task::Handle task) const noexcept(false);
+        void await_resume() const noexcept;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Resumes the task once some seconds of frame time passed.
+    **/
+    /* ===================================================================== */
+    class WaitSeconds
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates the wait.
+         * @param seconds           The seconds to wait.
+        **/
+        /* ================================================================= */
+        explicit WaitSeconds(double seconds);
+        /** Called by co_await to wait. */
+        bool await_ready() const noexcept;
+        void await_suspend(Task::Handle task) const noexcept(false);
+        void await_resume() const noexcept;
+    private:
+        /** The seconds to wait. */
+        double seconds_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Runs a job on the job system and resumes the task on the main thread
+     * in the frame after it finished, rethrowing what it threw.
+    **/
+    /* ===================================================================== */
+    class WaitForJob
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates the wait.
+         * @param jobs              The job system running the job.
+         * @param job               The job.
+        **/
+        /* ================================================================= */
+        WaitForJob(JobSystem &jobs, JobSystem::Job job);
+        /** Called by co_await to wait. */
+        bool await_ready() const noexcept;
+        void await_suspend(Task::Handle task) noexcept(false);
+        void await_resume() const noexcept(false);
+    private:
+        /** The job system running the job. */
+        JobSystem &jobs_;
+        /** The job, until it's scheduled. */
+        JobSystem::Job job_;
+        /** The task waiting. */
+        Task::Handle task_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Loads an asset and resumes the task once it's ready or failed.
+     * @tparam T                    The type of the asset.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    class LoadAsset
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates the wait.
+         * @param assets            The asset manager loading it.
+         * @param path              The path of the asset.
+         * @param priority          How soon the asset is needed.
+        **/
+        /* ================================================================= */
+        LoadAsset(AssetManager &assets, std::string path,
+            AssetPriority priority = AssetPriority::NORMAL);
+        /** Called by co_await to wait. */
+        bool await_ready() const noexcept;
+        void await_suspend(Task::Handle task) noexcept(false);
+        AssetHandle<T> await_resume();
+    private:
+        /** The asset manager loading it. */
+        AssetManager &assets_;
+        /** The path of the asset. */
+        std::string path_;
+        /** How soon the asset is needed. */
+        AssetPriority priority_;
+        /** The asset, once requested. */
+        AssetHandle<T> asset_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The engine system running the tasks from the frame loop. Tasks
+     * waiting on frames are resumed in BeginFrame, on fixed steps in
+     * FixedUpdate, on time, jobs and assets in Update. What a task throws
+     * is thrown back from there.
+    **/
+    /* ===================================================================== */
+    class TaskScheduler final : public Node
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates a scheduler with no tasks.
+        **/
+        /* ================================================================= */
+        TaskScheduler();
+        /* ================================================================= */
+        /**
+         * Frees the tasks that didn't finish.
+        **/
+        /* ================================================================= */
+        ~TaskScheduler();
+        TaskScheduler(TaskScheduler const &) = delete;
+        TaskScheduler &operator=(TaskScheduler const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Runs a task until it first waits, the scheduler then owns it.
+         * @param task              The task.
+         * @throw std::exception    What the task threw before waiting.
+        **/
+        /* ================================================================= */
+        void Start(Task task) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Resumes the tasks waiting for this frame.
+        **/
+        /* ================================================================= */
+        void BeginFrame() override;
+        /* ================================================================= */
+        /**
+         * Resumes the tasks whose time, job or asset came.
+         * @param dt                The amount of time the last frame took.
+        **/
+        /* ================================================================= */
+        void Update(double const &dt) override;
+        /* ================================================================= */
+        /**
+         * Resumes the tasks waiting for this fixed step.
+         * @param fixedDt           The length of a fixed step.
+        **/
+        /* ================================================================= */
+        void FixedUpdate(double const &fixedDt) override;
+        /* ================================================================= */
+        /**
+         * Gets the number of tasks started that didn't finish.
+         * @returns                 The number of running tasks.
+        **/
+        /* ================================================================= */
+        size_t GetTaskCount() const;
+    private:
+        friend struct NextFrame;
+        friend struct NextFixedStep;
+        friend class WaitSeconds;
+        friend class WaitForJob;
+        template <typename T>
+        friend class LoadAsset;
+        friend struct Task::promise_type::FinalAwaiter;
+
+        /* ================================================================= */
+        /**
+         * The tasks woken from other threads, kept alive by what may
+         * still wake them.
+        **/
+        /* ================================================================= */
+        struct Inbox
+        {
+            /* ============================================================= */
+            /**
+             * Queues a task to resume. Safe from any thread.
+             * @param task          The task.
+             * @param error         What it waited on threw.
+            **/
+            /* ============================================================= */
+            void Post(Task::Handle task, std::exception_ptr error = nullptr);
+
+            /** Guards the queue. */
+            std::mutex mutex_;
+            /** The tasks to resume and what they waited on threw. */
+            std::vector<std::pair<Task::Handle, std::exception_ptr> > ready_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Gets the scheduler running a task.
+         * @param task              The task.
+         * @returns                 The scheduler.
+         * @throw std::logic_error  If no scheduler started the task.
+        **/
+        /* ================================================================= */
+        static TaskScheduler &GetScheduler(Task::Handle task) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Frees a started task that returned.
+         * @param task              The task.
+        **/
+        /* ================================================================= */
+        void Finish(Task::Handle task) noexcept;
+        /* ================================================================= */
+        /**
+         * Resumes a batch of tasks, then throws what any task threw.
+         * @param waiting           The tasks, emptied.
+        **/
+        /* ================================================================= */
+        void ResumeAll(std::vector<std::coroutine_handle<> > &waiting) noexcept(false);
+        /* ================================================================= */
+        /**
+         * Throws what a task threw, once.
+        **/
+        /* ================================================================= */
+        void Rethrow() noexcept(false);
+
+        /** The tasks started that didn't finish. */
+        Task::promise_type *tasks_;
+        /** The number of tasks started that didn't finish. */
+        size_t taskCount_;
+        /** The tasks waiting for the next frame. */
+        std::vector<std::coroutine_handle<> > frame_;
+        /** The tasks waiting for the next fixed step. */
+        std::vector<std::coroutine_handle<> > fixedStep_;
+        /** The batch being resumed, kept to reuse its memory. */
+        std::vector<std::coroutine_handle<> > resuming_;
+        /** The tasks woken by jobs and assets being resumed. */
+        std::vector<std::pair<Task::Handle, std::exception_ptr> > woken_;
+        /** The tasks waiting on time. */
+        TimerWheel timers_;
+        /** The tasks woken from other threads. */
+        std::shared_ptr<Inbox> inbox_;
+        /** What a finished task threw, until thrown back. */
+        std::exception_ptr failure_;
+    };
+}
+
+#include "Task.tpp"
+/* ========================================================================= */
+#endif // Task_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,50 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Task.tpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Implements waiting on assets from tasks.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include <utility>
+
+namespace Ludus
+{
+    template <typename T>
+    LoadAsset<T>::LoadAsset(AssetManager &assets, std::string path, AssetPriority priority) :
+        assets_(assets), path_(std::move(path)), priority_(priority)
+    {
+    }
+
+    template <typename T>
+    bool LoadAsset<T>::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename T>
+    void LoadAsset<T>::await_suspend(Task::Handle task)
+    {
+        // The callback comes on the main thread during BeginFrame, the task
+        // resumes in the Update right after.
+        std::shared_ptr<TaskScheduler::Inbox> inbox = TaskScheduler::GetScheduler(task).inbox_;
+        asset_ = assets_.template Load<T>(path_, priority_,
+            [inbox = std::move(inbox), task](AssetHandle<T> const &)
+            {
+                inbox->Post(task);
+            });
+    }
+
+    template <typename T>
+    AssetHandle<T> LoadAsset<T>::await_resume()
+    {
+        return std::move(asset_);
+    }
+}
@@ -0,0 +1,232 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            TimerWheel.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Runs callbacks after a delay, for any number of timers.
+ * The timers hang off a hierarchical wheel: four rings of 256 slots, each
+ * ring a tick 256 times coarser than the one below. A timer goes into
+ * the slot of its expiry on the finest ring that reaches it, and drops
+ * down a ring every time the ring above comes around. Scheduling and
+ * cancelling never look at the other timers, and a frame only visits the
+ * slots that hold timers on the ticks it crosses, so pending timers cost
+ * nothing until they are due. All the timers due on a tick fire together.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef TimerWheel_MODULE_H
+#define TimerWheel_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/System/Node.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Names a scheduled timer. Stays safe to use after the timer fired.
+    **/
+    /* ===================================================================== */
+    struct TimerId
+    {
+        /** The slot of the timer. */
+        std::uint32_t index_;
+        /** Tells apart the timers that used the slot. */
+        std::uint32_t generation_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * The engine system running the timers, driven by the frame clock.
+    **/
+    /* ===================================================================== */
+    class TimerWheel final : public Node
+    {
+    public:
+        /** Runs when a timer fires. */
+        using Callback = std::function<void()>;
+
+        /* ================================================================= */
+        /**
+         * Creates a wheel ticking every millisecond.
+        **/
+        /* ================================================================= */
+        TimerWheel();
+        /* ================================================================= */
+        /**
+         * Creates a wheel.
+         * @param tick              The resolution of the timers, in
+         *                          seconds. Timers fire on the first tick
+         *                          at or after their time.
+         * @throw std::invalid_argument If the tick isn't positive.
+        **/
+        /* ================================================================= */
+        explicit TimerWheel(double tick) noexcept(false);
+
+        /* ================================================================= */
+        /**
+         * Schedules a callback.
+         * @param delay             The seconds until it fires, at least one
+         *                          tick.
+         * @param callback          The callback. It may schedule and
+         *                          cancel timers, its own included.
+         * @param period            The seconds between firings after the
+         *                          first, or zero to fire once.
+         * @returns                 The timer.
+        **/
+        /* ================================================================= */
+        TimerId Schedule(double delay, Callback callback, double period = 0.0);
+        /* ================================================================= */
+        /**
+         * Stops a timer from firing again.
+         * @param timer             The timer.
+         * @returns                 True if the timer was still pending.
+        **/
+        /* ================================================================= */
+        bool Cancel(TimerId timer);
+        /* ================================================================= */
+        /**
+         * Gets whether a timer will still fire.
+         * @param timer             The timer.
+         * @returns                 True if the timer is pending.
+        **/
+        /* ================================================================= */
+        bool IsPending(TimerId timer) const;
+        /* ================================================================= */
+        /**
+         * Moves the clock forward, firing every timer due on the way.
+         * @param dt                The seconds passed.
+        **/
+        /* ================================================================= */
+        void Advance(double dt);
+        /* ================================================================= */
+        /**
+         * Advances the clock by the time the last frame took.
+         * @param dt                The amount of time the last frame took.
+        **/
+        /* ================================================================= */
+        void Update(double const &dt) override;
+        /* ================================================================= */
+        /**
+         * Gets the time since the wheel was created.
+         * @returns                 The time of the clock, in seconds.
+        **/
+        /* ================================================================= */
+        double GetTime() const;
+        /* ================================================================= */
+        /**
+         * Gets the number of timers waiting to fire.
+         * @returns                 The number of pending timers.
+        **/
+        /* ================================================================= */
+        size_t GetPendingCount() const;
+    private:
+        /** Where a timer is in its life. */
+        enum class TimerState : std::uint8_t
+        {
+            FREE      = 0x00,  /* The slot holds no timer. */
+            PENDING   = 0x01,  /* Waiting in the wheel. */
+            FIRING    = 0x02,  /* Taken off the wheel to fire this tick. */
+            CANCELLED = 0x03,  /* Cancelled while firing. */
+        };
+
+        /* ================================================================= */
+        /** A timer, linked into the list of its slot. */
+        /* ================================================================= */
+        struct Timer
+        {
+            /** The tick it fires on. */
+            std::uint64_t expiry_;
+            /** The ticks between firings, zero to fire once. */
+            std::uint64_t period_;
+            /** The callback. */
+            Callback callback_;
+            /** The previous timer of the slot, or the next free one. */
+            std::uint32_t previous_;
+            /** The next timer of the slot. */
+            std::uint32_t next_;
+            /** The slot of the wheel holding it. */
+            std::uint32_t bucket_;
+            /** Bumped every time the timer is freed. */
+            std::uint32_t generation_;
+            /** Where it is in its life. */
+            TimerState state_;
+        };
+
+        /* ================================================================= */
+        /**
+         * Puts a timer in the slot of its expiry.
+         * @param index             The timer.
+        **/
+        /* ================================================================= */
+        void Insert(std::uint32_t index);
+        /* ================================================================= */
+        /**
+         * Takes a timer out of its slot.
+         * @param index             The timer.
+        **/
+        /* ================================================================= */
+        void Unlink(std::uint32_t index);
+        /* ================================================================= */
+        /**
+         * Hands a timer's slot back for reuse.
+         * @param index             The timer.
+        **/
+        /* ================================================================= */
+        void Release(std::uint32_t index);
+        /* ================================================================= */
+        /**
+         * Empties a slot of a coarse ring into the finer ones.
+         * @param level             The ring.
+         * @param slot              The slot.
+        **/
+        /* ================================================================= */
+        void Cascade(unsigned level, unsigned slot);
+        /* ================================================================= */
+        /**
+         * Finds the next tick where a slot fires or moves down a ring.
+         * @returns                 The tick, or UINT64_MAX with no timers.
+        **/
+        /* ================================================================= */
+        std::uint64_t FindNextTick() const;
+        /* ================================================================= */
+        /**
+         * Moves to the next tick and fires the timers due.
+        **/
+        /* ================================================================= */
+        void Tick();
+
+        /** The seconds per tick. */
+        double tick_;
+        /** The seconds since the wheel was created. */
+        double time_;
+        /** The tick the wheel is on. */
+        std::uint64_t current_;
+        /** Every timer ever made, live or free. */
+        std::vector<Timer> timers_;
+        /** The first timer of every slot, ring after ring. */
+        std::vector<std::uint32_t> buckets_;
+        /** One bit per slot holding timers, ring after ring. */
+        std::vector<std::uint64_t> occupied_;
+        /** The first free timer. */
+        std::uint32_t free_;
+        /** The number of pending timers. */
+        size_t pending_;
+        /** The timers firing this tick, kept to reuse its memory. */
+        std::vector<std::uint32_t> firing_;
+    };
+}
+
+/* ========================================================================= */
+#endif // TimerWheel_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,144 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Transform.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * The local position, rotation and scale of a Node, along with its cached
+ * world matrix.
+ * Changing a transform only marks it dirty, the world matrices get
+ * recomputed in bulk by the TransformHierarchy.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef Transform_MODULE_H
+#define Transform_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Math/Math.hpp"
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * The spatial part of a node in the hierarchy.
+    **/
+    /* ===================================================================== */
+    class Transform final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates an identity transform without a parent.
+        **/
+        /* ================================================================= */
+        Transform();
+        /* ================================================================= */
+        /**
+         * Sets the position relative to the parent.
+         * @param position          The new local position.
+        **/
+        /* ================================================================= */
+        void SetPosition(Math::Vec3 const &position);
+        /* ================================================================= */
+        /**
+         * Sets the rotation relative to the parent.
+         * @param rotation          The new local rotation.
+        **/
+        /* ================================================================= */
+        void SetRotation(Math::Quat const &rotation);
+        /* ================================================================= */
+        /**
+         * Sets the scale relative to the parent.
+         * @param scale             The new local scale.
+        **/
+        /* ================================================================= */
+        void SetScale(Math::Vec3 const &scale);
+
+        /* ================================================================= */
+        /**
+         * Gets the position relative to the parent.
+         * @returns                 The local position.
+        **/
+        /* ================================================================= */
+        Math::Vec3 const &GetPosition() const;
+        /* ================================================================= */
+        /**
+         * Gets the rotation relative to the parent.
+         * @returns                 The local rotation.
+        **/
+        /* ================================================================= */
+        Math::Quat const &GetRotation() const;
+        /* ================================================================= */
+        /**
+         * Gets the scale relative to the parent.
+         * @returns                 The local scale.
+        **/
+        /* ================================================================= */
+        Math::Vec3 const &GetScale() const;
+        /* ================================================================= */
+        /**
+         * Gets the matrix going from this transform's space to its parent's.
+         * @returns                 The local matrix.
+        **/
+        /* ================================================================= */
+        Math::Mat4 GetLocalMatrix() const;
+        /* ================================================================= */
+        /**
+         * Gets the cached matrix going from this transform's space to
+         * world space. It is only up to date after the hierarchy was
+         * updated since the last change.
+         * @returns                 The cached world matrix.
+        **/
+        /* ================================================================= */
+        Math::Mat4 const &GetWorldMatrix() const;
+        /* ================================================================= */
+        /**
+         * Gets whether the world matrix is waiting to be recomputed.
+         * @returns                 True if this transform changed since
+         *                          the last hierarchy update.
+        **/
+        /* ================================================================= */
+        bool IsDirty() const;
+    private:
+        friend class Node;
+        friend class TransformHierarchy;
+
+        /* ================================================================= */
+        /**
+         * Marks the transform dirty and lets every ancestor know that
+         * something underneath it needs updating.
+        **/
+        /* ================================================================= */
+        void MarkDirty();
+
+        /** The position relative to the parent. */
+        Math::Vec3 position_;
+        /** The rotation relative to the parent. */
+        Math::Quat rotation_;
+        /** The scale relative to the parent. */
+        Math::Vec3 scale_;
+        /** The cached world matrix. */
+        Math::Mat4 world_;
+        /** The transform of the parent node, null at the root. */
+        Transform *parent_;
+        /** Set when this transform changed since the last update. */
+        bool dirty_;
+        /** Set when some descendant changed since the last update. */
+        bool childDirty_;
+
+        // Only the local part is state, the rest is rebuilt from it.
+        LUDUS_REFLECT(Transform, LUDUS_FIELD(position_), LUDUS_FIELD(rotation_),
+            LUDUS_FIELD(scale_))
+    };
+}
+
+/* ========================================================================= */
+#endif // Transform_MODULE_H
+/* ========================================================================= */
@@ -0,0 +1,143 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            TransformHierarchy.hpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Recomputes the world matrices of every dirty subtree of a Node hierarchy.
+ * The dirty transforms are gathered breadth first into arrays ordered by
+ * depth, so every level only reads the finished level before it and the
+ * entries of a level can be processed in any order, or in parallel.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+#ifndef TransformHierarchy_MODULE_H
+#define TransformHierarchy_MODULE_H
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Math/Math.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Ludus
+{
+    /** Forward declaration to the Node. */
+    class Node;
+    /** Forward declaration to the JobSystem. */
+    class JobSystem;
+    /** Forward declaration to the Transform. */
+    class Transform;
+
+    /* ===================================================================== */
+    /**
+     * Updates the world matrices of a hierarchy of nodes.
+     * The arrays used are kept between updates so steady state updates
+     * do not allocate.
+    **/
+    /* ===================================================================== */
+    class TransformHierarchy final
+    {
+    public:
+        /* ================================================================= */
+        /**
+         * Creates the updater.
+         * @param jobs              The job system used to process wide
+         *                          levels in parallel, or null to update
+         *                          on the calling thread only.
+        **/
+        /* ================================================================= */
+        explicit TransformHierarchy(JobSystem *jobs = nullptr);
+        /* ================================================================= */
+        /**
+         * Recomputes the world matrix of every dirty transform under root
+         * and of all their descendants. Clean subtrees are not visited.
+         * @param root              The root of the hierarchy to update.
+        **/
+        /* ================================================================= */
+        void Update(Node &root);
+        /* ================================================================= */
+        /**
+         * Sets the smallest number of transforms handed to a single job.
+         * @param grain             The number of transforms per job.
+        **/
+        /* ================================================================= */
+        void SetGrainSize(size_t grain);
+        /* ================================================================= */
+        /**
+         * Gets how many world matrices the last update recomputed.
+         * @returns                 The number of transforms updated.
+        **/
+        /* ================================================================= */
+        size_t GetUpdatedCount() const;
+        /* ================================================================= */
+        /**
+         * Gets how many levels of the hierarchy the last update touched.
+         * @returns                 The number of levels updated.
+        **/
+        /* ================================================================= */
+        size_t GetLevelCount() const;
+    private:
+        /* ================================================================= */
+        /**
+         * Walks the hierarchy and fills the level ordered arrays with the
+         * transforms that need updating, clearing their dirty flags.
+         * @param root              The root of the hierarchy.
+        **/
+        /* ================================================================= */
+        void Gather(Node &root);
+        /* ================================================================= */
+        /**
+         * Computes the world matrices of a range of entries of a level.
+         * @param begin             The first entry to compute.
+         * @param end               One past the last entry to compute.
+        **/
+        /* ================================================================= */
+        void Compute(size_t begin, size_t end);
+
+        /* ================================================================= */
+        /** A node waiting to be visited by the breadth first walk. */
+        /* ================================================================= */
+        struct Pending
+        {
+            /** The node to visit. */
+            Node *node_;
+            /** The entry of the parent in the arrays, or -1. */
+            std::int32_t parent_;
+            /** Whether an ancestor was dirty. */
+            bool inherited_;
+        };
+
+        /** The transforms being updated. */
+        std::vector<Transform *> transforms_;
+        /** The entry of each transform's parent, or -1 for subtree roots. */
+        std::vector<std::int32_t> parents_;
+        /** The local position of every entry. */
+        std::vector<Math::Vec3> positions_;
+        /** The local rotation of every entry. */
+        std::vector<Math::Quat> rotations_;
+        /** The local scale of every entry. */
+        std::vector<Math::Vec3> scales_;
+        /** The world matrix computed for every entry. */
+        std::vector<Math::Mat4> worlds_;
+        /** The first entry of every level, plus one past the last entry. */
+        std::vector<size_t> levels_;
+        /** The nodes of the level being visited. */
+        std::vector<Pending> frontier_;
+        /** The nodes of the next level to visit. */
+        std::vector<Pending> next_;
+        /** The job system used to run levels in parallel. */
+        JobSystem *jobs_;
+        /** The smallest number of transforms per job. */
+        size_t grain_;
+    };
+}
+
+/* ========================================================================= */
+#endif // TransformHierarchy_MODULE_H
+/* ========================================================================= */
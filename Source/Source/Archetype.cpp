@@ -0,0 +1,262 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Archetype.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Stores every entity that has exactly the same set of components.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Entity/Archetype.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Rounds an offset up to an alignment.
+     * @param offset                The offset to round.
+     * @param alignment             The alignment, a power of two.
+     * @returns                     The rounded offset.
+    **/
+    /* ===================================================================== */
+    static size_t AlignUp(size_t offset, size_t alignment)
+    {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+    Chunk::Chunk(size_t columnCount) :
+        data_(static_cast<unsigned char *>(::operator new(Size,
+            std::align_val_t(Alignment)))), count_(0),
+        versions_(columnCount * 2, 0)
+    {
+    }
+
+    void Chunk::Deleter::operator()(unsigned char *data) const
+    {
+        ::operator delete(data, std::align_val_t(Alignment));
+    }
+
+    size_t Chunk::GetCount() const
+    {
+        return count_;
+    }
+
+    Entity *Chunk::GetEntities() const
+    {
+        return reinterpret_cast<Entity *>(data_.get());
+    }
+
+    void *Chunk::GetColumn(size_t offset) const
+    {
+        return data_.get() + offset;
+    }
+
+    std::uint32_t Chunk::GetChangedVersion(size_t column) const
+    {
+        return versions_[column * 2];
+    }
+
+    std::uint32_t Chunk::GetAddedVersion(size_t column) const
+    {
+        return versions_[column * 2 + 1];
+    }
+
+    void Chunk::MarkChanged(size_t column, std::uint32_t version)
+    {
+        std::uint32_t &changed = versions_[column * 2];
+        if(IsNewerVersion(version, changed))
+        {
+            changed = version;
+        }
+    }
+
+    void Chunk::MarkAdded(size_t column, std::uint32_t version)
+    {
+        MarkChanged(column, version);
+        std::uint32_t &added = versions_[column * 2 + 1];
+        if(IsNewerVersion(version, added))
+        {
+            added = version;
+        }
+    }
+
+    Archetype::Archetype(Signature signature) :
+        signature_(signature), capacity_(0), size_(0)
+    {
+        size_t rowSize = sizeof(Entity);
+        for(ComponentId id = 0; id < MaxComponents; ++id)
+        {
+            if(signature & (Signature(1) << id))
+            {
+                ComponentInfo const &info = ComponentRegistry::GetInfo(id);
+                columns_.push_back(Column{ id, 0, &info });
+                rowSize += info.size_;
+            }
+        }
+
+        // Start from the ideal row count and back off until the padding
+        // between the columns fits too.
+        for(capacity_ = Chunk::Size / rowSize; capacity_ > 0; --capacity_)
+        {
+            size_t offset = sizeof(Entity) * capacity_;
+            for(Column &column : columns_)
+            {
+                offset = AlignUp(offset, std::max(column.info_->alignment_,
+                    Chunk::Alignment));
+                column.offset_ = offset;
+                offset += column.info_->size_ * capacity_;
+            }
+            if(offset <= Chunk::Size)
+            {
+                break;
+            }
+        }
+        if(capacity_ == 0)
+        {
+            throw std::length_error("The components of an entity don't fit in a chunk.");
+        }
+    }
+
+    Archetype::~Archetype()
+    {
+        for(Chunk &chunk : chunks_)
+        {
+            for(Column const &column : columns_)
+            {
+                unsigned char *data = static_cast<unsigned char *>(
+                    chunk.GetColumn(column.offset_));
+                for(size_t row = 0; row < chunk.count_; ++row)
+                {
+                    column.info_->destroy_(data + row * column.info_->size_);
+                }
+            }
+        }
+    }
+
+    size_t Archetype::Allocate(Entity entity)
+    {
+        if(size_ == chunks_.size() * capacity_)
+        {
+            chunks_.emplace_back(columns_.size());
+        }
+        Chunk &chunk = chunks_[size_ / capacity_];
+        chunk.GetEntities()[chunk.count_++] = entity;
+        return size_++;
+    }
+
+    Entity Archetype::Remove(size_t row)
+    {
+        size_t const last = size_ - 1;
+        Chunk &lastChunk = chunks_[last / capacity_];
+        Entity const moved = lastChunk.GetEntities()[last % capacity_];
+        if(row != last)
+        {
+            Chunk &chunk = chunks_[row / capacity_];
+            chunk.GetEntities()[row % capacity_] = moved;
+            for(size_t i = 0; i < columns_.size(); ++i)
+            {
+                columns_[i].info_->move_(GetComponent(row, columns_[i]),
+                    GetComponent(last, columns_[i]));
+                // The moved entity must not hide a change from a query.
+                chunk.MarkChanged(i, lastChunk.GetChangedVersion(i));
+                chunk.MarkAdded(i, lastChunk.GetAddedVersion(i));
+            }
+        }
+        --lastChunk.count_;
+        --size_;
+        // Keep one spare chunk around so an entity bouncing in and out
+        // doesn't allocate every time.
+        if(chunks_.size() > 1 && size_ <= (chunks_.size() - 2) * capacity_)
+        {
+            chunks_.pop_back();
+        }
+        return moved;
+    }
+
+    void *Archetype::GetComponent(size_t row, ComponentId id) const
+    {
+        for(Column const &column : columns_)
+        {
+            if(column.id_ == id)
+            {
+                return GetComponent(row, column);
+            }
+        }
+        return nullptr;
+    }
+
+    Chunk &Archetype::GetChunkOf(size_t row)
+    {
+        return chunks_[row / capacity_];
+    }
+
+    Signature Archetype::GetSignature() const
+    {
+        return signature_;
+    }
+
+    size_t Archetype::GetColumnOffset(ComponentId id) const
+    {
+        for(Column const &column : columns_)
+        {
+            if(column.id_ == id)
+            {
+                return column.offset_;
+            }
+        }
+        return NoColumn;
+    }
+
+    size_t Archetype::GetColumnIndex(ComponentId id) const
+    {
+        for(size_t i = 0; i < columns_.size(); ++i)
+        {
+            if(columns_[i].id_ == id)
+            {
+                return i;
+            }
+        }
+        return NoColumn;
+    }
+
+    size_t Archetype::GetSize() const
+    {
+        return size_;
+    }
+
+    size_t Archetype::GetChunkCapacity() const
+    {
+        return capacity_;
+    }
+
+    size_t Archetype::GetChunkCount() const
+    {
+        return chunks_.size();
+    }
+
+    Chunk const &Archetype::GetChunk(size_t chunk) const
+    {
+        return chunks_[chunk];
+    }
+
+    Chunk &Archetype::GetChunk(size_t chunk)
+    {
+        return chunks_[chunk];
+    }
+
+    void *Archetype::GetComponent(size_t row, Column const &column) const
+    {
+        Chunk const &chunk = chunks_[row / capacity_];
+        return static_cast<unsigned char *>(chunk.GetColumn(column.offset_)) +
+            (row % capacity_) * column.info_->size_;
+    }
+}
@@ -0,0 +1,447 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            AssetManager.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Streams assets from disk without stalling the frame.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Assets/AssetManager.hpp"
+#include "Ludus/Assets/FileWatcher.hpp"
+#include "Ludus/Assets/Pack.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <algorithm>
+#include <deque>
+
+namespace Ludus
+{
+    /** The most loads an I/O thread takes off the queue at once. */
+    static constexpr size_t LoadBatch = 16;
+
+    /* ===================================================================== */
+    /** The bytes of an asset on their way. */
+    /* ===================================================================== */
+    struct AssetManager::PendingRead
+    {
+        /** The pack holding the asset, or null for a loose file. */
+        std::shared_ptr<PackReader const> pack_;
+        /** The loose file, once read. */
+        FileRead file_;
+        /** Guards file_ and done_. */
+        std::mutex mutex_;
+        /** Signalled once the loose file is read. */
+        std::condition_variable read_;
+        /** Whether the loose file was read. */
+        bool done_ = false;
+    };
+
+    std::string AssetLoader<std::string>::Load(std::vector<std::uint8_t> &&bytes)
+    {
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+    bool AssetManager::Request::operator<(Request const &rhs) const
+    {
+        if(priority_ != rhs.priority_)
+        {
+            return priority_ < rhs.priority_;
+        }
+        return sequence_ > rhs.sequence_;
+    }
+
+    AssetManager::AssetManager() :
+        AssetManager(2)
+    {
+    }
+
+    AssetManager::AssetManager(unsigned threadCount, FileBackend backend) :
+        Node("AssetManager"), sequence_(0), pending_(0), stopping_(false),
+        reads_(std::make_unique<JobSystem>(1))
+    {
+        threadCount = std::max(threadCount, 1u);
+        reader_ = std::make_unique<FileReader>(*reads_, backend, threadCount);
+        workers_.reserve(threadCount);
+        for(unsigned i = 0; i < threadCount; ++i)
+        {
+            workers_.emplace_back(&AssetManager::WorkerLoop, this);
+        }
+    }
+
+    AssetManager::~AssetManager()
+    {
+        // The watcher reports changes from its thread, straight into here.
+        watcher_.reset();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        available_.notify_all();
+        for(std::thread &worker : workers_)
+        {
+            worker.join();
+        }
+        // The callbacks may hold handles to their own slot.
+        for(std::shared_ptr<AssetSlot> const &slot : completed_)
+        {
+            slot->callbacks_.clear();
+        }
+        while(!queue_.empty())
+        {
+            queue_.top().slot_->callbacks_.clear();
+            queue_.pop();
+        }
+    }
+
+    void AssetManager::BeginFrame()
+    {
+        std::vector<std::shared_ptr<AssetSlot> > completed;
+        std::vector<std::shared_ptr<AssetSlot> > swaps;
+        std::vector<AssetSlot::Callback> callbacks;
+        bool requeued = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed.swap(completed_);
+            swaps.swap(swaps_);
+        }
+        for(std::shared_ptr<AssetSlot> const &slot : swaps)
+        {
+            std::shared_ptr<void const> reloaded;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                reloaded = std::move(slot->reloaded_);
+                slot->reloading_ = false;
+                // A failed reload keeps the asset there was.
+                if(!reloaded)
+                {
+                    slot->error_ = std::move(slot->reloadError_);
+                }
+                if(slot->changed_)
+                {
+                    QueueReload(slot);
+                    requeued = true;
+                }
+            }
+            if(reloaded)
+            {
+                // All the main thread pays for a reload.
+                slot->value_.swap(reloaded);
+                slot->error_.clear();
+                slot->state_.store(AssetState::READY, std::memory_order_release);
+                ++slot->version_;
+            }
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        for(std::shared_ptr<AssetSlot> const &slot : completed)
+        {
+            {
+                // Load may be adding callbacks to a finished slot.
+                std::lock_guard<std::mutex> lock(mutex_);
+                callbacks.swap(slot->callbacks_);
+                // The file changed while it was first loading.
+                if(slot->changed_ && !slot->reloading_)
+                {
+                    QueueReload(slot);
+                    requeued = true;
+                }
+            }
+            for(AssetSlot::Callback const &callback : callbacks)
+            {
+                callback(slot);
+            }
+            callbacks.clear();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        if(requeued)
+        {
+            available_.notify_all();
+        }
+    }
+
+    void AssetManager::Mount(std::shared_ptr<PackReader const> pack)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        packs_.push_back(std::move(pack));
+    }
+
+    void AssetManager::SetHotReload(bool enabled)
+    {
+        std::unique_ptr<FileWatcher> watcher;
+        if(enabled)
+        {
+            watcher = std::make_unique<FileWatcher>([this](std::string const &path)
+                { OnFileChanged(path); });
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(enabled == static_cast<bool>(watcher_))
+            {
+                return;
+            }
+            watcher_.swap(watcher);
+            watched_.clear();
+            for(auto const &cached : cache_)
+            {
+                std::shared_ptr<AssetSlot> const slot = cached.second.lock();
+                if(slot && watcher_)
+                {
+                    Watch(slot);
+                }
+            }
+        }
+        // The old watcher may be waiting on the mutex to report a change.
+        watcher.reset();
+    }
+
+    size_t AssetManager::GetPendingCount() const
+    {
+        return pending_.load(std::memory_order_relaxed);
+    }
+
+    FileBackend AssetManager::GetFileBackend() const
+    {
+        return reader_->GetBackend();
+    }
+
+    std::shared_ptr<AssetSlot> AssetManager::Enqueue(std::string const &key,
+        std::string const &path, AssetPriority priority,
+        AssetSlot::Decoder decoder, AssetSlot::Callback callback)
+    {
+        bool queued = false;
+        std::shared_ptr<AssetSlot> slot;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::weak_ptr<AssetSlot> &cached = cache_[key];
+            slot = cached.lock();
+            if(!slot)
+            {
+                slot = std::make_shared<AssetSlot>();
+                slot->path_ = path;
+                slot->decoder_ = std::move(decoder);
+                slot->state_.store(AssetState::QUEUED, std::memory_order_relaxed);
+                slot->priority_ = priority;
+                slot->version_ = 0;
+                slot->reloading_ = false;
+                slot->changed_ = false;
+                cached = slot;
+                queue_.push(Request{ slot, priority, sequence_++, false });
+                pending_.fetch_add(1, std::memory_order_relaxed);
+                queued = true;
+                if(watcher_)
+                {
+                    Watch(slot);
+                }
+            }
+            else if(priority > slot->priority_
+                && slot->state_.load(std::memory_order_relaxed) == AssetState::QUEUED)
+            {
+                // The old request stays in the queue, whoever gets to the
+                // slot first loads it and the other one is skipped.
+                slot->priority_ = priority;
+                queue_.push(Request{ slot, priority, sequence_++, false });
+                queued = true;
+            }
+
+            if(callback)
+            {
+                AssetState const state = slot->state_.load(std::memory_order_relaxed);
+                bool const done = state == AssetState::READY
+                    || state == AssetState::FAILED;
+                // A finished slot with nothing left to deliver has to be
+                // handed back again for this callback.
+                if(done && slot->callbacks_.empty())
+                {
+                    completed_.push_back(slot);
+                    pending_.fetch_add(1, std::memory_order_relaxed);
+                }
+                slot->callbacks_.push_back(std::move(callback));
+            }
+        }
+        if(queued)
+        {
+            available_.notify_one();
+        }
+        return slot;
+    }
+
+    void AssetManager::StartRead(std::string const &path,
+        std::vector<std::shared_ptr<PackReader const> > const &packs, PendingRead &read)
+    {
+        auto const pack = std::find_if(packs.rbegin(), packs.rend(),
+            [&path](std::shared_ptr<PackReader const> const &mounted)
+            { return mounted->Contains(path); });
+        if(pack != packs.rend())
+        {
+            read.pack_ = *pack;
+            return;
+        }
+        reader_->Read({ path }, [&read](FileRead &file)
+            {
+                // Notified under the lock, the read is gone once it's let go.
+                std::lock_guard<std::mutex> lock(read.mutex_);
+                read.file_ = std::move(file);
+                read.done_ = true;
+                read.read_.notify_one();
+            });
+    }
+
+    std::vector<std::uint8_t> AssetManager::FinishRead(std::string const &path,
+        PendingRead &read)
+    {
+        if(read.pack_)
+        {
+            return read.pack_->Read(path);
+        }
+        // Sleeps through the disk read instead of spinning on a counter.
+        std::unique_lock<std::mutex> lock(read.mutex_);
+        read.read_.wait(lock, [&read]() { return read.done_; });
+        if(!read.file_.error_.empty())
+        {
+            throw std::runtime_error(read.file_.error_);
+        }
+        return std::move(read.file_.bytes_);
+    }
+
+    void AssetManager::Fetch(AssetSlot &slot, PendingRead &read)
+    {
+        try
+        {
+            slot.value_ = slot.decoder_(FinishRead(slot.path_, read));
+            slot.state_.store(AssetState::READY, std::memory_order_release);
+        }
+        catch(std::exception const &error)
+        {
+            slot.error_ = error.what();
+            slot.state_.store(AssetState::FAILED, std::memory_order_release);
+        }
+    }
+
+    void AssetManager::Reload(std::shared_ptr<AssetSlot> const &slot, PendingRead &read)
+    {
+        // The asset in use stays untouched until BeginFrame swaps it out.
+        std::shared_ptr<void const> reloaded;
+        std::string error;
+        try
+        {
+            reloaded = slot->decoder_(FinishRead(slot->path_, read));
+        }
+        catch(std::exception const &exception)
+        {
+            error = exception.what();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        slot->reloaded_ = std::move(reloaded);
+        slot->reloadError_ = std::move(error);
+        swaps_.push_back(slot);
+    }
+
+    void AssetManager::Watch(std::shared_ptr<AssetSlot> const &slot)
+    {
+        std::string const path = FileWatcher::Normalize(slot->path_);
+        watched_[path].push_back(slot);
+        watcher_->Add(path);
+    }
+
+    void AssetManager::QueueReload(std::shared_ptr<AssetSlot> const &slot)
+    {
+        slot->reloading_ = true;
+        slot->changed_ = false;
+        queue_.push(Request{ slot, slot->priority_, sequence_++, true });
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AssetManager::OnFileChanged(std::string const &path)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto const found = watched_.find(path);
+            if(found == watched_.end())
+            {
+                return;
+            }
+            std::vector<std::weak_ptr<AssetSlot> > &slots = found->second;
+            for(auto watched = slots.begin(); watched != slots.end();)
+            {
+                std::shared_ptr<AssetSlot> const slot = watched->lock();
+                if(!slot)
+                {
+                    watched = slots.erase(watched);
+                    continue;
+                }
+                ++watched;
+                AssetState const state = slot->state_.load(std::memory_order_relaxed);
+                // Assets still loading or reloading go again once done.
+                if(slot->reloading_ || state == AssetState::QUEUED ||
+                    state == AssetState::LOADING)
+                {
+                    slot->changed_ = true;
+                    continue;
+                }
+                QueueReload(slot);
+            }
+            if(slots.empty())
+            {
+                watched_.erase(found);
+            }
+        }
+        available_.notify_all();
+    }
+
+    void AssetManager::WorkerLoop()
+    {
+        std::vector<Request> batch;
+        std::vector<std::shared_ptr<PackReader const> > packs;
+        for(;;)
+        {
+            batch.clear();
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                available_.wait(lock, [this]()
+                    { return stopping_ || !queue_.empty(); });
+                if(stopping_)
+                {
+                    return;
+                }
+                while(!queue_.empty() && batch.size() < LoadBatch)
+                {
+                    batch.push_back(queue_.top());
+                    queue_.pop();
+                }
+                packs = packs_;
+            }
+            // A slot queued again at a higher priority is only loaded once.
+            batch.erase(std::remove_if(batch.begin(), batch.end(), [](Request const &request)
+                {
+                    AssetState expected = AssetState::QUEUED;
+                    return !request.reload_ && !request.slot_->state_.compare_exchange_strong(
+                        expected, AssetState::LOADING, std::memory_order_acq_rel);
+                }), batch.end());
+
+            // Every file of the batch is read at once, then decoded in order.
+            std::deque<PendingRead> reads(batch.size());
+            for(size_t i = 0; i < batch.size(); ++i)
+            {
+                StartRead(batch[i].slot_->path_, packs, reads[i]);
+            }
+            for(size_t i = 0; i < batch.size(); ++i)
+            {
+                std::shared_ptr<AssetSlot> &slot = batch[i].slot_;
+                if(batch[i].reload_)
+                {
+                    Reload(slot, reads[i]);
+                    continue;
+                }
+                Fetch(*slot, reads[i]);
+                std::lock_guard<std::mutex> lock(mutex_);
+                completed_.push_back(std::move(slot));
+            }
+        }
+    }
+}
@@ -0,0 +1,265 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Batch.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides kernels running the same math operation over many values.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Math/Batch.hpp"
+
+namespace Ludus
+{
+    namespace Math
+    {
+        namespace Scalar
+        {
+            void TransformPoints(Mat4 const &mat, PointStream points,
+                PointOutput output, size_t count)
+            {
+                float const *m = mat.m_;
+                for(size_t i = 0; i < count; ++i)
+                {
+                    float const x = points.x_[i];
+                    float const y = points.y_[i];
+                    float const z = points.z_[i];
+                    output.x_[i] = m[0] * x + m[4] * y + m[8]  * z + m[12];
+                    output.y_[i] = m[1] * x + m[5] * y + m[9]  * z + m[13];
+                    output.z_[i] = m[2] * x + m[6] * y + m[10] * z + m[14];
+                }
+            }
+
+            void ProjectPoints(Mat4 const &mat, PointStream points,
+                Vec4Stream output, size_t count)
+            {
+                float const *m = mat.m_;
+                for(size_t i = 0; i < count; ++i)
+                {
+                    float const x = points.x_[i];
+                    float const y = points.y_[i];
+                    float const z = points.z_[i];
+                    output.x_[i] = m[0] * x + m[4] * y + m[8]  * z + m[12];
+                    output.y_[i] = m[1] * x + m[5] * y + m[9]  * z + m[13];
+                    output.z_[i] = m[2] * x + m[6] * y + m[10] * z + m[14];
+                    output.w_[i] = m[3] * x + m[7] * y + m[11] * z + m[15];
+                }
+            }
+
+            /* ============================================================= */
+            /**
+             * Multiplies a single pair of matrices the textbook way.
+             * @param lhs           The matrix on the left hand side.
+             * @param rhs           The matrix on the right hand side.
+             * @returns             The product.
+            **/
+            /* ============================================================= */
+            static Mat4 Multiply(Mat4 const &lhs, Mat4 const &rhs)
+            {
+                Mat4 result;
+                for(unsigned column = 0; column < 4; ++column)
+                {
+                    for(unsigned row = 0; row < 4; ++row)
+                    {
+                        float sum = 0.0f;
+                        for(unsigned k = 0; k < 4; ++k)
+                        {
+                            sum += lhs.m_[k * 4 + row] * rhs.m_[column * 4 + k];
+                        }
+                        result.m_[column * 4 + row] = sum;
+                    }
+                }
+                return result;
+            }
+
+            void MultiplyMatrices(Mat4 const *lhs, Mat4 const *rhs,
+                Mat4 *output, size_t count)
+            {
+                for(size_t i = 0; i < count; ++i)
+                {
+                    output[i] = Multiply(lhs[i], rhs[i]);
+                }
+            }
+
+            void MultiplyMatrices(Mat4 const &lhs, Mat4 const *rhs,
+                Mat4 *output, size_t count)
+            {
+                for(size_t i = 0; i < count; ++i)
+                {
+                    output[i] = Multiply(lhs, rhs[i]);
+                }
+            }
+
+            void NormalizeQuats(QuatStream quats, size_t count)
+            {
+                for(size_t i = 0; i < count; ++i)
+                {
+                    float const x = quats.x_[i], y = quats.y_[i];
+                    float const z = quats.z_[i], w = quats.w_[i];
+                    float const length = std::sqrt(x * x + y * y + z * z + w * w);
+                    quats.x_[i] = x / length;
+                    quats.y_[i] = y / length;
+                    quats.z_[i] = z / length;
+                    quats.w_[i] = w / length;
+                }
+            }
+        }
+
+#if defined(LUDUS_SIMD_SCALAR)
+        void TransformPoints(Mat4 const &mat, PointStream points,
+            PointOutput output, size_t count)
+        {
+            Scalar::TransformPoints(mat, points, output, count);
+        }
+
+        void ProjectPoints(Mat4 const &mat, PointStream points,
+            Vec4Stream output, size_t count)
+        {
+            Scalar::ProjectPoints(mat, points, output, count);
+        }
+
+        void MultiplyMatrices(Mat4 const *lhs, Mat4 const *rhs, Mat4 *output,
+            size_t count)
+        {
+            Scalar::MultiplyMatrices(lhs, rhs, output, count);
+        }
+
+        void MultiplyMatrices(Mat4 const &lhs, Mat4 const *rhs, Mat4 *output,
+            size_t count)
+        {
+            Scalar::MultiplyMatrices(lhs, rhs, output, count);
+        }
+
+        void NormalizeQuats(QuatStream quats, size_t count)
+        {
+            Scalar::NormalizeQuats(quats, count);
+        }
+#else
+        void TransformPoints(Mat4 const &mat, PointStream points,
+            PointOutput output, size_t count)
+        {
+            using namespace Simd;
+            // Every element of the matrix gets its own register so four
+            // points go through each multiply.
+            float const *m = mat.m_;
+            Float4 const m0 = Splat(m[0]), m1 = Splat(m[1]), m2 = Splat(m[2]);
+            Float4 const m4 = Splat(m[4]), m5 = Splat(m[5]), m6 = Splat(m[6]);
+            Float4 const m8 = Splat(m[8]), m9 = Splat(m[9]), m10 = Splat(m[10]);
+            Float4 const m12 = Splat(m[12]), m13 = Splat(m[13]);
+            Float4 const m14 = Splat(m[14]);
+
+            size_t i = 0;
+            for(; i + Width <= count; i += Width)
+            {
+                Float4 const x = LoadUnaligned(points.x_ + i);
+                Float4 const y = LoadUnaligned(points.y_ + i);
+                Float4 const z = LoadUnaligned(points.z_ + i);
+                StoreUnaligned(output.x_ + i,
+                    MulAdd(m0, x, MulAdd(m4, y, MulAdd(m8, z, m12))));
+                StoreUnaligned(output.y_ + i,
+                    MulAdd(m1, x, MulAdd(m5, y, MulAdd(m9, z, m13))));
+                StoreUnaligned(output.z_ + i,
+                    MulAdd(m2, x, MulAdd(m6, y, MulAdd(m10, z, m14))));
+            }
+            // Finish whatever doesn't fill a register.
+            Scalar::TransformPoints(mat,
+                PointStream{ points.x_ + i, points.y_ + i, points.z_ + i },
+                PointOutput{ output.x_ + i, output.y_ + i, output.z_ + i },
+                count - i);
+        }
+
+        void ProjectPoints(Mat4 const &mat, PointStream points,
+            Vec4Stream output, size_t count)
+        {
+            using namespace Simd;
+            float const *m = mat.m_;
+            Float4 const m0 = Splat(m[0]), m1 = Splat(m[1]);
+            Float4 const m2 = Splat(m[2]), m3 = Splat(m[3]);
+            Float4 const m4 = Splat(m[4]), m5 = Splat(m[5]);
+            Float4 const m6 = Splat(m[6]), m7 = Splat(m[7]);
+            Float4 const m8 = Splat(m[8]), m9 = Splat(m[9]);
+            Float4 const m10 = Splat(m[10]), m11 = Splat(m[11]);
+            Float4 const m12 = Splat(m[12]), m13 = Splat(m[13]);
+            Float4 const m14 = Splat(m[14]), m15 = Splat(m[15]);
+
+            size_t i = 0;
+            for(; i + Width <= count; i += Width)
+            {
+                Float4 const x = LoadUnaligned(points.x_ + i);
+                Float4 const y = LoadUnaligned(points.y_ + i);
+                Float4 const z = LoadUnaligned(points.z_ + i);
+                StoreUnaligned(output.x_ + i,
+                    MulAdd(m0, x, MulAdd(m4, y, MulAdd(m8, z, m12))));
+                StoreUnaligned(output.y_ + i,
+                    MulAdd(m1, x, MulAdd(m5, y, MulAdd(m9, z, m13))));
+                StoreUnaligned(output.z_ + i,
+                    MulAdd(m2, x, MulAdd(m6, y, MulAdd(m10, z, m14))));
+                StoreUnaligned(output.w_ + i,
+                    MulAdd(m3, x, MulAdd(m7, y, MulAdd(m11, z, m15))));
+            }
+            Scalar::ProjectPoints(mat,
+                PointStream{ points.x_ + i, points.y_ + i, points.z_ + i },
+                Vec4Stream{ output.x_ + i, output.y_ + i, output.z_ + i,
+                    output.w_ + i }, count - i);
+        }
+
+        void MultiplyMatrices(Mat4 const *lhs, Mat4 const *rhs, Mat4 *output,
+            size_t count)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                output[i] = lhs[i] * rhs[i];
+            }
+        }
+
+        void MultiplyMatrices(Mat4 const &lhs, Mat4 const *rhs, Mat4 *output,
+            size_t count)
+        {
+            using namespace Simd;
+            // The columns of lhs stay in registers for the whole batch.
+            Float4 const c0 = lhs.Column(0), c1 = lhs.Column(1);
+            Float4 const c2 = lhs.Column(2), c3 = lhs.Column(3);
+            for(size_t i = 0; i < count; ++i)
+            {
+                for(unsigned column = 0; column < 4; ++column)
+                {
+                    float const *weights = rhs[i].m_ + column * 4;
+                    Float4 sum = Mul(c0, Splat(weights[0]));
+                    sum = MulAdd(c1, Splat(weights[1]), sum);
+                    sum = MulAdd(c2, Splat(weights[2]), sum);
+                    sum = MulAdd(c3, Splat(weights[3]), sum);
+                    Store(output[i].m_ + column * 4, sum);
+                }
+            }
+        }
+
+        void NormalizeQuats(QuatStream quats, size_t count)
+        {
+            using namespace Simd;
+            size_t i = 0;
+            for(; i + Width <= count; i += Width)
+            {
+                Float4 const x = LoadUnaligned(quats.x_ + i);
+                Float4 const y = LoadUnaligned(quats.y_ + i);
+                Float4 const z = LoadUnaligned(quats.z_ + i);
+                Float4 const w = LoadUnaligned(quats.w_ + i);
+                Float4 const length = Sqrt(
+                    MulAdd(x, x, MulAdd(y, y, MulAdd(z, z, Mul(w, w)))));
+                StoreUnaligned(quats.x_ + i, Div(x, length));
+                StoreUnaligned(quats.y_ + i, Div(y, length));
+                StoreUnaligned(quats.z_ + i, Div(z, length));
+                StoreUnaligned(quats.w_ + i, Div(w, length));
+            }
+            Scalar::NormalizeQuats(QuatStream{ quats.x_ + i, quats.y_ + i,
+                quats.z_ + i, quats.w_ + i }, count - i);
+        }
+#endif
+    }
+}
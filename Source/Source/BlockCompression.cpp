@@ -0,0 +1,186 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            BlockCompression.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Decodes the block compressed formats textures ship in.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/BlockCompression.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Ludus
+{
+    namespace
+    {
+        /* ================================================================= */
+        /**
+         * Widens a 5:6:5 color to 8 bits per channel, copying the top bits
+         * into the bottom ones so white stays white.
+         * @param packed            The 16 bit color.
+         * @param channels          Gets red, green and blue.
+        **/
+        /* ================================================================= */
+        void Expand565(unsigned packed, unsigned *channels)
+        {
+            unsigned const red = (packed >> 11) & 0x1F;
+            unsigned const green = (packed >> 5) & 0x3F;
+            unsigned const blue = packed & 0x1F;
+            channels[0] = (red << 3) | (red >> 2);
+            channels[1] = (green << 2) | (green >> 4);
+            channels[2] = (blue << 3) | (blue >> 2);
+        }
+
+        /* ================================================================= */
+        /**
+         * Decodes the color half of a block.
+         * @param block             The 8 bytes of colors and indices.
+         * @param alwaysOpaque      True in BC3, where the order of the
+         *                          two colors doesn't pick a mode.
+         * @param texels            Gets the 16 texels, alpha set to 255.
+        **/
+        /* ================================================================= */
+        void DecodeColors(std::uint8_t const *block, bool alwaysOpaque, Color *texels)
+        {
+            unsigned const first = block[0] | (block[1] << 8);
+            unsigned const second = block[2] | (block[3] << 8);
+            unsigned a[3], b[3];
+            Expand565(first, a);
+            Expand565(second, b);
+
+            Color palette[4];
+            palette[0] = PackColor(static_cast<std::uint8_t>(a[0]),
+                static_cast<std::uint8_t>(a[1]), static_cast<std::uint8_t>(a[2]));
+            palette[1] = PackColor(static_cast<std::uint8_t>(b[0]),
+                static_cast<std::uint8_t>(b[1]), static_cast<std::uint8_t>(b[2]));
+            if(alwaysOpaque || first > second)
+            {
+                // Two levels a third of the way from either color.
+                palette[2] = PackColor(static_cast<std::uint8_t>((2 * a[0] + b[0] + 1) / 3),
+                    static_cast<std::uint8_t>((2 * a[1] + b[1] + 1) / 3),
+                    static_cast<std::uint8_t>((2 * a[2] + b[2] + 1) / 3));
+                palette[3] = PackColor(static_cast<std::uint8_t>((a[0] + 2 * b[0] + 1) / 3),
+                    static_cast<std::uint8_t>((a[1] + 2 * b[1] + 1) / 3),
+                    static_cast<std::uint8_t>((a[2] + 2 * b[2] + 1) / 3));
+            }
+            else
+            {
+                palette[2] = PackColor(static_cast<std::uint8_t>((a[0] + b[0] + 1) / 2),
+                    static_cast<std::uint8_t>((a[1] + b[1] + 1) / 2),
+                    static_cast<std::uint8_t>((a[2] + b[2] + 1) / 2));
+                palette[3] = PackColor(0, 0, 0, 0);
+            }
+
+            std::uint32_t const indices = block[4] | (block[5] << 8) | (block[6] << 16) |
+                (static_cast<std::uint32_t>(block[7]) << 24);
+            for(unsigned texel = 0; texel < 16; ++texel)
+            {
+                texels[texel] = palette[(indices >> (texel * 2)) & 0x3];
+            }
+        }
+
+        /* ================================================================= */
+        /**
+         * Decodes a whole texture, block by block, cutting the blocks on
+         * the edges to the size of the texture.
+         * @param data              The blocks, row after row.
+         * @param size              The number of bytes.
+         * @param width             The width in texels.
+         * @param height            The height in texels.
+         * @param blockSize         The bytes of a block.
+         * @param decode            Decodes a block.
+         * @returns                 The texture.
+        **/
+        /* ================================================================= */
+        Texture DecodeBlocks(std::uint8_t const *data, size_t size, unsigned width,
+            unsigned height, size_t blockSize, void (*decode)(std::uint8_t const *, Color *))
+        {
+            unsigned const blocksPerRow = (width + 3) / 4;
+            unsigned const blockRows = (height + 3) / 4;
+            if(size < static_cast<size_t>(blocksPerRow) * blockRows * blockSize)
+            {
+                throw std::invalid_argument("There aren't enough blocks for the "
+                    "dimensions of the texture.");
+            }
+            Texture texture(width, height);
+            Color *texels = texture.GetData();
+            Color block[16];
+            for(unsigned blockY = 0; blockY < blockRows; ++blockY)
+            {
+                for(unsigned blockX = 0; blockX < blocksPerRow; ++blockX)
+                {
+                    decode(data, block);
+                    data += blockSize;
+                    unsigned const columns = std::min(4u, width - blockX * 4);
+                    unsigned const rows = std::min(4u, height - blockY * 4);
+                    for(unsigned row = 0; row < rows; ++row)
+                    {
+                        std::copy(block + row * 4, block + row * 4 + columns, texels +
+                            static_cast<size_t>(blockY * 4 + row) * width + blockX * 4);
+                    }
+                }
+            }
+            return texture;
+        }
+    }
+
+    void DecodeBC1Block(std::uint8_t const *block, Color *texels)
+    {
+        DecodeColors(block, false, texels);
+    }
+
+    void DecodeBC3Block(std::uint8_t const *block, Color *texels)
+    {
+        unsigned const first = block[0];
+        unsigned const second = block[1];
+        unsigned alphas[8] = { first, second };
+        if(first > second)
+        {
+            for(unsigned level = 1; level < 7; ++level)
+            {
+                alphas[level + 1] = ((7 - level) * first + level * second + 3) / 7;
+            }
+        }
+        else
+        {
+            for(unsigned level = 1; level < 5; ++level)
+            {
+                alphas[level + 1] = ((5 - level) * first + level * second + 2) / 5;
+            }
+            alphas[6] = 0;
+            alphas[7] = 255;
+        }
+
+        DecodeColors(block + 8, true, texels);
+        // Sixteen indices of three bits, the lowest first.
+        std::uint64_t indices = 0;
+        for(unsigned byte = 0; byte < 6; ++byte)
+        {
+            indices |= static_cast<std::uint64_t>(block[2 + byte]) << (byte * 8);
+        }
+        for(unsigned texel = 0; texel < 16; ++texel)
+        {
+            Color const alpha = alphas[(indices >> (texel * 3)) & 0x7];
+            texels[texel] = (texels[texel] & 0x00FFFFFFu) | (alpha << 24);
+        }
+    }
+
+    Texture DecodeBC1(std::uint8_t const *data, size_t size, unsigned width, unsigned height)
+    {
+        return DecodeBlocks(data, size, width, height, 8, &DecodeBC1Block);
+    }
+
+    Texture DecodeBC3(std::uint8_t const *data, size_t size, unsigned width, unsigned height)
+    {
+        return DecodeBlocks(data, size, width, height, 16, &DecodeBC3Block);
+    }
+}
@@ -0,0 +1,282 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Compression.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A small LZ codec and checksums for packed assets.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Assets/Compression.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace Ludus
+{
+    namespace Compression
+    {
+        /** The shortest match worth encoding. */
+        static constexpr size_t MinMatch = 4;
+        /** The farthest back a match may start. */
+        static constexpr size_t MaxOffset = 0xFFFF;
+        /** The number of bits of the match finder's hash. */
+        static constexpr unsigned HashBits = 12;
+        /** Marks an empty entry of the match finder. */
+        static constexpr std::uint32_t NoPosition = UINT32_MAX;
+        /** A length that doesn't fit its nibble continues in extra bytes. */
+        static constexpr size_t NibbleMax = 15;
+
+        /* ================================================================= */
+        /**
+         * Builds the lookup table of the CRC-32.
+         * @returns                 The remainder of every byte.
+        **/
+        /* ================================================================= */
+        static constexpr std::array<std::uint32_t, 256> BuildCrcTable()
+        {
+            std::array<std::uint32_t, 256> table{};
+            for(std::uint32_t byte = 0; byte < 256; ++byte)
+            {
+                std::uint32_t crc = byte;
+                for(unsigned bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ (crc & 1u ? 0xEDB88320u : 0u);
+                }
+                table[byte] = crc;
+            }
+            return table;
+        }
+
+        /** The remainder of every byte, for the CRC-32. */
+        static constexpr std::array<std::uint32_t, 256> CrcTable = BuildCrcTable();
+
+        /* ================================================================= */
+        /**
+         * Reads four bytes from anywhere.
+         * @param data              The first byte.
+         * @returns                 The bytes.
+        **/
+        /* ================================================================= */
+        static std::uint32_t Read32(std::uint8_t const *data)
+        {
+            std::uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        /* ================================================================= */
+        /**
+         * Writes the part of a length that didn't fit its nibble.
+         * @param out               The compressed block.
+         * @param length            The length, minus what the nibble held.
+        **/
+        /* ================================================================= */
+        static void WriteLength(std::vector<std::uint8_t> &out, size_t length)
+        {
+            for(; length >= 0xFF; length -= 0xFF)
+            {
+                out.push_back(0xFF);
+            }
+            out.push_back(static_cast<std::uint8_t>(length));
+        }
+
+        /* ================================================================= */
+        /**
+         * Reads the part of a length that didn't fit its nibble.
+         * @param in                The next byte to read, moved past the
+         *                          length.
+         * @param end               The end of the compressed block.
+         * @returns                 The extra length.
+        **/
+        /* ================================================================= */
+        static size_t ReadLength(std::uint8_t const *&in, std::uint8_t const *end)
+        {
+            size_t length = 0;
+            for(;;)
+            {
+                if(in == end)
+                {
+                    throw std::runtime_error("The compressed block is truncated.");
+                }
+                std::uint8_t const byte = *in++;
+                length += byte;
+                if(byte != 0xFF)
+                {
+                    return length;
+                }
+            }
+        }
+
+        /* ================================================================= */
+        /**
+         * Writes a sequence: some literals, then a match unless it's the
+         * last one.
+         * @param out               The compressed block.
+         * @param literals          The literals.
+         * @param literalCount      The number of literals.
+         * @param offset            How far back the match starts.
+         * @param matchLength       The length of the match, zero for the
+         *                          last sequence.
+        **/
+        /* ================================================================= */
+        static void WriteSequence(std::vector<std::uint8_t> &out,
+            std::uint8_t const *literals, size_t literalCount, size_t offset,
+            size_t matchLength)
+        {
+            size_t const match = matchLength ? matchLength - MinMatch : 0;
+            out.push_back(static_cast<std::uint8_t>(
+                (std::min(literalCount, NibbleMax) << 4) | std::min(match, NibbleMax)));
+            if(literalCount >= NibbleMax)
+            {
+                WriteLength(out, literalCount - NibbleMax);
+            }
+            out.insert(out.end(), literals, literals + literalCount);
+            if(!matchLength)
+            {
+                return;
+            }
+            out.push_back(static_cast<std::uint8_t>(offset));
+            out.push_back(static_cast<std::uint8_t>(offset >> 8));
+            if(match >= NibbleMax)
+            {
+                WriteLength(out, match - NibbleMax);
+            }
+        }
+
+        std::vector<std::uint8_t> Compress(std::uint8_t const *data, size_t size)
+        {
+            if(size > MaxBlockSize)
+            {
+                throw std::length_error("Blocks can't be bigger than 64 KiB.");
+            }
+            std::vector<std::uint8_t> out;
+            out.reserve(GetMaxCompressedSize(size));
+
+            // The last place every hashed group of four bytes was seen.
+            std::array<std::uint32_t, 1u << HashBits> seen;
+            seen.fill(NoPosition);
+            auto const hash = [](std::uint32_t bytes)
+            {
+                return (bytes * 2654435761u) >> (32 - HashBits);
+            };
+
+            size_t anchor = 0;
+            size_t position = 0;
+            while(position + MinMatch <= size)
+            {
+                std::uint32_t const bytes = Read32(data + position);
+                std::uint32_t &slot = seen[hash(bytes)];
+                size_t const candidate = slot;
+                slot = static_cast<std::uint32_t>(position);
+                if(candidate == NoPosition || position - candidate > MaxOffset ||
+                    Read32(data + candidate) != bytes)
+                {
+                    // Skip faster through data that doesn't compress.
+                    position += 1 + ((position - anchor) >> 6);
+                    continue;
+                }
+                size_t length = MinMatch;
+                while(position + length < size &&
+                    data[candidate + length] == data[position + length])
+                {
+                    ++length;
+                }
+                WriteSequence(out, data + anchor, position - anchor,
+                    position - candidate, length);
+                position += length;
+                anchor = position;
+            }
+            WriteSequence(out, data + anchor, size - anchor, 0, 0);
+            return out;
+        }
+
+        void Decompress(std::uint8_t const *data, size_t size, std::uint8_t *out,
+            size_t outSize)
+        {
+            std::uint8_t const *in = data;
+            std::uint8_t const *const end = data + size;
+            std::uint8_t *write = out;
+            std::uint8_t *const outEnd = out + outSize;
+            for(;;)
+            {
+                if(in == end)
+                {
+                    throw std::runtime_error("The compressed block is truncated.");
+                }
+                std::uint8_t const token = *in++;
+                size_t literals = token >> 4;
+                if(literals == NibbleMax)
+                {
+                    literals += ReadLength(in, end);
+                }
+                if(literals > size_t(end - in) || literals > size_t(outEnd - write))
+                {
+                    throw std::runtime_error("The compressed block is corrupt.");
+                }
+                std::memcpy(write, in, literals);
+                in += literals;
+                write += literals;
+                // The last sequence has no match.
+                if(in == end)
+                {
+                    break;
+                }
+
+                if(end - in < 2)
+                {
+                    throw std::runtime_error("The compressed block is truncated.");
+                }
+                size_t const offset = size_t(in[0]) | (size_t(in[1]) << 8);
+                in += 2;
+                size_t length = token & 0x0F;
+                if(length == NibbleMax)
+                {
+                    length += ReadLength(in, end);
+                }
+                length += MinMatch;
+                if(offset == 0 || offset > size_t(write - out) ||
+                    length > size_t(outEnd - write))
+                {
+                    throw std::runtime_error("The compressed block is corrupt.");
+                }
+                std::uint8_t const *match = write - offset;
+                if(offset >= length)
+                {
+                    std::memcpy(write, match, length);
+                    write += length;
+                }
+                else
+                {
+                    // The match overlaps what it writes, repeating a pattern.
+                    for(size_t i = 0; i < length; ++i)
+                    {
+                        *write++ = *match++;
+                    }
+                }
+            }
+            if(write != outEnd)
+            {
+                throw std::runtime_error("The compressed block has the wrong size.");
+            }
+        }
+
+        std::uint32_t Checksum(std::uint8_t const *data, size_t size)
+        {
+            std::uint32_t crc = 0xFFFFFFFFu;
+            for(size_t i = 0; i < size; ++i)
+            {
+                crc = (crc >> 8) ^ CrcTable[(crc ^ data[i]) & 0xFF];
+            }
+            return ~crc;
+        }
+    }
+}
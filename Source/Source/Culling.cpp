@@ -0,0 +1,127 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Culling.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Removes the instances outside of the view before anything gets
+ * transformed.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/Culling.hpp"
+#include "Ludus/Graphics/Mesh.hpp"
+#include <algorithm>
+
+namespace Ludus
+{
+    Frustum Frustum::FromMatrix(Math::Mat4 const &viewProjection)
+    {
+        // Every plane is the last row plus or minus one of the others.
+        float const *m = viewProjection.m_;
+        Math::Vec4 const rows[4] = {
+            Math::Vec4(m[0], m[4], m[8],  m[12]),
+            Math::Vec4(m[1], m[5], m[9],  m[13]),
+            Math::Vec4(m[2], m[6], m[10], m[14]),
+            Math::Vec4(m[3], m[7], m[11], m[15]),
+        };
+        Frustum frustum;
+        for(unsigned axis = 0; axis < 3; ++axis)
+        {
+            frustum.planes_[axis * 2] = rows[3] + rows[axis];
+            frustum.planes_[axis * 2 + 1] = rows[3] - rows[axis];
+        }
+        for(Math::Vec4 &plane : frustum.planes_)
+        {
+            float const length = Math::Length(
+                Math::Vec3(plane.x_, plane.y_, plane.z_));
+            plane = plane * (1.0f / length);
+        }
+        return frustum;
+    }
+
+    size_t InstanceCuller::Cull(Frustum const &frustum, Mesh const &mesh,
+        Instance const *instances, size_t count)
+    {
+        // Pad to whole registers with spheres that can never be seen.
+        size_t const padded = (count + Math::Simd::Width - 1) &
+            ~static_cast<size_t>(Math::Simd::Width - 1);
+        x_.resize(padded);
+        y_.resize(padded);
+        z_.resize(padded);
+        radius_.assign(padded, -1e30f);
+        visible_.clear();
+
+        Math::Vec3 const &center = mesh.GetBoundsCenter();
+        float const radius = mesh.GetBoundsRadius();
+        for(size_t i = 0; i < count; ++i)
+        {
+            Math::Mat4 const &transform = instances[i].transform_;
+            Math::Vec3 const world = Math::TransformPoint(transform, center);
+            x_[i] = world.x_;
+            y_[i] = world.y_;
+            z_[i] = world.z_;
+            // The sphere grows with the largest scale of the transform.
+            float largest = 0.0f;
+            for(unsigned column = 0; column < 3; ++column)
+            {
+                float const *axis = transform.m_ + column * 4;
+                largest = std::max(largest,
+                    axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+            }
+            radius_[i] = radius * std::sqrt(largest);
+        }
+
+        using namespace Math::Simd;
+        Float4 planes[6][4];
+        for(unsigned p = 0; p < 6; ++p)
+        {
+            planes[p][0] = Splat(frustum.planes_[p].x_);
+            planes[p][1] = Splat(frustum.planes_[p].y_);
+            planes[p][2] = Splat(frustum.planes_[p].z_);
+            planes[p][3] = Splat(frustum.planes_[p].w_);
+        }
+        for(size_t i = 0; i < padded; i += Width)
+        {
+            Float4 const x = LoadUnaligned(x_.data() + i);
+            Float4 const y = LoadUnaligned(y_.data() + i);
+            Float4 const z = LoadUnaligned(z_.data() + i);
+            Float4 const r = LoadUnaligned(radius_.data() + i);
+            // The smallest signed distance to any plane, pushed out by
+            // the radius: negative means fully outside one of them.
+            Float4 nearest = Splat(1e30f);
+            for(unsigned p = 0; p < 6; ++p)
+            {
+                Float4 const distance = MulAdd(planes[p][0], x,
+                    MulAdd(planes[p][1], y, MulAdd(planes[p][2], z,
+                    Add(planes[p][3], r))));
+                nearest = Min(nearest, distance);
+            }
+            int const outside = SignMask(nearest);
+            for(unsigned lane = 0; lane < Width; ++lane)
+            {
+                if(!(outside & (1 << lane)))
+                {
+                    visible_.push_back(static_cast<std::uint32_t>(i + lane));
+                }
+            }
+        }
+        return visible_.size();
+    }
+
+    std::uint32_t const *InstanceCuller::GetVisible() const
+    {
+        return visible_.data();
+    }
+
+    size_t InstanceCuller::GetVisibleCount() const
+    {
+        return visible_.size();
+    }
+}
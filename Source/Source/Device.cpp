@@ -0,0 +1,605 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Device.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides access to all graphical functions needed to create the assets
+ * being drawn to the swapchain.
+ * The software device rasterizes on the CPU into its own color buffer.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/Device.hpp"
+#include "Ludus/Graphics/SampledTexture.hpp"
+#include "Ludus/Graphics/Texture.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Ludus
+{
+    namespace
+    {
+        /* ================================================================= */
+        /**
+         * Multiplies two colors channel by channel.
+         * @param lhs               The first color.
+         * @param rhs               The second color.
+         * @returns                 The modulated color.
+        **/
+        /* ================================================================= */
+        Color Modulate(Color lhs, Color rhs)
+        {
+            // A white vertex color is by far the most common.
+            if(rhs == 0xFFFFFFFFu)
+            {
+                return lhs;
+            }
+            Color result = 0;
+            for(unsigned channel = 0; channel < 4; ++channel)
+            {
+                unsigned const product = GetChannel(lhs, channel) *
+                    GetChannel(rhs, channel) + 127u;
+                result |= static_cast<Color>(product / 255u) << (channel * 8);
+            }
+            return result;
+        }
+
+        /* ================================================================= */
+        /**
+         * Looks up the texel nearest to a texture coordinate, wrapping
+         * coordinates outside of [0, 1).
+         * @param texture           The texture sampled.
+         * @param u                 The horizontal texture coordinate.
+         * @param v                 The vertical texture coordinate.
+         * @returns                 The texel sampled.
+        **/
+        /* ================================================================= */
+        Color SampleNearest(Texture const &texture, float u, float v)
+        {
+            int const width = static_cast<int>(texture.GetWidth());
+            int const height = static_cast<int>(texture.GetHeight());
+            int x = static_cast<int>(std::floor(u * width)) % width;
+            int y = static_cast<int>(std::floor(v * height)) % height;
+            x += x < 0 ? width : 0;
+            y += y < 0 ? height : 0;
+            return texture.GetTexel(static_cast<unsigned>(x),
+                static_cast<unsigned>(y));
+        }
+
+        /* ================================================================= */
+        /**
+         * Picks the level of detail from how far the texture coordinates
+         * move from one pixel to the next, along either axis.
+         * @param texture           The texture sampled.
+         * @param dudx              The change of u along a row.
+         * @param dvdx              The change of v along a row.
+         * @param dudy              The change of u along a column.
+         * @param dvdy              The change of v along a column.
+         * @returns                 The level of detail, zero when the
+         *                          texture is magnified.
+        **/
+        /* ================================================================= */
+        float ComputeLod(SampledTexture const &texture, float dudx, float dvdx,
+            float dudy, float dvdy)
+        {
+            float const width = static_cast<float>(texture.GetWidth());
+            float const height = static_cast<float>(texture.GetHeight());
+            float const footprint = std::max(std::hypot(dudx * width, dvdx * height),
+                std::hypot(dudy * width, dvdy * height));
+            return footprint > 1.0f ? std::log2(footprint) : 0.0f;
+        }
+    }
+
+    Device::Device(unsigned width, unsigned height) :
+        width_(width), height_(height), pitch_(width), rows_(height),
+        color_(static_cast<size_t>(width) * height, PackColor(0, 0, 0)),
+        depth_(static_cast<size_t>(width) * height, 1.0f), spanU_(width), spanV_(width),
+        spanLods_(width), spanTints_(width), spanColors_(width), frame_(0),
+        framesInFlight_(2), buffers_(), textures_(), framebuffers_(),
+        uploadSize_(1 << 18), uploads_(uploadSize_, framesInFlight_)
+    {
+    }
+
+    void Device::Clear(Color color)
+    {
+        // Only the rows in use, the rest of the capacity isn't shown.
+        for(unsigned y = 0; y < height_; ++y)
+        {
+            size_t const row = static_cast<size_t>(y) * pitch_;
+            std::fill_n(color_.begin() + row, width_, color);
+            std::fill_n(depth_.begin() + row, width_, 1.0f);
+        }
+    }
+
+    bool Device::Resize(unsigned width, unsigned height)
+    {
+        width_ = width;
+        height_ = height;
+        if(width <= pitch_ && height <= rows_)
+        {
+            return false;
+        }
+        // Grows by a quarter at least, a window being dragged bigger
+        // grows a few pixels at a time.
+        pitch_ = width > pitch_ ? std::max(width, pitch_ + pitch_ / 4) : pitch_;
+        rows_ = height > rows_ ? std::max(height, rows_ + rows_ / 4) : rows_;
+        size_t const size = static_cast<size_t>(pitch_) * rows_;
+        color_.assign(size, PackColor(0, 0, 0));
+        depth_.assign(size, 1.0f);
+        // A span never covers more than a row.
+        spanU_.resize(pitch_);
+        spanV_.resize(pitch_);
+        spanLods_.resize(pitch_);
+        spanTints_.resize(pitch_);
+        spanColors_.resize(pitch_);
+        return true;
+    }
+
+    void Device::DrawQuads(Vertex2D const *vertices, size_t quadCount,
+        Texture const *texture, BlendMode blend)
+    {
+        RasterizeQuads(vertices, quadCount, Sampler{ texture, nullptr }, blend);
+    }
+
+    void Device::DrawSampledQuads(Vertex2D const *vertices, size_t quadCount,
+        SampledTexture const *texture, BlendMode blend)
+    {
+        RasterizeQuads(vertices, quadCount, Sampler{ nullptr, texture }, blend);
+    }
+
+    void Device::RasterizeQuads(Vertex2D const *vertices, size_t quadCount,
+        Sampler const &sampler, BlendMode blend)
+    {
+        for(size_t i = 0; i < quadCount; ++i)
+        {
+            Vertex2D const *quad = vertices + i * 4;
+            // Unrotated quads with matching corners skip the triangles.
+            bool const aligned =
+                quad[0].y_ == quad[1].y_ && quad[1].x_ == quad[2].x_ &&
+                quad[2].y_ == quad[3].y_ && quad[3].x_ == quad[0].x_ &&
+                quad[0].color_ == quad[1].color_ &&
+                quad[0].color_ == quad[2].color_ &&
+                quad[0].color_ == quad[3].color_;
+            if(aligned)
+            {
+                FillRectangle(quad, sampler, blend);
+            }
+            else
+            {
+                FillTriangle(quad[0], quad[1], quad[2], sampler, blend);
+                FillTriangle(quad[0], quad[2], quad[3], sampler, blend);
+            }
+        }
+    }
+
+    size_t Device::DrawTriangles(Math::Vec4Stream const &clip,
+        std::uint32_t const *indices, size_t triangleCount, Color color)
+    {
+        float const halfWidth = width_ * 0.5f;
+        float const halfHeight = height_ * 0.5f;
+        size_t drawn = 0;
+        for(size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            float x[3], y[3], z[3];
+            bool behind = false;
+            for(unsigned corner = 0; corner < 3; ++corner)
+            {
+                std::uint32_t const index = indices[triangle * 3 + corner];
+                float const w = clip.w_[index];
+                if(w <= 1e-6f)
+                {
+                    behind = true;
+                    break;
+                }
+                // Perspective divide, then the viewport with y going down.
+                float const inverse = 1.0f / w;
+                x[corner] = (clip.x_[index] * inverse + 1.0f) * halfWidth;
+                y[corner] = (1.0f - clip.y_[index] * inverse) * halfHeight;
+                z[corner] = clip.z_[index] * inverse * 0.5f + 0.5f;
+            }
+            if(behind)
+            {
+                continue;
+            }
+            FillDepthTriangle(x, y, z, color);
+            ++drawn;
+        }
+        return drawn;
+    }
+
+    void Device::EndFrame()
+    {
+        uploads_.Fence(frame_);
+        ++frame_;
+        if(frame_ <= framesInFlight_)
+        {
+            return;
+        }
+        // The frame just ended is in flight along with the ones before.
+        std::uint64_t const done = frame_ - framesInFlight_ - 1;
+        buffers_.Collect(done);
+        textures_.Collect(done);
+        framebuffers_.Collect(done);
+        uploads_.Reclaim(done);
+    }
+
+    void Device::SetFramesInFlight(unsigned frames)
+    {
+        framesInFlight_ = frames;
+        uploads_ = UploadRing(uploadSize_, framesInFlight_);
+    }
+
+    void Device::SetUploadSize(size_t bytesPerFrame)
+    {
+        uploadSize_ = bytesPerFrame;
+        uploads_ = UploadRing(uploadSize_, framesInFlight_);
+    }
+
+    UploadAllocation Device::AllocateUpload(size_t size)
+    {
+        return uploads_.Allocate(size);
+    }
+
+    BufferHandle Device::CreateBuffer(size_t size)
+    {
+        BufferHandle const buffer = buffers_.Allocate();
+        buffers_.Get(buffer).bytes_.assign(size, 0);
+        return buffer;
+    }
+
+    void Device::DestroyBuffer(BufferHandle buffer)
+    {
+        buffers_.Release(buffer, frame_);
+    }
+
+    Buffer &Device::GetBuffer(BufferHandle buffer)
+    {
+        return buffers_.Get(buffer);
+    }
+
+    TextureHandle Device::CreateTexture(unsigned width, unsigned height, Color fill)
+    {
+        TextureHandle const texture = textures_.Allocate();
+        textures_.Get(texture).Resize(width, height, fill);
+        return texture;
+    }
+
+    void Device::DestroyTexture(TextureHandle texture)
+    {
+        textures_.Release(texture, frame_);
+    }
+
+    Texture &Device::GetTexture(TextureHandle texture)
+    {
+        return textures_.Get(texture);
+    }
+
+    FramebufferHandle Device::CreateFramebuffer(unsigned width, unsigned height)
+    {
+        FramebufferHandle const handle = framebuffers_.Allocate();
+        Framebuffer &framebuffer = framebuffers_.Get(handle);
+        framebuffer.width_ = width;
+        framebuffer.height_ = height;
+        framebuffer.color_.assign(static_cast<size_t>(width) * height, PackColor(0, 0, 0));
+        framebuffer.depth_.assign(static_cast<size_t>(width) * height, 1.0f);
+        return handle;
+    }
+
+    void Device::DestroyFramebuffer(FramebufferHandle framebuffer)
+    {
+        framebuffers_.Release(framebuffer, frame_);
+    }
+
+    Framebuffer &Device::GetFramebuffer(FramebufferHandle framebuffer)
+    {
+        return framebuffers_.Get(framebuffer);
+    }
+
+    unsigned Device::GetWidth() const
+    {
+        return width_;
+    }
+
+    unsigned Device::GetHeight() const
+    {
+        return height_;
+    }
+
+    unsigned Device::GetPitch() const
+    {
+        return pitch_;
+    }
+
+    Color Device::GetPixel(unsigned x, unsigned y) const
+    {
+        return color_[static_cast<size_t>(y) * pitch_ + x];
+    }
+
+    Color const *Device::GetColorBuffer() const
+    {
+        return color_.data();
+    }
+
+    float Device::GetDepth(unsigned x, unsigned y) const
+    {
+        return depth_[static_cast<size_t>(y) * pitch_ + x];
+    }
+
+    std::uint64_t Device::GetFrame() const
+    {
+        return frame_;
+    }
+
+    ResourcePool<Buffer> const &Device::GetBufferPool() const
+    {
+        return buffers_;
+    }
+
+    ResourcePool<Texture> const &Device::GetTexturePool() const
+    {
+        return textures_;
+    }
+
+    ResourcePool<Framebuffer> const &Device::GetFramebufferPool() const
+    {
+        return framebuffers_;
+    }
+
+    UploadRing const &Device::GetUploadRing() const
+    {
+        return uploads_;
+    }
+
+    void Device::FillRectangle(Vertex2D const *quad, Sampler const &sampler,
+        BlendMode blend)
+    {
+        float const left = std::min(quad[0].x_, quad[1].x_);
+        float const right = std::max(quad[0].x_, quad[1].x_);
+        float const top = std::min(quad[0].y_, quad[3].y_);
+        float const bottom = std::max(quad[0].y_, quad[3].y_);
+        // Pixels are covered when their centers are inside the quad.
+        int const x0 = std::max(0, static_cast<int>(std::ceil(left - 0.5f)));
+        int const x1 = std::min(static_cast<int>(width_),
+            static_cast<int>(std::ceil(right - 0.5f)));
+        int const y0 = std::max(0, static_cast<int>(std::ceil(top - 0.5f)));
+        int const y1 = std::min(static_cast<int>(height_),
+            static_cast<int>(std::ceil(bottom - 0.5f)));
+        if(x0 >= x1 || y0 >= y1)
+        {
+            return;
+        }
+
+        // The texture coordinates change linearly along each axis.
+        float const width = quad[1].x_ - quad[0].x_;
+        float const height = quad[3].y_ - quad[0].y_;
+        float const du = (quad[1].u_ - quad[0].u_) / width;
+        float const dv = (quad[3].v_ - quad[0].v_) / height;
+        size_t const count = static_cast<size_t>(x1 - x0);
+        bool const textured = sampler.nearest_ || sampler.filtered_;
+        // Every pixel steps over as many texels.
+        float const lod = sampler.filtered_ ?
+            ComputeLod(*sampler.filtered_, du, 0.0f, 0.0f, dv) : 0.0f;
+        std::fill_n(spanTints_.begin(), count, quad[0].color_);
+        for(int y = y0; y < y1; ++y)
+        {
+            if(textured)
+            {
+                float const v = quad[0].v_ + (y + 0.5f - quad[0].y_) * dv;
+                float u = quad[0].u_ + (x0 + 0.5f - quad[0].x_) * du;
+                for(size_t i = 0; i < count; ++i, u += du)
+                {
+                    spanU_[i] = u;
+                }
+                std::fill_n(spanV_.begin(), count, v);
+            }
+            ShadeSpan(color_.data() + static_cast<size_t>(y) * pitch_ + x0, count,
+                sampler, lod, blend);
+        }
+    }
+
+    void Device::FillTriangle(Vertex2D const &a, Vertex2D const &b,
+        Vertex2D const &c, Sampler const &sampler, BlendMode blend)
+    {
+        float const area = (b.x_ - a.x_) * (c.y_ - a.y_) -
+            (b.y_ - a.y_) * (c.x_ - a.x_);
+        if(area == 0.0f)
+        {
+            return;
+        }
+        int const x0 = std::max(0, static_cast<int>(
+            std::floor(std::min({ a.x_, b.x_, c.x_ }))));
+        int const x1 = std::min(static_cast<int>(width_) - 1, static_cast<int>(
+            std::ceil(std::max({ a.x_, b.x_, c.x_ }))));
+        int const y0 = std::max(0, static_cast<int>(
+            std::floor(std::min({ a.y_, b.y_, c.y_ }))));
+        int const y1 = std::min(static_cast<int>(height_) - 1, static_cast<int>(
+            std::ceil(std::max({ a.y_, b.y_, c.y_ }))));
+
+        float const inverseArea = 1.0f / area;
+        bool const textured = sampler.nearest_ || sampler.filtered_;
+        float lod = 0.0f;
+        if(sampler.filtered_)
+        {
+            // The weights change linearly across the screen, so do the
+            // texture coordinates.
+            float const dadx = (b.y_ - c.y_) * inverseArea;
+            float const dady = (c.x_ - b.x_) * inverseArea;
+            float const dbdx = (c.y_ - a.y_) * inverseArea;
+            float const dbdy = (a.x_ - c.x_) * inverseArea;
+            lod = ComputeLod(*sampler.filtered_,
+                dadx * (a.u_ - c.u_) + dbdx * (b.u_ - c.u_),
+                dadx * (a.v_ - c.v_) + dbdx * (b.v_ - c.v_),
+                dady * (a.u_ - c.u_) + dbdy * (b.u_ - c.u_),
+                dady * (a.v_ - c.v_) + dbdy * (b.v_ - c.v_));
+        }
+        for(int y = y0; y <= y1; ++y)
+        {
+            Color *row = color_.data() + static_cast<size_t>(y) * pitch_;
+            float const py = y + 0.5f;
+            // The covered pixels of the row, shaded together.
+            int first = x0;
+            size_t count = 0;
+            for(int x = x0; x <= x1; ++x)
+            {
+                float const px = x + 0.5f;
+                // The barycentric weights, normalized by the signed area so
+                // both windings work.
+                float const wa = ((b.x_ - px) * (c.y_ - py) -
+                    (b.y_ - py) * (c.x_ - px)) * inverseArea;
+                float const wb = ((c.x_ - px) * (a.y_ - py) -
+                    (c.y_ - py) * (a.x_ - px)) * inverseArea;
+                float const wc = 1.0f - wa - wb;
+                // Shared edges only belong to one of the two triangles.
+                if(wa < 0.0f || wb < 0.0f || wc <= 0.0f)
+                {
+                    continue;
+                }
+                if(count != 0 && first + static_cast<int>(count) != x)
+                {
+                    ShadeSpan(row + first, count, sampler, lod, blend);
+                    count = 0;
+                }
+                first = count == 0 ? x : first;
+                Color tint = a.color_;
+                if(a.color_ != b.color_ || a.color_ != c.color_)
+                {
+                    tint = 0;
+                    for(unsigned channel = 0; channel < 4; ++channel)
+                    {
+                        float const value = wa * GetChannel(a.color_, channel) +
+                            wb * GetChannel(b.color_, channel) +
+                            wc * GetChannel(c.color_, channel);
+                        tint |= static_cast<Color>(value + 0.5f) << (channel * 8);
+                    }
+                }
+                if(textured)
+                {
+                    spanU_[count] = wa * a.u_ + wb * b.u_ + wc * c.u_;
+                    spanV_[count] = wa * a.v_ + wb * b.v_ + wc * c.v_;
+                }
+                spanTints_[count++] = tint;
+            }
+            if(count != 0)
+            {
+                ShadeSpan(row + first, count, sampler, lod, blend);
+            }
+        }
+    }
+
+    void Device::ShadeSpan(Color *pixels, size_t count, Sampler const &sampler,
+        float lod, BlendMode blend)
+    {
+        if(sampler.filtered_)
+        {
+            // Magnified, only the largest level is read.
+            if(lod > 0.0f)
+            {
+                std::fill_n(spanLods_.begin(), count, lod);
+                sampler.filtered_->SampleTrilinear(spanU_.data(), spanV_.data(),
+                    spanLods_.data(), count, spanColors_.data());
+            }
+            else
+            {
+                sampler.filtered_->SampleBilinear(spanU_.data(), spanV_.data(), count, 0,
+                    spanColors_.data());
+            }
+            for(size_t i = 0; i < count; ++i)
+            {
+                WritePixel(pixels[i], Modulate(spanColors_[i], spanTints_[i]), blend);
+            }
+        }
+        else if(sampler.nearest_)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                WritePixel(pixels[i], Modulate(SampleNearest(*sampler.nearest_, spanU_[i],
+                    spanV_[i]), spanTints_[i]), blend);
+            }
+        }
+        else
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                WritePixel(pixels[i], spanTints_[i], blend);
+            }
+        }
+    }
+
+    void Device::FillDepthTriangle(float const *x, float const *y,
+        float const *z, Color color)
+    {
+        float const area = (x[1] - x[0]) * (y[2] - y[0]) -
+            (y[1] - y[0]) * (x[2] - x[0]);
+        if(area == 0.0f)
+        {
+            return;
+        }
+        int const x0 = std::max(0, static_cast<int>(
+            std::floor(std::min({ x[0], x[1], x[2] }))));
+        int const x1 = std::min(static_cast<int>(width_) - 1, static_cast<int>(
+            std::ceil(std::max({ x[0], x[1], x[2] }))));
+        int const y0 = std::max(0, static_cast<int>(
+            std::floor(std::min({ y[0], y[1], y[2] }))));
+        int const y1 = std::min(static_cast<int>(height_) - 1, static_cast<int>(
+            std::ceil(std::max({ y[0], y[1], y[2] }))));
+
+        float const inverseArea = 1.0f / area;
+        for(int py = y0; py <= y1; ++py)
+        {
+            size_t const row = static_cast<size_t>(py) * pitch_;
+            float const cy = py + 0.5f;
+            for(int px = x0; px <= x1; ++px)
+            {
+                float const cx = px + 0.5f;
+                float const w0 = ((x[1] - cx) * (y[2] - cy) -
+                    (y[1] - cy) * (x[2] - cx)) * inverseArea;
+                float const w1 = ((x[2] - cx) * (y[0] - cy) -
+                    (y[2] - cy) * (x[0] - cx)) * inverseArea;
+                float const w2 = 1.0f - w0 - w1;
+                if(w0 < 0.0f || w1 < 0.0f || w2 <= 0.0f)
+                {
+                    continue;
+                }
+                float const depth = w0 * z[0] + w1 * z[1] + w2 * z[2];
+                if(depth < 0.0f || depth >= depth_[row + px])
+                {
+                    continue;
+                }
+                depth_[row + px] = depth;
+                color_[row + px] = color;
+            }
+        }
+    }
+
+    void Device::WritePixel(Color &pixel, Color source, BlendMode blend)
+    {
+        unsigned const alpha = GetChannel(source, 3);
+        if(blend == BlendMode::OPAQUE || (blend == BlendMode::ALPHA && alpha == 255))
+        {
+            pixel = source;
+            return;
+        }
+        if(alpha == 0)
+        {
+            return;
+        }
+        Color result = 0;
+        for(unsigned channel = 0; channel < 3; ++channel)
+        {
+            unsigned const src = GetChannel(source, channel);
+            unsigned const dst = GetChannel(pixel, channel);
+            unsigned value = blend == BlendMode::ALPHA ?
+                (src * alpha + dst * (255u - alpha) + 127u) / 255u :
+                std::min(255u, dst + (src * alpha + 127u) / 255u);
+            result |= static_cast<Color>(value) << (channel * 8);
+        }
+        pixel = result | (pixel & 0xFF000000u);
+    }
+}
@@ -15,25 +15,83 @@
 /* Includes */
 /* ========================================================================= */
 #include "Ludus/System/Engine.hpp"
+#include <chrono>
 
 namespace Ludus
 {
-    Engine::Engine()
+    /** The time simulated by every fixed update. */
+    static constexpr double FixedTimeStep = 1.0 / 60.0;
+    /** The most fixed updates run in a single frame. */
+    static constexpr unsigned MaxFixedSteps = 8;
+
+    Engine::Engine() :
+        Node("Engine"), running_(false)
     {
     }
 
     void Engine::Run()
     {
+        running_ = true;
         // Initialize all the systems.
+        for(unsigned i = 0; i < Size(); ++i)
+        {
+            At(i).Initialize();
+        }
+
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point last = Clock::now();
+        double accumulator = 0.0;
         while(running_)
         {
-            // Update simulation until stopped.
+            Clock::time_point const now = Clock::now();
+            double const dt = std::chrono::duration<double>(now - last).count();
+            last = now;
+            for(unsigned i = 0; i < Size(); ++i)
+            {
+                At(i).BeginFrame();
+            }
+            for(unsigned i = 0; i < Size(); ++i)
+            {
+                At(i).Update(dt);
+            }
+            // Catch up on the fixed steps, but don't spiral after a stall.
+            accumulator += dt;
+            for(unsigned step = 0; accumulator >= FixedTimeStep; ++step)
+            {
+                if(step == MaxFixedSteps)
+                {
+                    accumulator = 0.0;
+                    break;
+                }
+                for(unsigned i = 0; i < Size(); ++i)
+                {
+                    At(i).FixedUpdate(FixedTimeStep);
+                }
+                accumulator -= FixedTimeStep;
+            }
+            for(unsigned i = 0; i < Size(); ++i)
+            {
+                At(i).PreDraw();
+            }
+            for(unsigned i = 0; i < Size(); ++i)
+            {
+                At(i).Draw();
+            }
+            for(unsigned i = 0; i < Size(); ++i)
+            {
+                At(i).PostDraw();
+            }
+        }
+        // Shut the systems down in the reverse order they started.
+        for(unsigned i = Size(); i-- > 0;)
+        {
+            At(i).Shutdown();
         }
-        // Stop simulation here.
     }
 
     void Engine::Stop()
     {
+        running_ = false;
     }
 
     bool Engine::IsRunning() const
@@ -0,0 +1,85 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Entity.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * The handles naming entities and the type erased description of every
+ * component type stored in a World.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Entity/Entity.hpp"
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Ludus
+{
+    /* ===================================================================== */
+    /**
+     * Gets the descriptions of every registered component type.
+     * @returns                     The registered types, by id.
+    **/
+    /* ===================================================================== */
+    static std::vector<ComponentInfo> &GetComponentInfos()
+    {
+        // Sized once so references to the infos never move.
+        static std::vector<ComponentInfo> infos(MaxComponents);
+        return infos;
+    }
+
+    /** Guards the registration of new component types. */
+    static std::mutex registryLock;
+    /** The number of component types registered. */
+    static ComponentId registeredCount = 0;
+
+    ComponentId ComponentRegistry::Register(ComponentInfo const &info)
+    {
+        std::lock_guard<std::mutex> lock(registryLock);
+        if(registeredCount == MaxComponents)
+        {
+            throw std::length_error("Too many component types are in use.");
+        }
+        GetComponentInfos()[registeredCount] = info;
+        return registeredCount++;
+    }
+
+    ComponentInfo const &ComponentRegistry::GetInfo(ComponentId id)
+    {
+        return GetComponentInfos()[id];
+    }
+
+    bool Entity::operator==(Entity const &rhs) const
+    {
+        return index_ == rhs.index_ && generation_ == rhs.generation_;
+    }
+
+    bool Entity::operator!=(Entity const &rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    Access Access::All()
+    {
+        return Access{ 0, ~Signature(0) };
+    }
+
+    bool Access::ConflictsWith(Access const &other) const
+    {
+        return (writes_ & (other.reads_ | other.writes_)) != 0 ||
+            (other.writes_ & reads_) != 0;
+    }
+
+    bool Access::Covers(Access const &other) const
+    {
+        return (other.writes_ & ~writes_) == 0 &&
+            (other.reads_ & ~(reads_ | writes_)) == 0;
+    }
+}
@@ -0,0 +1,75 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            EventBus.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Lets the systems of the engine talk without knowing each other.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/EventBus.hpp"
+#include <stdexcept>
+
+namespace Ludus
+{
+    /** The number of event types given an id so far. */
+    static std::atomic<EventId> registeredEvents(0);
+
+    EventBus::EventBus() :
+        Node("EventBus")
+    {
+        for(std::atomic<EventChannelBase *> &channel : channels_)
+        {
+            channel.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    EventBus::~EventBus()
+    {
+        for(std::atomic<EventChannelBase *> &channel : channels_)
+        {
+            delete channel.load(std::memory_order_acquire);
+        }
+    }
+
+    size_t EventBus::Dispatch()
+    {
+        size_t delivered = 0;
+        for(std::atomic<EventChannelBase *> &channel : channels_)
+        {
+            EventChannelBase *const events = channel.load(std::memory_order_acquire);
+            if(events)
+            {
+                delivered += events->Dispatch();
+            }
+        }
+        return delivered;
+    }
+
+    void EventBus::BeginFrame()
+    {
+        Dispatch();
+    }
+
+    void EventBus::PreDraw()
+    {
+        Dispatch();
+    }
+
+    EventId EventBus::Register()
+    {
+        EventId const id = registeredEvents.fetch_add(1, std::memory_order_relaxed);
+        if(id >= MaxEventTypes)
+        {
+            throw std::length_error("Too many event types are in use.");
+        }
+        return id;
+    }
+}
@@ -0,0 +1,672 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            FileReader.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Reads whole files in the background, many at a time.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Assets/FileReader.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define LUDUS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace Ludus
+{
+#ifdef _WIN32
+    /* ===================================================================== */
+    /**
+     * Reads a whole file on the calling thread.
+     * @param path                  The file to read.
+     * @returns                     The file read, or why it couldn't be.
+    **/
+    /* ===================================================================== */
+    static FileRead ReadWholeFile(std::string const &path)
+    {
+        FileRead read{ path, {}, {} };
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if(!file)
+        {
+            read.error_ = "The file can't be opened.";
+            return read;
+        }
+        read.bytes_.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if(!file.read(reinterpret_cast<char *>(read.bytes_.data()),
+            static_cast<std::streamsize>(read.bytes_.size())))
+        {
+            read.bytes_.clear();
+            read.error_ = "The file can't be read.";
+        }
+        return read;
+    }
+#else
+    static FileRead ReadWholeFile(std::string const &path)
+    {
+        FileRead read{ path, {}, {} };
+        int const file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(file < 0)
+        {
+            read.error_ = std::strerror(errno);
+            return read;
+        }
+        struct stat status;
+        if(fstat(file, &status) != 0)
+        {
+            read.error_ = std::strerror(errno);
+            close(file);
+            return read;
+        }
+        read.bytes_.resize(static_cast<size_t>(status.st_size));
+        size_t done = 0;
+        while(done < read.bytes_.size())
+        {
+            ssize_t const count = pread(file, read.bytes_.data() + done,
+                read.bytes_.size() - done, static_cast<off_t>(done));
+            if(count < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if(count < 0)
+            {
+                read.error_ = std::strerror(errno);
+                read.bytes_.clear();
+                break;
+            }
+            // The file got shorter since it was measured.
+            if(count == 0)
+            {
+                read.bytes_.resize(done);
+                break;
+            }
+            done += static_cast<size_t>(count);
+        }
+        close(file);
+        return read;
+    }
+#endif
+
+#ifdef LUDUS_IO_URING
+    /* ===================================================================== */
+    /**
+     * A submission and a completion queue shared with the kernel.
+    **/
+    /* ===================================================================== */
+    struct FileReader::Ring
+    {
+        /** The number of submissions the ring holds. */
+        static constexpr unsigned Entries = 256;
+
+        /* ================================================================= */
+        /**
+         * Sets the ring up and checks the kernel knows every operation
+         * the reader needs.
+         * @throw std::runtime_error If io_uring can't be used.
+        **/
+        /* ================================================================= */
+        Ring() :
+            fd_(-1), sqRing_(MAP_FAILED), cqRing_(MAP_FAILED), sqes_(nullptr),
+            sqRingSize_(0), cqRingSize_(0), sqesSize_(0), tail_(0), submitted_(0)
+        {
+            io_uring_params params;
+            std::memset(&params, 0, sizeof(params));
+            fd_ = static_cast<int>(syscall(__NR_io_uring_setup, Entries, &params));
+            if(fd_ < 0)
+            {
+                throw std::runtime_error("io_uring isn't available.");
+            }
+            sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            bool const single = params.features & IORING_FEAT_SINGLE_MMAP;
+            if(single)
+            {
+                sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+            }
+            sqRing_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+            cqRing_ = single ? sqRing_ : mmap(nullptr, cqRingSize_,
+                PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+            sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+            void *const sqes = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+            sqes_ = sqes == MAP_FAILED ? nullptr : static_cast<io_uring_sqe *>(sqes);
+            if(sqRing_ == MAP_FAILED || cqRing_ == MAP_FAILED || !sqes_ || !SupportsReads())
+            {
+                Release();
+                throw std::runtime_error("io_uring can't read files here.");
+            }
+
+            std::uint8_t *const sq = static_cast<std::uint8_t *>(sqRing_);
+            sqHead_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+            sqTail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+            sqMask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+            sqEntries_ = params.sq_entries;
+            sqArray_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+            std::uint8_t *const cq = static_cast<std::uint8_t *>(cqRing_);
+            cqHead_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+            cqTail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+            cqMask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+            cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+            tail_ = *sqTail_;
+            submitted_ = tail_;
+        }
+        /* ================================================================= */
+        /**
+         * Tears the ring down.
+        **/
+        /* ================================================================= */
+        ~Ring()
+        {
+            Release();
+        }
+        Ring(Ring const &) = delete;
+        Ring &operator=(Ring const &) = delete;
+
+        /* ================================================================= */
+        /**
+         * Gets a blank submission to fill, flushing the queue if it's full.
+         * @param userData          Comes back with the completion.
+         * @returns                 The submission.
+         * @throw std::runtime_error If the kernel takes nothing.
+        **/
+        /* ================================================================= */
+        io_uring_sqe &Prepare(std::uint64_t userData)
+        {
+            if(tail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) >= sqEntries_)
+            {
+                Enter(0);
+                if(tail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) >= sqEntries_)
+                {
+                    throw std::runtime_error("The io_uring submission queue is stuck.");
+                }
+            }
+            unsigned const index = tail_ & sqMask_;
+            io_uring_sqe &sqe = sqes_[index];
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.user_data = userData;
+            sqArray_[index] = index;
+            ++tail_;
+            return sqe;
+        }
+        /* ================================================================= */
+        /**
+         * Submits everything prepared, in a single system call.
+         * @param wait              The number of completions to wait for.
+         * @throw std::runtime_error If the kernel refuses the submissions.
+        **/
+        /* ================================================================= */
+        void Enter(unsigned wait)
+        {
+            __atomic_store_n(sqTail_, tail_, __ATOMIC_RELEASE);
+            for(;;)
+            {
+                long const result = syscall(__NR_io_uring_enter, fd_, tail_ - submitted_,
+                    wait, wait ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+                if(result >= 0)
+                {
+                    submitted_ += static_cast<unsigned>(result);
+                    return;
+                }
+                if(errno != EINTR)
+                {
+                    throw std::runtime_error(std::string("io_uring_enter failed: ") +
+                        std::strerror(errno));
+                }
+            }
+        }
+        /* ================================================================= */
+        /**
+         * Hands every completion waiting to a function.
+         * @param handle            Called with the user data and the
+         *                          result of every completion.
+        **/
+        /* ================================================================= */
+        template <typename Handler>
+        void Reap(Handler const &handle)
+        {
+            unsigned head = *cqHead_;
+            unsigned const tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+            for(; head != tail; ++head)
+            {
+                io_uring_cqe const &cqe = cqes_[head & cqMask_];
+                handle(cqe.user_data, cqe.res);
+            }
+            __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+        }
+
+        /* ================================================================= */
+        /**
+         * Checks the kernel knows every operation the reader needs.
+         * @returns                 True if files can be read.
+        **/
+        /* ================================================================= */
+        bool SupportsReads() const
+        {
+            constexpr unsigned OpCount = 256;
+            std::vector<std::uint8_t> storage(sizeof(io_uring_probe) +
+                OpCount * sizeof(io_uring_probe_op));
+            io_uring_probe *const probe = reinterpret_cast<io_uring_probe *>(storage.data());
+            if(syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, OpCount) < 0)
+            {
+                return false;
+            }
+            for(unsigned op : { IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ,
+                IORING_OP_CLOSE })
+            {
+                if(op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        /* ================================================================= */
+        /**
+         * Unmaps the queues and closes the ring.
+        **/
+        /* ================================================================= */
+        void Release()
+        {
+            if(sqes_)
+            {
+                munmap(sqes_, sqesSize_);
+            }
+            if(cqRing_ != MAP_FAILED && cqRing_ != sqRing_)
+            {
+                munmap(cqRing_, cqRingSize_);
+            }
+            if(sqRing_ != MAP_FAILED)
+            {
+                munmap(sqRing_, sqRingSize_);
+            }
+            if(fd_ >= 0)
+            {
+                close(fd_);
+            }
+        }
+
+        /** The ring. */
+        int fd_;
+        /** The mapped submission queue. */
+        void *sqRing_;
+        /** The mapped completion queue, maybe the same mapping. */
+        void *cqRing_;
+        /** The submissions. */
+        io_uring_sqe *sqes_;
+        /** The size of the submission queue mapping. */
+        size_t sqRingSize_;
+        /** The size of the completion queue mapping. */
+        size_t cqRingSize_;
+        /** The size of the submissions mapping. */
+        size_t sqesSize_;
+        /** The first submission not consumed by the kernel. */
+        unsigned *sqHead_;
+        /** The end of the submissions published to the kernel. */
+        unsigned *sqTail_;
+        /** Wraps submission indices. */
+        unsigned sqMask_;
+        /** The number of submissions the queue holds. */
+        unsigned sqEntries_;
+        /** The submission every slot of the queue points to. */
+        unsigned *sqArray_;
+        /** The first completion not reaped. */
+        unsigned *cqHead_;
+        /** The end of the completions posted by the kernel. */
+        unsigned *cqTail_;
+        /** Wraps completion indices. */
+        unsigned cqMask_;
+        /** The completions. */
+        io_uring_cqe *cqes_;
+        /** The end of the submissions prepared. */
+        unsigned tail_;
+        /** The end of the submissions handed to the kernel. */
+        unsigned submitted_;
+    };
+#else
+    struct FileReader::Ring
+    {
+    };
+#endif
+
+    FileReader::FileReader(JobSystem &jobs, FileBackend backend, unsigned threadCount) :
+        jobs_(jobs), backend_(FileBackend::PREAD), stopping_(false)
+    {
+#ifdef LUDUS_IO_URING
+        if(backend == FileBackend::IO_URING)
+        {
+            try
+            {
+                ring_ = std::make_unique<Ring>();
+                backend_ = FileBackend::IO_URING;
+            }
+            catch(std::runtime_error const &)
+            {
+                // Old kernels and sandboxes read with PREAD instead.
+            }
+        }
+#else
+        UNREFERENCED(backend);
+#endif
+        if(backend_ == FileBackend::IO_URING)
+        {
+            threads_.emplace_back(&FileReader::RingLoop, this);
+            return;
+        }
+        threadCount = std::max(threadCount, 1u);
+        for(unsigned i = 0; i < threadCount; ++i)
+        {
+            threads_.emplace_back(&FileReader::PreadLoop, this);
+        }
+    }
+
+    FileReader::~FileReader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        available_.notify_all();
+        for(std::thread &thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    void FileReader::Read(std::vector<std::string> const &paths, Completion completion,
+        JobCounter *counter)
+    {
+        if(paths.empty())
+        {
+            return;
+        }
+        if(counter)
+        {
+            jobs_.Expect(*counter, paths.size());
+        }
+        std::shared_ptr<Completion const> const shared =
+            std::make_shared<Completion const>(std::move(completion));
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for(std::string const &path : paths)
+            {
+                queue_.push_back(Request{ path, shared, counter });
+            }
+        }
+        available_.notify_all();
+    }
+
+    FileBackend FileReader::GetBackend() const
+    {
+        return backend_;
+    }
+
+    bool FileReader::IsSupported(FileBackend backend)
+    {
+        if(backend == FileBackend::PREAD)
+        {
+            return true;
+        }
+#ifdef LUDUS_IO_URING
+        static bool const supported = []()
+        {
+            try
+            {
+                Ring ring;
+                return true;
+            }
+            catch(std::runtime_error const &)
+            {
+                return false;
+            }
+        }();
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    void FileReader::Complete(Request &request, FileRead &&read)
+    {
+        std::shared_ptr<Completion const> completion = std::move(request.completion_);
+        jobs_.ScheduleExpected([completion, read = std::move(read)]() mutable
+            {
+                (*completion)(read);
+            }, request.counter_);
+    }
+
+    bool FileReader::TakeRequests(std::deque<Request> &requests, size_t max, bool block)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if(block)
+        {
+            available_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if(queue_.empty())
+            {
+                return false;
+            }
+        }
+        for(; max != 0 && !queue_.empty(); --max)
+        {
+            requests.push_back(std::move(queue_.front()));
+            queue_.pop_front();
+        }
+        return true;
+    }
+
+    void FileReader::PreadLoop()
+    {
+        std::deque<Request> requests;
+        while(TakeRequests(requests, 1, true))
+        {
+            Request request = std::move(requests.front());
+            requests.pop_front();
+            Complete(request, ReadWholeFile(request.path_));
+        }
+    }
+
+#ifdef LUDUS_IO_URING
+    void FileReader::RingLoop()
+    {
+        /** The most files opened at once. */
+        constexpr size_t MaxFiles = 64;
+        /** What a submission does, in the low bits of its user data. */
+        enum Operation : std::uint64_t { OPEN = 0, STAT = 1, READ = 2, CLOSE = 3 };
+
+        /* ================================================================= */
+        /** A file being read through the ring. */
+        /* ================================================================= */
+        struct OpenFile
+        {
+            /** The request of the file. */
+            Request request_;
+            /** The file read so far. */
+            FileRead read_;
+            /** Filled in with the size of the file. */
+            struct statx status_;
+            /** The file, once opened. */
+            int fd_;
+            /** The number of the open and stat still in flight. */
+            unsigned waiting_;
+            /** The number of bytes read. */
+            size_t done_;
+        };
+
+        Ring &ring = *ring_;
+        std::vector<OpenFile> files(MaxFiles);
+        std::vector<size_t> idle(MaxFiles);
+        for(size_t i = 0; i < MaxFiles; ++i)
+        {
+            idle[i] = MaxFiles - 1 - i;
+        }
+        // Every submission handed out and not completed yet.
+        unsigned inFlight = 0;
+
+        auto const submitRead = [&](size_t slot)
+        {
+            OpenFile &file = files[slot];
+            io_uring_sqe &sqe = ring.Prepare(slot << 2 | READ);
+            sqe.opcode = IORING_OP_READ;
+            sqe.fd = file.fd_;
+            sqe.addr = reinterpret_cast<std::uint64_t>(file.read_.bytes_.data() + file.done_);
+            sqe.len = static_cast<std::uint32_t>(std::min<size_t>(
+                file.read_.bytes_.size() - file.done_, INT_MAX));
+            sqe.off = file.done_;
+            ++inFlight;
+        };
+        auto const finish = [&](size_t slot)
+        {
+            OpenFile &file = files[slot];
+            if(file.fd_ >= 0)
+            {
+                // Closes are batched too, nobody waits on them.
+                io_uring_sqe &sqe = ring.Prepare(slot << 2 | CLOSE);
+                sqe.opcode = IORING_OP_CLOSE;
+                sqe.fd = file.fd_;
+                ++inFlight;
+            }
+            if(!file.read_.error_.empty())
+            {
+                file.read_.bytes_.clear();
+            }
+            Complete(file.request_, std::move(file.read_));
+            idle.push_back(slot);
+        };
+        auto const opened = [&](size_t slot)
+        {
+            OpenFile &file = files[slot];
+            if(!file.read_.error_.empty())
+            {
+                finish(slot);
+                return;
+            }
+            file.read_.bytes_.resize(static_cast<size_t>(file.status_.stx_size));
+            if(file.read_.bytes_.empty())
+            {
+                finish(slot);
+                return;
+            }
+            submitRead(slot);
+        };
+
+        std::deque<Request> requests;
+        while(TakeRequests(requests, idle.size(), inFlight == 0))
+        {
+            // Every file starts with its open and its size side by side.
+            for(; !requests.empty(); requests.pop_front())
+            {
+                size_t const slot = idle.back();
+                idle.pop_back();
+                OpenFile &file = files[slot];
+                file.request_ = std::move(requests.front());
+                file.read_ = FileRead{ file.request_.path_, {}, {} };
+                file.fd_ = -1;
+                file.waiting_ = 2;
+                file.done_ = 0;
+
+                io_uring_sqe &open = ring.Prepare(slot << 2 | OPEN);
+                open.opcode = IORING_OP_OPENAT;
+                open.fd = AT_FDCWD;
+                open.addr = reinterpret_cast<std::uint64_t>(file.request_.path_.c_str());
+                open.open_flags = O_RDONLY | O_CLOEXEC;
+                io_uring_sqe &stat = ring.Prepare(slot << 2 | STAT);
+                stat.opcode = IORING_OP_STATX;
+                stat.fd = AT_FDCWD;
+                stat.addr = reinterpret_cast<std::uint64_t>(file.request_.path_.c_str());
+                stat.len = STATX_SIZE;
+                stat.off = reinterpret_cast<std::uint64_t>(&file.status_);
+                inFlight += 2;
+            }
+
+            ring.Enter(inFlight ? 1 : 0);
+            ring.Reap([&](std::uint64_t userData, int result)
+            {
+                --inFlight;
+                size_t const slot = static_cast<size_t>(userData >> 2);
+                OpenFile &file = files[slot];
+                switch(userData & 3)
+                {
+                case OPEN:
+                    if(result >= 0)
+                    {
+                        file.fd_ = result;
+                    }
+                    else
+                    {
+                        file.read_.error_ = std::strerror(-result);
+                    }
+                    if(--file.waiting_ == 0)
+                    {
+                        opened(slot);
+                    }
+                    break;
+                case STAT:
+                    if(result < 0 && file.read_.error_.empty())
+                    {
+                        file.read_.error_ = std::strerror(-result);
+                    }
+                    if(--file.waiting_ == 0)
+                    {
+                        opened(slot);
+                    }
+                    break;
+                case READ:
+                    if(result == -EINTR || result == -EAGAIN)
+                    {
+                        submitRead(slot);
+                        break;
+                    }
+                    if(result < 0)
+                    {
+                        file.read_.error_ = std::strerror(-result);
+                        finish(slot);
+                        break;
+                    }
+                    // A read of nothing means the file got shorter.
+                    file.done_ += static_cast<size_t>(result);
+                    if(result == 0)
+                    {
+                        file.read_.bytes_.resize(file.done_);
+                    }
+                    if(file.done_ == file.read_.bytes_.size())
+                    {
+                        finish(slot);
+                        break;
+                    }
+                    submitRead(slot);
+                    break;
+                default:
+                    break;
+                }
+            });
+        }
+    }
+#else
+    void FileReader::RingLoop()
+    {
+    }
+#endif
+}
@@ -0,0 +1,160 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            FileWatcher.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Notices when files change on disk.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Assets/FileWatcher.hpp"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Ludus
+{
+    /** How long the thread sleeps before checking whether to exit. */
+    static constexpr std::chrono::milliseconds WatchInterval(100);
+
+    FileWatcher::FileWatcher(Callback changed) :
+        changed_(std::move(changed)), fd_(-1), stopping_(false)
+    {
+#ifdef __linux__
+        fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if(fd_ < 0)
+        {
+            throw std::runtime_error("inotify can't be used to watch files.");
+        }
+#endif
+        thread_ = std::thread(&FileWatcher::WatchLoop, this);
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        stopping_ = true;
+        thread_.join();
+#ifdef __linux__
+        close(fd_);
+#endif
+    }
+
+    void FileWatcher::Add(std::string const &path)
+    {
+        std::string const file = Normalize(path);
+        std::error_code error;
+        std::filesystem::file_time_type const time =
+            std::filesystem::last_write_time(file, error);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(!files_.emplace(file, time).second)
+        {
+            return;
+        }
+#ifdef __linux__
+        // Saving usually replaces the file, so the directory is watched.
+        std::string const directory = std::filesystem::path(file).parent_path().string();
+        int const watch = inotify_add_watch(fd_, directory.c_str(),
+            IN_CLOSE_WRITE | IN_MOVED_TO);
+        if(watch >= 0)
+        {
+            directories_[watch] = directory;
+        }
+#endif
+    }
+
+    std::string FileWatcher::Normalize(std::string const &path)
+    {
+        std::error_code error;
+        std::filesystem::path absolute = std::filesystem::absolute(path, error);
+        if(error)
+        {
+            absolute = path;
+        }
+        return absolute.lexically_normal().string();
+    }
+
+#ifdef __linux__
+    void FileWatcher::WatchLoop()
+    {
+        std::vector<std::string> changed;
+        alignas(inotify_event) char buffer[4096];
+        pollfd wait = { fd_, POLLIN, 0 };
+        while(!stopping_)
+        {
+            if(poll(&wait, 1, static_cast<int>(WatchInterval.count())) <= 0)
+            {
+                continue;
+            }
+            ssize_t count;
+            while((count = read(fd_, buffer, sizeof(buffer))) > 0)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for(char const *event = buffer; event < buffer + count;)
+                {
+                    inotify_event const &notice = *reinterpret_cast<inotify_event const *>(event);
+                    event += sizeof(inotify_event) + notice.len;
+                    auto const directory = directories_.find(notice.wd);
+                    if(!notice.len || directory == directories_.end())
+                    {
+                        continue;
+                    }
+                    std::string const path = (std::filesystem::path(directory->second) /
+                        notice.name).string();
+                    if(files_.count(path) &&
+                        std::find(changed.begin(), changed.end(), path) == changed.end())
+                    {
+                        changed.push_back(path);
+                    }
+                }
+            }
+            // Reported outside the lock, the callback may add files.
+            for(std::string const &path : changed)
+            {
+                changed_(path);
+            }
+            changed.clear();
+        }
+    }
+#else
+    void FileWatcher::WatchLoop()
+    {
+        std::vector<std::string> changed;
+        while(!stopping_)
+        {
+            std::this_thread::sleep_for(WatchInterval);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for(auto &file : files_)
+                {
+                    std::error_code error;
+                    std::filesystem::file_time_type const time =
+                        std::filesystem::last_write_time(file.first, error);
+                    if(!error && time != file.second)
+                    {
+                        file.second = time;
+                        changed.push_back(file.first);
+                    }
+                }
+            }
+            for(std::string const &path : changed)
+            {
+                changed_(path);
+            }
+            changed.clear();
+        }
+    }
+#endif
+}
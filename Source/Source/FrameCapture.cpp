@@ -0,0 +1,419 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            FrameCapture.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A single frame of render commands saved with everything they reference.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/FrameCapture.hpp"
+#include "Ludus/Graphics/Device.hpp"
+#include "Ludus/Graphics/Renderer.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Ludus
+{
+    /** Marks the start of a capture file. */
+    static constexpr char CaptureMagic[4] = { 'L', 'D', 'F', 'C' };
+    /** Bumped whenever the layout of the file changes. */
+    static constexpr std::uint32_t CaptureVersion = 2;
+
+    /* ===================================================================== */
+    /**
+     * Writes a plain value.
+     * @param stream                The stream to write to.
+     * @param value                 The value to write.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static void Write(std::ostream &stream, T const &value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "Only plain values can be written as bytes.");
+        stream.write(reinterpret_cast<char const *>(&value), sizeof(T));
+    }
+
+    /* ===================================================================== */
+    /**
+     * Writes an array of plain values prefixed by its length.
+     * @param stream                The stream to write to.
+     * @param values                The first value to write.
+     * @param count                 The number of values.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static void WriteArray(std::ostream &stream, T const *values, size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "Only plain values can be written as bytes.");
+        Write(stream, static_cast<std::uint64_t>(count));
+        stream.write(reinterpret_cast<char const *>(values), count * sizeof(T));
+    }
+
+    /* ===================================================================== */
+    /**
+     * Reads a plain value.
+     * @param stream                The stream to read from.
+     * @returns                     The value read.
+     * @throw std::runtime_error    If the stream ends early.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static T Read(std::istream &stream) noexcept(false)
+    {
+        T value;
+        if(!stream.read(reinterpret_cast<char *>(&value), sizeof(T)))
+        {
+            throw std::runtime_error("The frame capture is truncated.");
+        }
+        return value;
+    }
+
+    /* ===================================================================== */
+    /**
+     * Reads an array of plain values prefixed by its length.
+     * @param stream                The stream to read from.
+     * @returns                     The values read.
+     * @throw std::runtime_error    If the stream ends early.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static std::vector<T> ReadArray(std::istream &stream) noexcept(false)
+    {
+        std::uint64_t const count = Read<std::uint64_t>(stream);
+        // Grow as the data actually arrives so a corrupt length can't ask
+        // for the whole address space up front.
+        std::vector<T> values;
+        constexpr std::uint64_t Step = 1 << 16;
+        for(std::uint64_t done = 0; done < count;)
+        {
+            size_t const chunk = static_cast<size_t>(std::min(Step, count - done));
+            values.resize(values.size() + chunk);
+            if(!stream.read(reinterpret_cast<char *>(values.data() + done),
+                chunk * sizeof(T)))
+            {
+                throw std::runtime_error("The frame capture is truncated.");
+            }
+            done += chunk;
+        }
+        return values;
+    }
+
+    FrameCapture::FrameCapture() :
+        width_(0), height_(0)
+    {
+    }
+
+    FrameCapture::FrameCapture(Renderer const &renderer) :
+        width_(renderer.device_.GetWidth()), height_(renderer.device_.GetHeight()),
+        cameras_(renderer.cameras_), vertices_(renderer.vertices_)
+    {
+        // The same resource may be used by many commands, store it once.
+        std::unordered_map<Texture const *, std::int32_t> textures;
+        std::unordered_map<SampledTexture const *, std::int32_t> sampled;
+        std::unordered_map<Mesh const *, std::int32_t> meshes;
+        commands_.reserve(renderer.commands_.size());
+        for(Renderer::Command const &recorded : renderer.commands_)
+        {
+            Command command = {};
+            command.type_ = recorded.type_;
+            command.blend_ = static_cast<std::uint8_t>(recorded.blend_);
+            command.color_ = recorded.color_;
+            command.texture_ = -1;
+            command.mesh_ = -1;
+            command.first_ = recorded.first_;
+            command.count_ = recorded.count_;
+            if(recorded.texture_)
+            {
+                auto const found = textures.emplace(recorded.texture_,
+                    static_cast<std::int32_t>(textures_.size()));
+                if(found.second)
+                {
+                    textures_.push_back(*recorded.texture_);
+                }
+                command.texture_ = found.first->second;
+            }
+            if(recorded.sampled_)
+            {
+                auto const found = sampled.emplace(recorded.sampled_,
+                    static_cast<std::int32_t>(sampledTextures_.size()));
+                if(found.second)
+                {
+                    sampledTextures_.push_back(*recorded.sampled_);
+                }
+                command.texture_ = found.first->second;
+                command.sampled_ = 1;
+            }
+            if(recorded.mesh_)
+            {
+                auto const found = meshes.emplace(recorded.mesh_,
+                    static_cast<std::int32_t>(meshes_.size()));
+                if(found.second)
+                {
+                    meshes_.push_back(*recorded.mesh_);
+                }
+                command.mesh_ = found.first->second;
+                command.instances_ = instances_.size();
+                instances_.insert(instances_.end(), recorded.instances_,
+                    recorded.instances_ + recorded.count_);
+            }
+            commands_.push_back(command);
+        }
+    }
+
+    FrameCapture FrameCapture::Load(std::string const &path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if(!stream)
+        {
+            throw std::runtime_error("The frame capture " + path + " can't be opened.");
+        }
+        char magic[sizeof(CaptureMagic)] = {};
+        stream.read(magic, sizeof(magic));
+        if(!stream || std::memcmp(magic, CaptureMagic, sizeof(magic)) != 0 ||
+            Read<std::uint32_t>(stream) != CaptureVersion)
+        {
+            throw std::runtime_error(path + " is not a supported frame capture.");
+        }
+
+        FrameCapture capture;
+        capture.width_ = Read<std::uint32_t>(stream);
+        capture.height_ = Read<std::uint32_t>(stream);
+        capture.commands_ = ReadArray<Command>(stream);
+
+        std::uint64_t const textureCount = Read<std::uint64_t>(stream);
+        for(std::uint64_t i = 0; i < textureCount; ++i)
+        {
+            std::uint32_t const width = Read<std::uint32_t>(stream);
+            std::uint32_t const height = Read<std::uint32_t>(stream);
+            if(width == 0 || height == 0)
+            {
+                throw std::runtime_error(path + " holds an empty texture.");
+            }
+            capture.textures_.emplace_back(width, height,
+                ReadArray<Color>(stream));
+        }
+        // Only the largest level is stored, the rest is made again.
+        std::uint64_t const sampledCount = Read<std::uint64_t>(stream);
+        for(std::uint64_t i = 0; i < sampledCount; ++i)
+        {
+            std::uint32_t const width = Read<std::uint32_t>(stream);
+            std::uint32_t const height = Read<std::uint32_t>(stream);
+            std::uint8_t const layout = Read<std::uint8_t>(stream);
+            std::uint8_t const filter = Read<std::uint8_t>(stream);
+            if(width == 0 || height == 0 ||
+                layout > static_cast<std::uint8_t>(TextureLayout::TILED) ||
+                filter > static_cast<std::uint8_t>(MipFilter::KAISER))
+            {
+                throw std::runtime_error(path + " holds a broken sampled texture.");
+            }
+            capture.sampledTextures_.emplace_back(Texture(width, height,
+                ReadArray<Color>(stream)), static_cast<TextureLayout>(layout),
+                static_cast<MipFilter>(filter));
+        }
+        std::uint64_t const meshCount = Read<std::uint64_t>(stream);
+        for(std::uint64_t i = 0; i < meshCount; ++i)
+        {
+            std::vector<float> const x = ReadArray<float>(stream);
+            std::vector<float> const y = ReadArray<float>(stream);
+            std::vector<float> const z = ReadArray<float>(stream);
+            if(y.size() != x.size() || z.size() != x.size())
+            {
+                throw std::runtime_error(path + " holds a broken mesh.");
+            }
+            std::vector<Math::Vec3> positions;
+            positions.reserve(x.size());
+            for(size_t j = 0; j < x.size(); ++j)
+            {
+                positions.emplace_back(x[j], y[j], z[j]);
+            }
+            capture.meshes_.emplace_back(positions,
+                ReadArray<std::uint32_t>(stream));
+        }
+        capture.cameras_ = ReadArray<Math::Mat4>(stream);
+        capture.vertices_ = ReadArray<Vertex2D>(stream);
+        std::vector<Math::Mat4> const transforms = ReadArray<Math::Mat4>(stream);
+        std::vector<Color> const colors = ReadArray<Color>(stream);
+        if(colors.size() != transforms.size())
+        {
+            throw std::runtime_error(path + " holds broken instances.");
+        }
+        capture.instances_.resize(transforms.size());
+        for(size_t i = 0; i < transforms.size(); ++i)
+        {
+            capture.instances_[i] = Instance{ transforms[i], colors[i] };
+        }
+
+        // Every index has to land inside the arrays it points into, checked
+        // without adding them up so huge ones can't wrap around.
+        for(Command const &command : capture.commands_)
+        {
+            bool valid = command.sampled_ <= 1 && command.texture_ >= -1 &&
+                command.texture_ < static_cast<std::int64_t>(command.sampled_ ?
+                    capture.sampledTextures_.size() : capture.textures_.size());
+            switch(command.type_)
+            {
+            case Renderer::Command::CLEAR:
+                break;
+            case Renderer::Command::DRAW_QUADS:
+                valid = valid && command.first_ <= capture.vertices_.size() / 4 &&
+                    command.count_ <= capture.vertices_.size() / 4 - command.first_;
+                break;
+            case Renderer::Command::DRAW_INSTANCED:
+                valid = valid && command.mesh_ >= 0 &&
+                    command.mesh_ < static_cast<std::int64_t>(capture.meshes_.size()) &&
+                    command.first_ < capture.cameras_.size() &&
+                    command.instances_ <= capture.instances_.size() &&
+                    command.count_ <= capture.instances_.size() - command.instances_;
+                break;
+            default:
+                valid = false;
+                break;
+            }
+            if(!valid)
+            {
+                throw std::runtime_error(path + " holds a broken command.");
+            }
+        }
+        return capture;
+    }
+
+    void FrameCapture::Save(std::string const &path) const
+    {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        if(!stream)
+        {
+            throw std::runtime_error("The frame capture " + path + " can't be created.");
+        }
+        stream.write(CaptureMagic, sizeof(CaptureMagic));
+        Write(stream, CaptureVersion);
+        Write(stream, static_cast<std::uint32_t>(width_));
+        Write(stream, static_cast<std::uint32_t>(height_));
+        WriteArray(stream, commands_.data(), commands_.size());
+
+        Write(stream, static_cast<std::uint64_t>(textures_.size()));
+        for(Texture const &texture : textures_)
+        {
+            Write(stream, static_cast<std::uint32_t>(texture.GetWidth()));
+            Write(stream, static_cast<std::uint32_t>(texture.GetHeight()));
+            WriteArray(stream, texture.GetData(),
+                static_cast<size_t>(texture.GetWidth()) * texture.GetHeight());
+        }
+        Write(stream, static_cast<std::uint64_t>(sampledTextures_.size()));
+        std::vector<Color> texels;
+        for(SampledTexture const &texture : sampledTextures_)
+        {
+            Write(stream, static_cast<std::uint32_t>(texture.GetWidth()));
+            Write(stream, static_cast<std::uint32_t>(texture.GetHeight()));
+            Write(stream, static_cast<std::uint8_t>(texture.GetLayout()));
+            Write(stream, static_cast<std::uint8_t>(texture.GetFilter()));
+            texels.clear();
+            for(unsigned y = 0; y < texture.GetHeight(); ++y)
+            {
+                for(unsigned x = 0; x < texture.GetWidth(); ++x)
+                {
+                    texels.push_back(texture.GetTexel(0, x, y));
+                }
+            }
+            WriteArray(stream, texels.data(), texels.size());
+        }
+        Write(stream, static_cast<std::uint64_t>(meshes_.size()));
+        for(Mesh const &mesh : meshes_)
+        {
+            Math::PointStream const positions = mesh.GetPositions();
+            WriteArray(stream, positions.x_, mesh.GetVertexCount());
+            WriteArray(stream, positions.y_, mesh.GetVertexCount());
+            WriteArray(stream, positions.z_, mesh.GetVertexCount());
+            WriteArray(stream, mesh.GetIndices(), mesh.GetTriangleCount() * 3);
+        }
+        WriteArray(stream, cameras_.data(), cameras_.size());
+        WriteArray(stream, vertices_.data(), vertices_.size());
+        // Split so the padding after the color never reaches the file.
+        std::vector<Math::Mat4> transforms;
+        std::vector<Color> colors;
+        transforms.reserve(instances_.size());
+        colors.reserve(instances_.size());
+        for(Instance const &instance : instances_)
+        {
+            transforms.push_back(instance.transform_);
+            colors.push_back(instance.color_);
+        }
+        WriteArray(stream, transforms.data(), transforms.size());
+        WriteArray(stream, colors.data(), colors.size());
+        if(!stream.flush())
+        {
+            throw std::runtime_error("The frame capture " + path + " can't be written.");
+        }
+    }
+
+    void FrameCapture::Record(Renderer &renderer) const
+    {
+        // All the quads go in one go, commands then index past the base.
+        size_t const base = renderer.AllocateQuads(vertices_.size() / 4);
+        std::copy(vertices_.begin(), vertices_.end(),
+            renderer.GetQuadVertices(base));
+        std::uint64_t camera = cameras_.size();
+        for(Command const &command : commands_)
+        {
+            Texture const *texture = command.texture_ < 0 || command.sampled_ ? nullptr :
+                &textures_[command.texture_];
+            SampledTexture const *sampled = command.texture_ < 0 || !command.sampled_ ?
+                nullptr : &sampledTextures_[command.texture_];
+            switch(command.type_)
+            {
+            case Renderer::Command::CLEAR:
+                renderer.Clear(command.color_);
+                break;
+            case Renderer::Command::DRAW_QUADS:
+                if(sampled)
+                {
+                    renderer.DrawSampledQuads(base + command.first_, command.count_,
+                        sampled, static_cast<BlendMode>(command.blend_));
+                }
+                else
+                {
+                    renderer.DrawQuads(base + command.first_, command.count_,
+                        texture, static_cast<BlendMode>(command.blend_));
+                }
+                break;
+            case Renderer::Command::DRAW_INSTANCED:
+                if(camera != command.first_)
+                {
+                    camera = command.first_;
+                    renderer.SetViewProjection(cameras_[camera]);
+                }
+                renderer.DrawInstanced(meshes_[command.mesh_],
+                    instances_.data() + command.instances_, command.count_);
+                break;
+            }
+        }
+    }
+
+    unsigned FrameCapture::GetWidth() const
+    {
+        return width_;
+    }
+
+    unsigned FrameCapture::GetHeight() const
+    {
+        return height_;
+    }
+
+    size_t FrameCapture::GetCommandCount() const
+    {
+        return commands_.size();
+    }
+}
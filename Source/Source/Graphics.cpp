@@ -20,12 +20,14 @@
 /* Includes */
 /* ========================================================================= */
 #include "Ludus/Graphics/Window.hpp"
+#include "Ludus/Graphics/Device.hpp"
+#include "Ludus/Graphics/Renderer.hpp"
 #include "Ludus/Graphics/Graphics.hpp"
 
 namespace Ludus
 {
     Graphics::Graphics(DeviceType const &renderAPI) :
-        window_()
+        window_(), device_(), renderer_()
     {
         // Set the default window and swapchain settings for the window.
         Window::Settings settings;
@@ -38,6 +40,12 @@ namespace Ludus
         swapchain.height_ = 600;
 
         window_ = std::make_unique<Window>(settings, swapchain);
+        device_ = std::make_unique<Device>(swapchain.width_, swapchain.height_);
+        renderer_ = std::make_unique<Renderer>(*device_);
+    }
+
+    Graphics::~Graphics()
+    {
     }
 
     Window const &Graphics::GetWindow() const
@@ -49,4 +57,14 @@ namespace Ludus
     {
         return *window_;
     }
+
+    Device &Graphics::GetDevice()
+    {
+        return *device_;
+    }
+
+    Renderer &Graphics::GetRenderer()
+    {
+        return *renderer_;
+    }
 }
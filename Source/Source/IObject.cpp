@@ -10,6 +10,7 @@
  * Provides the following functions:
  * - dtor
  * - Initialize
+ * - BeginFrame
  * - Update
  * - FixedUpdate
  * - PreDraw
@@ -33,6 +34,10 @@ namespace Ludus
     {
     }
 
+    void IObject::BeginFrame()
+    {
+    }
+
     void IObject::Update(const double &dt)
     {
         UNREFERENCED(dt);
@@ -0,0 +1,301 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Input.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Collects the input of the keyboard, the mouse and the gamepads.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/Input.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace Ludus
+{
+    InputState::InputState() :
+        axes_(), pointerX_(0.0f), pointerY_(0.0f)
+    {
+    }
+
+    void InputState::Apply(InputEvent const &event)
+    {
+        bool const down = event.action_ == InputAction::PRESS;
+        switch(event.device_)
+        {
+        case InputDevice::KEYBOARD:
+            if(event.code_ < KeyCount && event.action_ != InputAction::MOVE)
+            {
+                keys_[event.code_] = down;
+            }
+            break;
+        case InputDevice::MOUSE:
+            if(event.action_ == InputAction::MOVE)
+            {
+                pointerX_ = event.x_;
+                pointerY_ = event.y_;
+            }
+            else if(event.code_ < MouseButtonCount)
+            {
+                mouseButtons_[event.code_] = down;
+            }
+            break;
+        case InputDevice::GAMEPAD:
+            if(event.player_ >= PlayerCount)
+            {
+                break;
+            }
+            if(event.action_ == InputAction::MOVE)
+            {
+                if(event.code_ < GamepadAxisCount)
+                {
+                    axes_[event.player_][event.code_] = event.x_;
+                }
+            }
+            else if(event.code_ < GamepadButtonCount)
+            {
+                gamepadButtons_[event.player_][event.code_] = down;
+            }
+            break;
+        }
+    }
+
+    bool InputState::IsDown(InputDevice device, std::uint16_t code, std::uint8_t player) const
+    {
+        switch(device)
+        {
+        case InputDevice::KEYBOARD:
+            return code < KeyCount && keys_[code];
+        case InputDevice::MOUSE:
+            return code < MouseButtonCount && mouseButtons_[code];
+        case InputDevice::GAMEPAD:
+            return player < PlayerCount && code < GamepadButtonCount &&
+                gamepadButtons_[player][code];
+        }
+        return false;
+    }
+
+    float InputState::GetAxis(std::uint16_t axis, std::uint8_t player) const
+    {
+        return player < PlayerCount && axis < GamepadAxisCount ? axes_[player][axis] : 0.0f;
+    }
+
+    float InputState::GetPointerX() const
+    {
+        return pointerX_;
+    }
+
+    float InputState::GetPointerY() const
+    {
+        return pointerY_;
+    }
+
+    ScriptedInput::ScriptedInput(std::vector<InputEvent> script) :
+        script_(std::move(script)), next_(0), start_(-1)
+    {
+    }
+
+    void ScriptedInput::Poll(Input &input, std::int64_t now)
+    {
+        if(start_ < 0)
+        {
+            start_ = now;
+        }
+        for(; next_ < script_.size() && start_ + script_[next_].time_ <= now; ++next_)
+        {
+            InputEvent event = script_[next_];
+            event.time_ += start_;
+            input.Push(event);
+        }
+    }
+
+    bool ScriptedInput::IsDone() const
+    {
+        return next_ == script_.size();
+    }
+
+    Input::Input() :
+        Input(4096)
+    {
+    }
+
+    Input::Input(size_t capacity) :
+        Node("Input"), enqueue_(0), dequeue_(0), dropped_(0), stepTime_(0),
+        stepLength_(0), frameTime_(-1)
+    {
+        size_t size = 2;
+        while(size < capacity)
+        {
+            size <<= 1;
+        }
+        cells_ = std::make_unique<Cell[]>(size);
+        mask_ = size - 1;
+        for(size_t i = 0; i < size; ++i)
+        {
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool Input::Push(InputEvent const &event)
+    {
+        // Every slot counts the laps of the ring: a writer may only take a
+        // slot the reader freed on the last lap.
+        size_t position = enqueue_.load(std::memory_order_relaxed);
+        Cell *cell;
+        for(;;)
+        {
+            cell = &cells_[position & mask_];
+            size_t const sequence = cell->sequence_.load(std::memory_order_acquire);
+            std::intptr_t const difference = static_cast<std::intptr_t>(sequence) -
+                static_cast<std::intptr_t>(position);
+            if(difference == 0)
+            {
+                if(enqueue_.compare_exchange_weak(position, position + 1,
+                    std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(difference < 0)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                position = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->event_ = event;
+        cell->sequence_.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    void Input::AddSource(std::unique_ptr<InputSource> source)
+    {
+        sources_.push_back(std::move(source));
+    }
+
+    void Input::BeginFrame()
+    {
+        std::int64_t const now = Now();
+        for(std::unique_ptr<InputSource> const &source : sources_)
+        {
+            source->Poll(*this, now);
+        }
+
+        frameEvents_.clear();
+        for(;;)
+        {
+            Cell &cell = cells_[dequeue_ & mask_];
+            if(cell.sequence_.load(std::memory_order_acquire) != dequeue_ + 1)
+            {
+                break;
+            }
+            frameEvents_.push_back(cell.event_);
+            cell.sequence_.store(dequeue_ + mask_ + 1, std::memory_order_release);
+            ++dequeue_;
+        }
+        // Devices read on different threads may push slightly out of order.
+        std::stable_sort(frameEvents_.begin(), frameEvents_.end(),
+            [](InputEvent const &lhs, InputEvent const &rhs) { return lhs.time_ < rhs.time_; });
+        previous_ = current_;
+        for(InputEvent const &event : frameEvents_)
+        {
+            current_.Apply(event);
+        }
+
+        // The fixed steps trail the frames by less than a step. If the
+        // engine dropped steps to catch up, so do they.
+        if(frameTime_ < 0 || stepTime_ + stepLength_ < frameTime_)
+        {
+            stepTime_ = frameTime_ < 0 ? now : frameTime_;
+        }
+        frameTime_ = now;
+        pending_.insert(pending_.end(), frameEvents_.begin(), frameEvents_.end());
+    }
+
+    void Input::FixedUpdate(double const &fixedDt)
+    {
+        stepLength_ = static_cast<std::int64_t>(fixedDt * 1e9);
+        stepTime_ += stepLength_;
+        // Takes what happened before the step ends, in order.
+        auto const end = std::find_if(pending_.begin(), pending_.end(),
+            [this](InputEvent const &event) { return event.time_ >= stepTime_; });
+        stepEvents_.assign(pending_.begin(), end);
+        pending_.erase(pending_.begin(), end);
+        for(InputEvent const &event : stepEvents_)
+        {
+            stepState_.Apply(event);
+        }
+    }
+
+    InputState const &Input::GetState() const
+    {
+        return current_;
+    }
+
+    InputState const &Input::GetPreviousState() const
+    {
+        return previous_;
+    }
+
+    std::vector<InputEvent> const &Input::GetFrameEvents() const
+    {
+        return frameEvents_;
+    }
+
+    bool Input::WasPressed(InputDevice device, std::uint16_t code, std::uint8_t player) const
+    {
+        return Happened(device, code, player, InputAction::PRESS);
+    }
+
+    bool Input::WasReleased(InputDevice device, std::uint16_t code, std::uint8_t player) const
+    {
+        return Happened(device, code, player, InputAction::RELEASE);
+    }
+
+    InputState const &Input::GetStepState() const
+    {
+        return stepState_;
+    }
+
+    std::vector<InputEvent> const &Input::GetStepEvents() const
+    {
+        return stepEvents_;
+    }
+
+    std::int64_t Input::GetStepTime() const
+    {
+        return stepTime_;
+    }
+
+    size_t Input::GetDroppedCount() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t Input::Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    bool Input::Happened(InputDevice device, std::uint16_t code, std::uint8_t player,
+        InputAction action) const
+    {
+        return std::any_of(frameEvents_.begin(), frameEvents_.end(),
+            [=](InputEvent const &event)
+            {
+                return event.device_ == device && event.code_ == code &&
+                    event.player_ == player && event.action_ == action;
+            });
+    }
+}
@@ -0,0 +1,202 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            JobSystem.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides the worker threads of the engine.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <algorithm>
+
+namespace Ludus
+{
+    JobCounter::JobCounter() :
+        pending_(0), failed_(false), error_()
+    {
+    }
+
+    bool JobCounter::IsDone() const
+    {
+        return pending_.load(std::memory_order_acquire) == 0;
+    }
+
+    JobSystem::JobSystem() :
+        JobSystem(std::max(std::thread::hardware_concurrency(), 1u) - 1u)
+    {
+    }
+
+    JobSystem::JobSystem(unsigned workerCount) :
+        Node("JobSystem"), stopping_(false)
+    {
+        workers_.reserve(workerCount);
+        for(unsigned i = 0; i < workerCount; ++i)
+        {
+            workers_.emplace_back(&JobSystem::WorkerLoop, this);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        available_.notify_all();
+        for(std::thread &worker : workers_)
+        {
+            worker.join();
+        }
+        // Anything left over still has to run, somebody may be waiting.
+        while(RunOne())
+        {
+        }
+    }
+
+    void JobSystem::Schedule(Job job, JobCounter *counter)
+    {
+        if(counter)
+        {
+            Expect(*counter, 1);
+        }
+        ScheduleExpected(std::move(job), counter);
+    }
+
+    void JobSystem::Expect(JobCounter &counter, size_t count)
+    {
+        counter.pending_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void JobSystem::ScheduleExpected(Job job, JobCounter *counter)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(Entry{ std::move(job), counter });
+        }
+        available_.notify_one();
+    }
+
+    void JobSystem::Wait(JobCounter const &counter)
+    {
+        while(!counter.IsDone())
+        {
+            if(!RunOne())
+            {
+                std::this_thread::yield();
+            }
+        }
+        // Written before the failed job signalled the counter.
+        if(counter.error_)
+        {
+            std::rethrow_exception(counter.error_);
+        }
+    }
+
+    void JobSystem::ParallelFor(size_t count, size_t grain, RangeJob const &job)
+    {
+        grain = std::max<size_t>(grain, 1);
+        // Not worth going through the queue for a single piece.
+        if(workers_.empty() || count <= grain)
+        {
+            if(count)
+            {
+                job(0, count);
+            }
+            return;
+        }
+
+        JobCounter counter;
+        // The calling thread keeps the first piece for itself.
+        for(size_t begin = grain; begin < count; begin += grain)
+        {
+            size_t const end = std::min(begin + grain, count);
+            Schedule([&job, begin, end]() { job(begin, end); }, &counter);
+        }
+        try
+        {
+            job(0, grain);
+        }
+        catch(...)
+        {
+            // The queued pieces still point at the counter and the job.
+            Fail(counter, std::current_exception());
+        }
+        Wait(counter);
+    }
+
+    unsigned JobSystem::GetWorkerCount() const
+    {
+        return static_cast<unsigned>(workers_.size());
+    }
+
+    bool JobSystem::RunOne()
+    {
+        Entry entry;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(queue_.empty())
+            {
+                return false;
+            }
+            entry = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        Execute(entry);
+        return true;
+    }
+
+    void JobSystem::Execute(Entry &entry)
+    {
+        try
+        {
+            entry.job_();
+        }
+        catch(...)
+        {
+            if(entry.counter_)
+            {
+                Fail(*entry.counter_, std::current_exception());
+            }
+        }
+        if(entry.counter_)
+        {
+            entry.counter_->pending_.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void JobSystem::Fail(JobCounter &counter, std::exception_ptr error)
+    {
+        if(!counter.failed_.exchange(true, std::memory_order_relaxed))
+        {
+            counter.error_ = std::move(error);
+        }
+    }
+
+    void JobSystem::WorkerLoop()
+    {
+        for(;;)
+        {
+            Entry entry;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                available_.wait(lock, [this]()
+                    { return stopping_ || !queue_.empty(); });
+                if(queue_.empty())
+                {
+                    return;
+                }
+                entry = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            Execute(entry);
+        }
+    }
+}
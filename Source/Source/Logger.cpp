@@ -0,0 +1,424 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Logger.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Logs from anywhere without slowing down the thread logging.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/Logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace Ludus
+{
+    /** How long the background thread sleeps when there is nothing to do. */
+    static constexpr std::chrono::milliseconds WriteInterval(1);
+    /** Hands out the ids of the loggers. */
+    static std::atomic<std::uint64_t> loggerCount(0);
+
+    /* ===================================================================== */
+    /**
+     * The ring of a thread for one logger. Tells the logger when the thread
+     * exits, so the ring can go once read.
+    **/
+    /* ===================================================================== */
+    struct Logger::LocalRing
+    {
+        /* ================================================================= */
+        /**
+         * Holds the ring of a logger.
+         * @param logger        The id of the logger.
+         * @param ring          The ring.
+        **/
+        /* ================================================================= */
+        LocalRing(std::uint64_t logger, std::shared_ptr<Ring> ring) :
+            logger_(logger), ring_(std::move(ring))
+        {
+        }
+        /* ================================================================= */
+        /**
+         * Gives up the ring.
+        **/
+        /* ================================================================= */
+        ~LocalRing()
+        {
+            if(ring_)
+            {
+                ring_->abandoned_.store(true, std::memory_order_release);
+            }
+        }
+        LocalRing(LocalRing const &) = delete;
+        LocalRing &operator=(LocalRing const &) = delete;
+        LocalRing(LocalRing &&) = default;
+        LocalRing &operator=(LocalRing &&) = default;
+
+        /** The id of the logger. */
+        std::uint64_t logger_;
+        /** The ring, shared with the logger. */
+        std::shared_ptr<Ring> ring_;
+    };
+
+    size_t LogStringArgument::GetSize(std::string_view value)
+    {
+        return sizeof(std::uint32_t) + value.size();
+    }
+
+    void LogStringArgument::Encode(std::uint8_t *&bytes, std::string_view value)
+    {
+        std::uint32_t const size = static_cast<std::uint32_t>(value.size());
+        std::memcpy(bytes, &size, sizeof(size));
+        std::memcpy(bytes + sizeof(size), value.data(), size);
+        bytes += sizeof(size) + size;
+    }
+
+    void LogStringArgument::Append(std::uint8_t const *&bytes, std::string &message)
+    {
+        std::uint32_t size;
+        std::memcpy(&size, bytes, sizeof(size));
+        message.append(reinterpret_cast<char const *>(bytes + sizeof(size)), size);
+        bytes += sizeof(size) + size;
+    }
+
+    Logger::Ring::Ring(size_t size, unsigned thread) :
+        bytes_(size), thread_(thread), head_(0), reserved_(0), cachedTail_(0), tail_(0),
+        dropped_(0), abandoned_(false), closed_(false)
+    {
+    }
+
+    std::uint8_t *Logger::Ring::Reserve(size_t size)
+    {
+        size_t const capacity = bytes_.size();
+        std::uint64_t head = head_.load(std::memory_order_relaxed);
+        size_t const offset = static_cast<size_t>(head & (capacity - 1));
+        // A message never wraps around, the end of the ring is skipped.
+        size_t const skip = capacity - offset < size ? capacity - offset : 0;
+        if(size > capacity / 2 || head + skip + size - cachedTail_ > capacity)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if(size > capacity / 2 || head + skip + size - cachedTail_ > capacity)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+        if(skip)
+        {
+            // Too short for a header, the reader skips it without one.
+            if(skip >= sizeof(Header))
+            {
+                Header const padding = { static_cast<std::uint32_t>(skip), nullptr, nullptr, 0 };
+                std::memcpy(&bytes_[offset], &padding, sizeof(Header));
+            }
+            head += skip;
+        }
+        reserved_ = head + size;
+        return &bytes_[static_cast<size_t>(head & (capacity - 1))];
+    }
+
+    void Logger::Ring::Commit()
+    {
+        head_.store(reserved_, std::memory_order_release);
+    }
+
+    Logger::Logger(size_t ringSize) :
+        id_(++loggerCount), ringSize_(std::max<size_t>(ringSize, 256)), start_(Now()),
+        level_(LogLevel::TRACE), categories_(~0u), threadCount_(0), droppedGone_(0),
+        flushRequested_(0),
+        flushCompleted_(0), stopping_(false)
+    {
+        // Rounded up to a power of two, so positions wrap with a mask.
+        size_t size = 1;
+        while(size < ringSize_)
+        {
+            size <<= 1;
+        }
+        ringSize_ = size;
+        writer_ = std::thread(&Logger::WriterLoop, this);
+    }
+
+    Logger::~Logger()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();
+        for(std::shared_ptr<Ring> const &ring : rings_)
+        {
+            ring->closed_.store(true, std::memory_order_release);
+        }
+    }
+
+    void Logger::AddSink(Sink sink)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sinks_.push_back(std::move(sink));
+    }
+
+    void Logger::SetLevel(LogLevel level)
+    {
+        level_.store(level, std::memory_order_relaxed);
+    }
+
+    void Logger::SetCategoryEnabled(LogCategory category, bool enabled)
+    {
+        std::uint32_t const bit = 1u << static_cast<unsigned>(category);
+        if(enabled)
+        {
+            categories_.fetch_or(bit, std::memory_order_relaxed);
+        }
+        else
+        {
+            categories_.fetch_and(~bit, std::memory_order_relaxed);
+        }
+    }
+
+    bool Logger::IsEnabled(LogLevel level, LogCategory category) const
+    {
+        return level >= level_.load(std::memory_order_relaxed) &&
+            (categories_.load(std::memory_order_relaxed) >> static_cast<unsigned>(category) & 1u);
+    }
+
+    void Logger::Flush()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::uint64_t const ticket = ++flushRequested_;
+        wake_.notify_one();
+        flushed_.wait(lock, [this, ticket]() { return flushCompleted_ >= ticket; });
+    }
+
+    size_t Logger::GetDroppedCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t dropped = droppedGone_;
+        for(std::shared_ptr<Ring> const &ring : rings_)
+        {
+            dropped += ring->dropped_.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+    Logger &Logger::GetDefault()
+    {
+        static Logger logger;
+        static bool const console = (logger.AddSink(&Logger::WriteToConsole), true);
+        UNREFERENCED(console);
+        return logger;
+    }
+
+    std::string Logger::FormatLine(LogRecord const &record)
+    {
+        char prefix[64];
+        int const length = std::snprintf(prefix, sizeof(prefix), "[%12.6f] %-7s %-8s ",
+            static_cast<double>(record.time_) / 1e9, GetLevelName(record.site_->level_),
+            GetCategoryName(record.site_->category_));
+        std::string line(prefix, static_cast<size_t>(std::max(length, 0)));
+        line += record.message_;
+        return line;
+    }
+
+    void Logger::WriteToConsole(LogRecord const &record)
+    {
+        std::string line = FormatLine(record);
+        line += '\n';
+        std::fwrite(line.data(), 1, line.size(), stderr);
+    }
+
+    char const *Logger::GetLevelName(LogLevel level)
+    {
+        switch(level)
+        {
+        case LogLevel::TRACE:
+            return "TRACE";
+        case LogLevel::DEBUG:
+            return "DEBUG";
+        case LogLevel::INFO:
+            return "INFO";
+        case LogLevel::WARNING:
+            return "WARNING";
+        case LogLevel::ERROR:
+            return "ERROR";
+        case LogLevel::FATAL:
+            return "FATAL";
+        }
+        return "?";
+    }
+
+    char const *Logger::GetCategoryName(LogCategory category)
+    {
+        switch(category)
+        {
+        case LogCategory::GENERAL:
+            return "General";
+        case LogCategory::ENGINE:
+            return "Engine";
+        case LogCategory::ASSETS:
+            return "Assets";
+        case LogCategory::GRAPHICS:
+            return "Graphics";
+        case LogCategory::ENTITY:
+            return "Entity";
+        case LogCategory::INPUT:
+            return "Input";
+        case LogCategory::GAMEPLAY:
+            return "Gameplay";
+        }
+        return "?";
+    }
+
+    Logger::Ring &Logger::GetRing()
+    {
+        thread_local std::vector<LocalRing> rings;
+        for(LocalRing const &local : rings)
+        {
+            if(local.logger_ == id_)
+            {
+                return *local.ring_;
+            }
+        }
+        // First message of this thread to this logger, forget the rings of
+        // the loggers gone.
+        rings.erase(std::remove_if(rings.begin(), rings.end(), [](LocalRing const &local)
+            { return local.ring_->closed_.load(std::memory_order_acquire); }), rings.end());
+        std::shared_ptr<Ring> ring;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ring = std::make_shared<Ring>(ringSize_, threadCount_++);
+            rings_.push_back(ring);
+        }
+        rings.emplace_back(id_, std::move(ring));
+        return *rings.back().ring_;
+    }
+
+    bool Logger::Drain(Ring &ring, std::vector<LogRecord> &records) const
+    {
+        size_t const capacity = ring.bytes_.size();
+        std::uint64_t tail = ring.tail_.load(std::memory_order_relaxed);
+        std::uint64_t const head = ring.head_.load(std::memory_order_acquire);
+        if(tail == head)
+        {
+            return false;
+        }
+        while(tail != head)
+        {
+            size_t const offset = static_cast<size_t>(tail & (capacity - 1));
+            if(capacity - offset < sizeof(Header))
+            {
+                tail += capacity - offset;
+                continue;
+            }
+            Header header;
+            std::memcpy(&header, &ring.bytes_[offset], sizeof(Header));
+            if(header.site_)
+            {
+                LogRecord record = { header.site_, header.time_ - start_, ring.thread_, {} };
+                header.decoder_(header.site_->format_, &ring.bytes_[offset + sizeof(Header)],
+                    record.message_);
+                records.push_back(std::move(record));
+            }
+            tail += header.size_;
+        }
+        ring.tail_.store(tail, std::memory_order_release);
+        return true;
+    }
+
+    void Logger::WriterLoop()
+    {
+        std::vector<std::shared_ptr<Ring> > rings;
+        std::vector<LogRecord> records;
+        std::vector<Sink> sinks;
+        for(;;)
+        {
+            std::uint64_t ticket;
+            bool stopping;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ticket = flushRequested_;
+                stopping = stopping_;
+                // Rings of threads gone are dropped once read.
+                rings_.erase(std::remove_if(rings_.begin(), rings_.end(),
+                    [this](std::shared_ptr<Ring> const &ring)
+                    {
+                        if(!ring->abandoned_.load(std::memory_order_acquire) ||
+                            ring->tail_.load(std::memory_order_relaxed) !=
+                            ring->head_.load(std::memory_order_acquire))
+                        {
+                            return false;
+                        }
+                        droppedGone_ += ring->dropped_.load(std::memory_order_relaxed);
+                        return true;
+                    }), rings_.end());
+                rings = rings_;
+            }
+            // Everything published before the ticket was taken is read now.
+            for(std::shared_ptr<Ring> const &ring : rings)
+            {
+                Drain(*ring, records);
+            }
+            // The messages of the threads read together go back in order.
+            std::stable_sort(records.begin(), records.end(),
+                [](LogRecord const &lhs, LogRecord const &rhs) { return lhs.time_ < rhs.time_; });
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if(!records.empty())
+                {
+                    // Called outside the lock, a sink may add sinks or log.
+                    sinks = sinks_;
+                    lock.unlock();
+                    for(LogRecord const &record : records)
+                    {
+                        for(Sink const &sink : sinks)
+                        {
+                            sink(record);
+                        }
+                    }
+                    lock.lock();
+                }
+                flushCompleted_ = ticket;
+                flushed_.notify_all();
+                if(stopping)
+                {
+                    return;
+                }
+                if(records.empty())
+                {
+                    wake_.wait_for(lock, WriteInterval, [this, ticket]()
+                        { return stopping_ || flushRequested_ != ticket; });
+                }
+            }
+            records.clear();
+        }
+    }
+
+    std::int64_t Logger::Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    char const *Logger::AppendLiteral(char const *format, std::string &message)
+    {
+        char const *begin = format;
+        for(; *format; ++format)
+        {
+            if(format[0] == '{' && format[1] == '}')
+            {
+                message.append(begin, format);
+                return format + 2;
+            }
+        }
+        message.append(begin, format);
+        return format;
+    }
+}
@@ -0,0 +1,124 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            MappedFile.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Maps a whole file read only into memory.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/MappedFile.hpp"
+#include <stdexcept>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Ludus
+{
+#ifdef _WIN32
+    MappedFile::MappedFile(std::string const &path) :
+        data_(nullptr), size_(0)
+    {
+        HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("The file " + path + " can't be opened.");
+        }
+        LARGE_INTEGER size;
+        if(!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            throw std::runtime_error("The file " + path + " can't be opened.");
+        }
+        size_ = static_cast<size_t>(size.QuadPart);
+        if(size_ != 0)
+        {
+            HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY,
+                0, 0, nullptr);
+            if(mapping)
+            {
+                data_ = static_cast<std::uint8_t const *>(
+                    MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                // The view keeps the mapping alive on its own.
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+        if(size_ != 0 && !data_)
+        {
+            throw std::runtime_error("The file " + path + " can't be mapped.");
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if(data_)
+        {
+            UnmapViewOfFile(data_);
+        }
+    }
+#else
+    MappedFile::MappedFile(std::string const &path) :
+        data_(nullptr), size_(0)
+    {
+        int const file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(file < 0)
+        {
+            throw std::runtime_error("The file " + path + " can't be opened.");
+        }
+        struct stat status;
+        if(fstat(file, &status) != 0)
+        {
+            close(file);
+            throw std::runtime_error("The file " + path + " can't be opened.");
+        }
+        size_ = static_cast<size_t>(status.st_size);
+        if(size_ != 0)
+        {
+            void *const data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+            if(data != MAP_FAILED)
+            {
+                data_ = static_cast<std::uint8_t const *>(data);
+            }
+        }
+        // The mapping keeps the file alive on its own.
+        close(file);
+        if(size_ != 0 && !data_)
+        {
+            throw std::runtime_error("The file " + path + " can't be mapped.");
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if(data_)
+        {
+            munmap(const_cast<std::uint8_t *>(data_), size_);
+        }
+    }
+#endif
+
+    std::uint8_t const *MappedFile::GetData() const
+    {
+        return data_;
+    }
+
+    size_t MappedFile::GetSize() const
+    {
+        return size_;
+    }
+}
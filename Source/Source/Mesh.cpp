@@ -0,0 +1,91 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Mesh.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Triangle geometry drawn by the renderer.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/Mesh.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Ludus
+{
+    Mesh::Mesh(std::vector<Math::Vec3> const &positions,
+        std::vector<std::uint32_t> indices) :
+        indices_(std::move(indices)), center_(), radius_(0.0f)
+    {
+        if(indices_.size() % 3 != 0)
+        {
+            throw std::invalid_argument("The mesh indices don't form whole triangles.");
+        }
+        for(std::uint32_t index : indices_)
+        {
+            if(index >= positions.size())
+            {
+                throw std::invalid_argument("A mesh index points past the vertices.");
+            }
+        }
+
+        x_.reserve(positions.size());
+        y_.reserve(positions.size());
+        z_.reserve(positions.size());
+        // The sphere around the bounding box is loose but cheap.
+        Math::Vec3 low = positions.empty() ? Math::Vec3() : positions.front();
+        Math::Vec3 high = low;
+        for(Math::Vec3 const &position : positions)
+        {
+            x_.push_back(position.x_);
+            y_.push_back(position.y_);
+            z_.push_back(position.z_);
+            low = Math::Vec3(std::min(low.x_, position.x_),
+                std::min(low.y_, position.y_), std::min(low.z_, position.z_));
+            high = Math::Vec3(std::max(high.x_, position.x_),
+                std::max(high.y_, position.y_), std::max(high.z_, position.z_));
+        }
+        center_ = (low + high) * 0.5f;
+        for(Math::Vec3 const &position : positions)
+        {
+            radius_ = std::max(radius_, Math::Length(position - center_));
+        }
+    }
+
+    Math::PointStream Mesh::GetPositions() const
+    {
+        return Math::PointStream{ x_.data(), y_.data(), z_.data() };
+    }
+
+    size_t Mesh::GetVertexCount() const
+    {
+        return x_.size();
+    }
+
+    std::uint32_t const *Mesh::GetIndices() const
+    {
+        return indices_.data();
+    }
+
+    size_t Mesh::GetTriangleCount() const
+    {
+        return indices_.size() / 3;
+    }
+
+    Math::Vec3 const &Mesh::GetBoundsCenter() const
+    {
+        return center_;
+    }
+
+    float Mesh::GetBoundsRadius() const
+    {
+        return radius_;
+    }
+}
@@ -33,6 +33,9 @@ namespace Ludus
     {
         children_.push_back(child);
         child->parent_ = this;
+        // The child's world matrix now depends on this node.
+        child->transform_.parent_ = &transform_;
+        child->transform_.MarkDirty();
     }
 
     const Node &Node::GetParent() const
@@ -50,6 +53,16 @@ namespace Ludus
         return *parent_;
     }
 
+    const Transform &Node::GetTransform() const
+    {
+        return transform_;
+    }
+
+    Transform &Node::GetTransform()
+    {
+        return transform_;
+    }
+
     const Node &Node::At(const unsigned &i) const
     {
         return *children_.at(i);
@@ -98,7 +111,7 @@ namespace Ludus
 
     size_t Node::Size() const
     {
-        return 0u;
+        return children_.size();
     }
 
     Node::Iterator Node::begin()
@@ -0,0 +1,422 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Pack.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Packs many asset files into a single archive and reads them back.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Assets/Pack.hpp"
+#include "Ludus/Assets/Compression.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace Ludus
+{
+    /** Marks the start of a pack. */
+    static constexpr char PackMagic[4] = { 'L', 'D', 'P', 'K' };
+    /** Bumped whenever the layout of the file changes. */
+    static constexpr std::uint32_t PackVersion = 1;
+    /** Every section starts on a multiple of this. */
+    static constexpr std::uint64_t SectionAlignment = 16;
+    /** The size of every block but the last, before compression. */
+    static constexpr std::uint64_t BlockSize = Compression::MaxBlockSize;
+    /** Set on blocks stored compressed, the others didn't shrink. */
+    static constexpr std::uint32_t BlockCompressed = 0x01;
+
+    /* ===================================================================== */
+    /** The start of a pack. Offsets count from the start of the file. */
+    /* ===================================================================== */
+    struct PackHeader
+    {
+        /** Always PackMagic. */
+        char magic_[4];
+        /** Always PackVersion. */
+        std::uint32_t version_;
+        /** The number of files. */
+        std::uint32_t fileCount_;
+        /** The number of blocks. */
+        std::uint32_t blockCount_;
+        /** The size of every file end to end. */
+        std::uint64_t contentSize_;
+        /** Where the table of paths starts. */
+        std::uint64_t stringOffset_;
+        /** The size of the table of paths. */
+        std::uint64_t stringBytes_;
+        /** Where the file entries start. */
+        std::uint64_t fileOffset_;
+        /** Where the block entries start. */
+        std::uint64_t blockOffset_;
+    };
+
+    /* ===================================================================== */
+    /** A file of the pack, sorted by the hash of its path. */
+    /* ===================================================================== */
+    struct PackEntry
+    {
+        /** The hash of the path. */
+        std::uint64_t hash_;
+        /** Where the file starts in the contents. */
+        std::uint64_t offset_;
+        /** The size of the file. */
+        std::uint64_t size_;
+        /** Where the path starts in the table of paths. */
+        std::uint32_t name_;
+        /** The length of the path. */
+        std::uint32_t nameLength_;
+    };
+
+    /* ===================================================================== */
+    /** A block of the contents, as stored. */
+    /* ===================================================================== */
+    struct PackBlock
+    {
+        /** Where the stored block starts. */
+        std::uint64_t offset_;
+        /** The size of the stored block. */
+        std::uint32_t storedSize_;
+        /** The size of the block once decompressed. */
+        std::uint32_t size_;
+        /** The checksum of the stored block. */
+        std::uint32_t checksum_;
+        /** How the block is stored, BlockCompressed or not. */
+        std::uint32_t flags_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Rounds an offset up to the start of the next section.
+     * @param offset                The offset to round.
+     * @returns                     The rounded offset.
+    **/
+    /* ===================================================================== */
+    static std::uint64_t AlignSection(std::uint64_t offset)
+    {
+        return (offset + SectionAlignment - 1) & ~(SectionAlignment - 1);
+    }
+
+    /* ===================================================================== */
+    /**
+     * Runs a loop over [0, count), on the job system if there is one.
+     * Errors thrown by any iteration come back out on the calling thread.
+     * @param jobs                  The job system, or null.
+     * @param count                 The number of iterations.
+     * @param body                  Runs the iterations [begin, end).
+    **/
+    /* ===================================================================== */
+    template <typename Body>
+    static void RunBlocks(JobSystem *jobs, size_t count, Body const &body)
+    {
+        if(!jobs)
+        {
+            body(0, count);
+            return;
+        }
+        jobs->ParallelFor(count, 1, body);
+    }
+
+    void PackWriter::Add(std::string const &path, std::uint8_t const *data, size_t size)
+    {
+        if(!paths_.insert(path).second)
+        {
+            throw std::invalid_argument("The pack already holds " + path + ".");
+        }
+        files_.push_back(File{ path, contents_.size(), size });
+        contents_.insert(contents_.end(), data, data + size);
+    }
+
+    std::vector<std::uint8_t> PackWriter::Serialize(JobSystem *jobs) const
+    {
+        size_t const blockCount = (contents_.size() + BlockSize - 1) / BlockSize;
+        std::vector<std::vector<std::uint8_t> > stored(blockCount);
+        std::vector<PackBlock> blocks(blockCount);
+        RunBlocks(jobs, blockCount, [&](size_t begin, size_t end)
+        {
+            for(size_t i = begin; i < end; ++i)
+            {
+                std::uint8_t const *raw = contents_.data() + i * BlockSize;
+                size_t const size = std::min<size_t>(BlockSize,
+                    contents_.size() - i * BlockSize);
+                stored[i] = Compression::Compress(raw, size);
+                blocks[i].flags_ = BlockCompressed;
+                // Keep the block as is when it doesn't shrink.
+                if(stored[i].size() >= size)
+                {
+                    stored[i].assign(raw, raw + size);
+                    blocks[i].flags_ = 0;
+                }
+                blocks[i].size_ = static_cast<std::uint32_t>(size);
+                blocks[i].storedSize_ = static_cast<std::uint32_t>(stored[i].size());
+                blocks[i].checksum_ = Compression::Checksum(stored[i].data(),
+                    stored[i].size());
+            }
+        });
+
+        std::vector<PackEntry> entries;
+        entries.reserve(files_.size());
+        std::string strings;
+        for(File const &file : files_)
+        {
+            entries.push_back(PackEntry{ Compression::HashPath(file.path_), file.offset_,
+                file.size_, static_cast<std::uint32_t>(strings.size()),
+                static_cast<std::uint32_t>(file.path_.size()) });
+            strings += file.path_;
+        }
+        std::sort(entries.begin(), entries.end(),
+            [](PackEntry const &lhs, PackEntry const &rhs) { return lhs.hash_ < rhs.hash_; });
+
+        PackHeader header = {};
+        std::memcpy(header.magic_, PackMagic, sizeof(PackMagic));
+        header.version_ = PackVersion;
+        header.fileCount_ = static_cast<std::uint32_t>(entries.size());
+        header.blockCount_ = static_cast<std::uint32_t>(blockCount);
+        header.contentSize_ = contents_.size();
+        header.stringOffset_ = AlignSection(sizeof(PackHeader));
+        header.stringBytes_ = strings.size();
+        header.fileOffset_ = AlignSection(header.stringOffset_ + strings.size());
+        header.blockOffset_ = AlignSection(header.fileOffset_ +
+            entries.size() * sizeof(PackEntry));
+        std::uint64_t offset = AlignSection(header.blockOffset_ +
+            blocks.size() * sizeof(PackBlock));
+        for(size_t i = 0; i < blockCount; ++i)
+        {
+            blocks[i].offset_ = offset;
+            offset += stored[i].size();
+        }
+
+        std::vector<std::uint8_t> bytes(offset);
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        std::memcpy(bytes.data() + header.stringOffset_, strings.data(), strings.size());
+        std::memcpy(bytes.data() + header.fileOffset_, entries.data(),
+            entries.size() * sizeof(PackEntry));
+        std::memcpy(bytes.data() + header.blockOffset_, blocks.data(),
+            blocks.size() * sizeof(PackBlock));
+        for(size_t i = 0; i < blockCount; ++i)
+        {
+            std::memcpy(bytes.data() + blocks[i].offset_, stored[i].data(),
+                stored[i].size());
+        }
+        return bytes;
+    }
+
+    void PackWriter::Save(std::string const &path, JobSystem *jobs) const
+    {
+        std::vector<std::uint8_t> const bytes = Serialize(jobs);
+        std::ofstream stream(path, std::ios::binary);
+        if(!stream || !stream.write(reinterpret_cast<char const *>(bytes.data()),
+            bytes.size()))
+        {
+            throw std::runtime_error("The pack " + path + " can't be written.");
+        }
+    }
+
+    size_t PackWriter::GetFileCount() const
+    {
+        return files_.size();
+    }
+
+    PackReader::PackReader(std::string const &path) :
+        file_(std::make_unique<MappedFile>(path)), data_(file_->GetData()),
+        size_(file_->GetSize()), fileCount_(0), blockCount_(0), contentSize_(0),
+        strings_(nullptr), files_(nullptr), blocks_(nullptr)
+    {
+        Open();
+    }
+
+    PackReader::PackReader(std::uint8_t const *data, size_t size) :
+        data_(data), size_(size), fileCount_(0), blockCount_(0), contentSize_(0),
+        strings_(nullptr), files_(nullptr), blocks_(nullptr)
+    {
+        Open();
+    }
+
+    bool PackReader::Contains(std::string_view path) const
+    {
+        return Find(path) != fileCount_;
+    }
+
+    size_t PackReader::GetFileSize(std::string_view path) const
+    {
+        size_t const index = Find(path);
+        if(index == fileCount_)
+        {
+            throw std::out_of_range("The pack doesn't hold " + std::string(path) + ".");
+        }
+        return static_cast<size_t>(reinterpret_cast<PackEntry const *>(files_)[index].size_);
+    }
+
+    std::vector<std::uint8_t> PackReader::Read(std::string_view path, JobSystem *jobs) const
+    {
+        size_t const index = Find(path);
+        if(index == fileCount_)
+        {
+            throw std::out_of_range("The pack doesn't hold " + std::string(path) + ".");
+        }
+        PackEntry const &entry = reinterpret_cast<PackEntry const *>(files_)[index];
+        std::vector<std::uint8_t> out(static_cast<size_t>(entry.size_));
+        if(out.empty())
+        {
+            return out;
+        }
+
+        std::uint64_t const first = entry.offset_ / BlockSize;
+        std::uint64_t const last = (entry.offset_ + entry.size_ - 1) / BlockSize;
+        RunBlocks(jobs, static_cast<size_t>(last - first + 1), [&](size_t begin, size_t end)
+        {
+            std::vector<std::uint8_t> scratch;
+            for(std::uint64_t block = first + begin; block < first + end; ++block)
+            {
+                std::uint64_t const start = block * BlockSize;
+                std::uint64_t const size = std::min(BlockSize, contentSize_ - start);
+                std::uint64_t const from = std::max(entry.offset_, start);
+                std::uint64_t const to = std::min(entry.offset_ + entry.size_, start + size);
+                // Whole blocks go straight to the file, the ends go through
+                // the scratch since they hold bits of other files.
+                if(from == start && to == start + size)
+                {
+                    DecodeBlock(static_cast<size_t>(block),
+                        out.data() + (start - entry.offset_));
+                    continue;
+                }
+                scratch.resize(static_cast<size_t>(size));
+                DecodeBlock(static_cast<size_t>(block), scratch.data());
+                std::memcpy(out.data() + (from - entry.offset_),
+                    scratch.data() + (from - start), static_cast<size_t>(to - from));
+            }
+        });
+        return out;
+    }
+
+    std::string_view PackReader::GetPath(size_t index) const
+    {
+        if(index >= fileCount_)
+        {
+            throw std::out_of_range("The pack has no file " + std::to_string(index) + ".");
+        }
+        PackEntry const &entry = reinterpret_cast<PackEntry const *>(files_)[index];
+        return std::string_view(strings_ + entry.name_, entry.nameLength_);
+    }
+
+    size_t PackReader::GetFileCount() const
+    {
+        return fileCount_;
+    }
+
+    size_t PackReader::GetBlockCount() const
+    {
+        return blockCount_;
+    }
+
+    void PackReader::Open()
+    {
+        if(size_ < sizeof(PackHeader))
+        {
+            throw std::runtime_error("The pack is truncated.");
+        }
+        // The entries are read in place, so the start has to be aligned
+        // like them. Mapped files and heap blocks always are.
+        if(reinterpret_cast<std::uintptr_t>(data_) % alignof(std::uint64_t) != 0)
+        {
+            throw std::runtime_error("The pack isn't aligned to 8 bytes.");
+        }
+        PackHeader header;
+        std::memcpy(&header, data_, sizeof(header));
+        if(std::memcmp(header.magic_, PackMagic, sizeof(PackMagic)) != 0 ||
+            header.version_ != PackVersion)
+        {
+            throw std::runtime_error("The data is not a supported pack.");
+        }
+
+        auto const fits = [this](std::uint64_t offset, std::uint64_t bytes)
+        {
+            return offset <= size_ && bytes <= size_ - offset;
+        };
+        if(!fits(header.stringOffset_, header.stringBytes_) ||
+            header.fileOffset_ % alignof(PackEntry) != 0 ||
+            !fits(header.fileOffset_, std::uint64_t(header.fileCount_) * sizeof(PackEntry)) ||
+            header.blockOffset_ % alignof(PackBlock) != 0 ||
+            !fits(header.blockOffset_, std::uint64_t(header.blockCount_) * sizeof(PackBlock)))
+        {
+            throw std::runtime_error("The pack is truncated.");
+        }
+        if(header.blockCount_ != (header.contentSize_ + BlockSize - 1) / BlockSize)
+        {
+            throw std::runtime_error("The pack has the wrong number of blocks.");
+        }
+        fileCount_ = header.fileCount_;
+        blockCount_ = header.blockCount_;
+        contentSize_ = header.contentSize_;
+        strings_ = reinterpret_cast<char const *>(data_ + header.stringOffset_);
+        files_ = data_ + header.fileOffset_;
+        blocks_ = data_ + header.blockOffset_;
+
+        PackBlock const *blocks = reinterpret_cast<PackBlock const *>(blocks_);
+        for(size_t i = 0; i < blockCount_; ++i)
+        {
+            std::uint64_t const size = std::min(BlockSize, contentSize_ - i * BlockSize);
+            if(!fits(blocks[i].offset_, blocks[i].storedSize_) || blocks[i].size_ != size ||
+                (!(blocks[i].flags_ & BlockCompressed) && blocks[i].storedSize_ != size))
+            {
+                throw std::runtime_error("The pack holds a broken block.");
+            }
+        }
+        PackEntry const *files = reinterpret_cast<PackEntry const *>(files_);
+        for(size_t i = 0; i < fileCount_; ++i)
+        {
+            if(std::uint64_t(files[i].name_) + files[i].nameLength_ > header.stringBytes_ ||
+                files[i].offset_ > contentSize_ || files[i].size_ > contentSize_ - files[i].offset_ ||
+                (i != 0 && files[i - 1].hash_ > files[i].hash_))
+            {
+                throw std::runtime_error("The pack holds a broken file.");
+            }
+        }
+    }
+
+    size_t PackReader::Find(std::string_view path) const
+    {
+        PackEntry const *const begin = reinterpret_cast<PackEntry const *>(files_);
+        PackEntry const *const end = begin + fileCount_;
+        std::uint64_t const hash = Compression::HashPath(path);
+        PackEntry const *entry = std::lower_bound(begin, end, hash,
+            [](PackEntry const &lhs, std::uint64_t rhs) { return lhs.hash_ < rhs; });
+        // Different paths may share a hash, the names settle it.
+        for(; entry != end && entry->hash_ == hash; ++entry)
+        {
+            if(std::string_view(strings_ + entry->name_, entry->nameLength_) == path)
+            {
+                return static_cast<size_t>(entry - begin);
+            }
+        }
+        return fileCount_;
+    }
+
+    void PackReader::DecodeBlock(size_t block, std::uint8_t *out) const
+    {
+        PackBlock const &entry = reinterpret_cast<PackBlock const *>(blocks_)[block];
+        std::uint8_t const *const stored = data_ + entry.offset_;
+        if(Compression::Checksum(stored, entry.storedSize_) != entry.checksum_)
+        {
+            throw std::runtime_error("The block " + std::to_string(block) +
+                " of the pack is corrupt.");
+        }
+        if(entry.flags_ & BlockCompressed)
+        {
+            Compression::Decompress(stored, entry.storedSize_, out, entry.size_);
+        }
+        else
+        {
+            std::memcpy(out, stored, entry.size_);
+        }
+    }
+}
@@ -0,0 +1,239 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Renderer.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Provides access to all graphical functions needed to draw the assets
+ * to the swapchain.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/Renderer.hpp"
+#include "Ludus/Graphics/Device.hpp"
+#include "Ludus/Graphics/FrameCapture.hpp"
+#include "Ludus/Graphics/Mesh.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace Ludus
+{
+    /** The number of instance matrices combined with the camera at once. */
+    static constexpr size_t InstanceBatchSize = 256;
+
+    Renderer::Renderer(Device &device) :
+        device_(device), cameras_(1, Math::Mat4::Identity()), statistics_()
+    {
+    }
+
+    void Renderer::Clear(Color color)
+    {
+        Command command = {};
+        command.type_ = Command::CLEAR;
+        command.color_ = color;
+        commands_.push_back(command);
+    }
+
+    size_t Renderer::AllocateQuads(size_t quadCount)
+    {
+        size_t const first = vertices_.size() / 4;
+        vertices_.resize(vertices_.size() + quadCount * 4);
+        return first;
+    }
+
+    Vertex2D *Renderer::GetQuadVertices(size_t firstQuad)
+    {
+        return vertices_.data() + firstQuad * 4;
+    }
+
+    void Renderer::DrawQuads(size_t firstQuad, size_t quadCount,
+        Texture const *texture, BlendMode blend)
+    {
+        Command command = {};
+        command.type_ = Command::DRAW_QUADS;
+        command.blend_ = blend;
+        command.texture_ = texture;
+        command.first_ = firstQuad;
+        command.count_ = quadCount;
+        commands_.push_back(command);
+    }
+
+    void Renderer::DrawSampledQuads(size_t firstQuad, size_t quadCount,
+        SampledTexture const *texture, BlendMode blend)
+    {
+        Command command = {};
+        command.type_ = Command::DRAW_QUADS;
+        command.blend_ = blend;
+        command.sampled_ = texture;
+        command.first_ = firstQuad;
+        command.count_ = quadCount;
+        commands_.push_back(command);
+    }
+
+    void Renderer::SetViewProjection(Math::Mat4 const &viewProjection)
+    {
+        cameras_.push_back(viewProjection);
+    }
+
+    void Renderer::DrawInstanced(Mesh const &mesh, Instance const *instances,
+        size_t instanceCount)
+    {
+        Command command = {};
+        command.type_ = Command::DRAW_INSTANCED;
+        command.mesh_ = &mesh;
+        command.instances_ = instances;
+        command.first_ = cameras_.size() - 1;
+        command.count_ = instanceCount;
+        commands_.push_back(command);
+    }
+
+    void Renderer::CaptureNextFrame(std::string path)
+    {
+        capturePath_ = std::move(path);
+    }
+
+    void Renderer::Submit()
+    {
+        std::exception_ptr captureError;
+        if(!capturePath_.empty())
+        {
+            // Cleared first so a failed capture isn't retried every frame.
+            std::string const path = std::move(capturePath_);
+            capturePath_.clear();
+            try
+            {
+                FrameCapture(*this).Save(path);
+            }
+            catch(...)
+            {
+                captureError = std::current_exception();
+            }
+        }
+
+        using Clock = std::chrono::steady_clock;
+        statistics_ = Statistics();
+        timings_.clear();
+        try
+        {
+            for(Command const &command : commands_)
+            {
+                Clock::time_point const start = Clock::now();
+                switch(command.type_)
+                {
+                case Command::CLEAR:
+                    device_.Clear(command.color_);
+                    break;
+                case Command::DRAW_QUADS:
+                    if(command.sampled_)
+                    {
+                        device_.DrawSampledQuads(vertices_.data() + command.first_ * 4,
+                            command.count_, command.sampled_, command.blend_);
+                    }
+                    else
+                    {
+                        device_.DrawQuads(vertices_.data() + command.first_ * 4,
+                            command.count_, command.texture_, command.blend_);
+                    }
+                    ++statistics_.draws_;
+                    statistics_.quads_ += command.count_;
+                    break;
+                case Command::DRAW_INSTANCED:
+                    RunInstanced(command);
+                    ++statistics_.draws_;
+                    break;
+                }
+                static char const *const names[] = { "Clear", "Quads", "Instanced" };
+                timings_.push_back(PassTiming{ names[command.type_],
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now() - start) });
+            }
+        }
+        catch(...)
+        {
+            // Otherwise the next frame would draw this one again.
+            EndFrame();
+            throw;
+        }
+        statistics_.commands_ = commands_.size();
+        EndFrame();
+        if(captureError)
+        {
+            std::rethrow_exception(captureError);
+        }
+    }
+
+    void Renderer::EndFrame()
+    {
+        // Keep the capacity around, next frame will look about the same.
+        commands_.clear();
+        vertices_.clear();
+        // The camera carries over to the next frame.
+        cameras_.erase(cameras_.begin(), cameras_.end() - 1);
+        device_.EndFrame();
+    }
+
+    void Renderer::RunInstanced(Command const &command)
+    {
+        Mesh const &mesh = *command.mesh_;
+        Math::Mat4 const &viewProjection = cameras_[command.first_];
+        size_t const visible = culler_.Cull(Frustum::FromMatrix(viewProjection),
+            mesh, command.instances_, command.count_);
+        statistics_.instances_ += command.count_;
+        statistics_.visibleInstances_ += visible;
+        if(visible == 0)
+        {
+            return;
+        }
+
+        size_t const vertexCount = mesh.GetVertexCount();
+        for(std::vector<float> &component : clip_)
+        {
+            component.resize(vertexCount);
+        }
+        Math::Vec4Stream const clip = { clip_[0].data(), clip_[1].data(),
+            clip_[2].data(), clip_[3].data() };
+        transforms_.resize(InstanceBatchSize);
+        clipTransforms_.resize(InstanceBatchSize);
+
+        std::uint32_t const *indices = culler_.GetVisible();
+        for(size_t first = 0; first < visible; first += InstanceBatchSize)
+        {
+            size_t const count = std::min(InstanceBatchSize, visible - first);
+            for(size_t i = 0; i < count; ++i)
+            {
+                transforms_[i] = command.instances_[indices[first + i]].transform_;
+            }
+            Math::MultiplyMatrices(viewProjection, transforms_.data(),
+                clipTransforms_.data(), count);
+            for(size_t i = 0; i < count; ++i)
+            {
+                Math::ProjectPoints(clipTransforms_[i], mesh.GetPositions(),
+                    clip, vertexCount);
+                statistics_.triangles_ += device_.DrawTriangles(clip,
+                    mesh.GetIndices(), mesh.GetTriangleCount(),
+                    command.instances_[indices[first + i]].color_);
+            }
+        }
+    }
+
+    size_t Renderer::GetCommandCount() const
+    {
+        return commands_.size();
+    }
+
+    Renderer::Statistics const &Renderer::GetStatistics() const
+    {
+        return statistics_;
+    }
+
+    std::vector<Renderer::PassTiming> const &Renderer::GetPassTimings() const
+    {
+        return timings_;
+    }
+}
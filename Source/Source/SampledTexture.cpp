@@ -0,0 +1,434 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            SampledTexture.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A texture laid out for filtered sampling on the CPU.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/SampledTexture.hpp"
+#include "Ludus/Graphics/Texture.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Ludus
+{
+    namespace
+    {
+        /** The taps of the Kaiser filter, halving a level. */
+        constexpr int KaiserTaps = 8;
+        /** The tap of the texel a texel of the next level starts at. */
+        constexpr int KaiserCenter = KaiserTaps / 2 - 1;
+
+        /* ================================================================= */
+        /**
+         * Packs channels already rounded and clamped.
+         * @param r                 The red channel.
+         * @param g                 The green channel.
+         * @param b                 The blue channel.
+         * @param a                 The alpha channel.
+         * @returns                 The packed color.
+        **/
+        /* ================================================================= */
+        Color ToColor(float r, float g, float b, float a)
+        {
+            return PackColor(static_cast<std::uint8_t>(r), static_cast<std::uint8_t>(g),
+                static_cast<std::uint8_t>(b), static_cast<std::uint8_t>(a));
+        }
+
+        /* ================================================================= */
+        /**
+         * Halves a level by averaging squares of 2x2 texels. Two channels
+         * are added at once in every half of an int, four texels can't
+         * overflow them.
+         * @param source            The texels of the level.
+         * @param width             The width of the level.
+         * @param height            The height of the level.
+         * @param destination       Gets the texels of the next level.
+        **/
+        /* ================================================================= */
+        void DownsampleBox(std::vector<Color> const &source, unsigned width,
+            unsigned height, std::vector<Color> &destination)
+        {
+            unsigned const nextWidth = std::max(width / 2, 1u);
+            unsigned const nextHeight = std::max(height / 2, 1u);
+            destination.resize(static_cast<size_t>(nextWidth) * nextHeight);
+            for(unsigned y = 0; y < nextHeight; ++y)
+            {
+                Color const *top = source.data() +
+                    static_cast<size_t>(std::min(y * 2, height - 1)) * width;
+                Color const *bottom = source.data() +
+                    static_cast<size_t>(std::min(y * 2 + 1, height - 1)) * width;
+                Color *row = destination.data() + static_cast<size_t>(y) * nextWidth;
+                for(unsigned x = 0; x < nextWidth; ++x)
+                {
+                    unsigned const left = std::min(x * 2, width - 1);
+                    unsigned const right = std::min(x * 2 + 1, width - 1);
+                    Color const a = top[left], b = top[right], c = bottom[left], d = bottom[right];
+                    std::uint32_t const even = (a & 0x00FF00FFu) + (b & 0x00FF00FFu) +
+                        (c & 0x00FF00FFu) + (d & 0x00FF00FFu) + 0x00020002u;
+                    std::uint32_t const odd = ((a >> 8) & 0x00FF00FFu) + ((b >> 8) & 0x00FF00FFu) +
+                        ((c >> 8) & 0x00FF00FFu) + ((d >> 8) & 0x00FF00FFu) + 0x00020002u;
+                    row[x] = ((even >> 2) & 0x00FF00FFu) | (((odd >> 2) & 0x00FF00FFu) << 8);
+                }
+            }
+        }
+
+        /* ================================================================= */
+        /**
+         * Computes the weights of the Kaiser windowed sinc halving a
+         * level, with the taps half a texel on either side of the center.
+         * @param weights           Gets the weight of every tap.
+        **/
+        /* ================================================================= */
+        void ComputeKaiserWeights(float *weights)
+        {
+            // The modified Bessel function of the first kind, from its series.
+            auto bessel = [](double x)
+            {
+                double sum = 1.0, term = 1.0;
+                for(int k = 1; k < 20; ++k)
+                {
+                    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                    sum += term;
+                }
+                return sum;
+            };
+            double constexpr Alpha = 4.0;
+            double constexpr Radius = 2.0;
+            double constexpr Pi = 3.14159265358979323846;
+            double total = 0.0;
+            double values[KaiserTaps];
+            for(int tap = 0; tap < KaiserTaps; ++tap)
+            {
+                // In texels of the next level, from the center.
+                double const distance = (tap - KaiserTaps / 2 + 0.5) * 0.5;
+                double const sinc = std::sin(Pi * distance) / (Pi * distance);
+                double const window = distance / Radius;
+                double const shape = std::sqrt(std::max(0.0, 1.0 - window * window));
+                values[tap] = sinc * bessel(Alpha * shape) / bessel(Alpha);
+                total += values[tap];
+            }
+            for(int tap = 0; tap < KaiserTaps; ++tap)
+            {
+                weights[tap] = static_cast<float>(values[tap] / total);
+            }
+        }
+
+        /* ================================================================= */
+        /**
+         * Halves a level with a Kaiser windowed sinc, once along the rows
+         * and once along the columns. A texel fills a register, so every
+         * tap filters all four channels at once.
+         * @param source            The texels of the level.
+         * @param width             The width of the level.
+         * @param height            The height of the level.
+         * @param destination       Gets the texels of the next level.
+        **/
+        /* ================================================================= */
+        void DownsampleKaiser(std::vector<Color> const &source, unsigned width,
+            unsigned height, std::vector<Color> &destination)
+        {
+            using namespace Math::Simd;
+            static float weights[KaiserTaps];
+            static bool const computed = (ComputeKaiserWeights(weights), true);
+            UNREFERENCED(computed);
+            Float4 taps[KaiserTaps];
+            for(int tap = 0; tap < KaiserTaps; ++tap)
+            {
+                taps[tap] = Splat(weights[tap]);
+            }
+
+            unsigned const nextWidth = std::max(width / 2, 1u);
+            unsigned const nextHeight = std::max(height / 2, 1u);
+            std::vector<float> texels(source.size() * 4);
+            for(size_t i = 0; i < source.size(); ++i)
+            {
+                for(unsigned channel = 0; channel < 4; ++channel)
+                {
+                    texels[i * 4 + channel] = GetChannel(source[i], channel);
+                }
+            }
+
+            // Along the rows, a side of a single texel is left as it is.
+            std::vector<float> rows(static_cast<size_t>(nextWidth) * height * 4);
+            for(unsigned y = 0; y < height; ++y)
+            {
+                float const *row = texels.data() + static_cast<size_t>(y) * width * 4;
+                float *filtered = rows.data() + static_cast<size_t>(y) * nextWidth * 4;
+                for(unsigned x = 0; x < nextWidth; ++x)
+                {
+                    Float4 sum = LoadUnaligned(row + static_cast<size_t>(x) * 4);
+                    if(width > 1)
+                    {
+                        sum = Splat(0.0f);
+                        for(int tap = 0; tap < KaiserTaps; ++tap)
+                        {
+                            int const column = std::clamp(static_cast<int>(x * 2) + tap -
+                                KaiserCenter, 0, static_cast<int>(width) - 1);
+                            sum = MulAdd(LoadUnaligned(row + column * 4), taps[tap], sum);
+                        }
+                    }
+                    StoreUnaligned(filtered + static_cast<size_t>(x) * 4, sum);
+                }
+            }
+
+            destination.resize(static_cast<size_t>(nextWidth) * nextHeight);
+            Float4 const lowest = Splat(0.0f);
+            Float4 const highest = Splat(255.0f);
+            Float4 const half = Splat(0.5f);
+            for(unsigned y = 0; y < nextHeight; ++y)
+            {
+                for(unsigned x = 0; x < nextWidth; ++x)
+                {
+                    float const *column = rows.data() + static_cast<size_t>(x) * 4;
+                    Float4 sum = LoadUnaligned(column + static_cast<size_t>(y) * nextWidth * 4);
+                    if(height > 1)
+                    {
+                        sum = Splat(0.0f);
+                        for(int tap = 0; tap < KaiserTaps; ++tap)
+                        {
+                            int const row = std::clamp(static_cast<int>(y * 2) + tap -
+                                KaiserCenter, 0, static_cast<int>(height) - 1);
+                            sum = MulAdd(LoadUnaligned(column +
+                                static_cast<size_t>(row) * nextWidth * 4), taps[tap], sum);
+                        }
+                    }
+                    // The lobes of the sinc can overshoot.
+                    float channels[4];
+                    StoreUnaligned(channels, Add(Min(Max(sum, lowest), highest), half));
+                    destination[static_cast<size_t>(y) * nextWidth + x] = ToColor(
+                        channels[0], channels[1], channels[2], channels[3]);
+                }
+            }
+        }
+    }
+
+    SampledTexture::SampledTexture(Texture const &source, TextureLayout layout,
+        MipFilter filter) :
+        layout_(layout), filter_(filter), levels_(), texels_()
+    {
+        unsigned width = source.GetWidth();
+        unsigned height = source.GetHeight();
+        if(width == 0 || height == 0)
+        {
+            throw std::invalid_argument("An empty texture can't be sampled.");
+        }
+
+        std::vector<Color> current(source.GetData(), source.GetData() +
+            static_cast<size_t>(width) * height);
+        std::vector<Color> next;
+        for(;;)
+        {
+            unsigned const tilesPerRow = (width + TileSize - 1) / TileSize;
+            unsigned const tileRows = (height + TileSize - 1) / TileSize;
+            Level const level = { width, height, tilesPerRow, texels_.size() };
+            levels_.push_back(level);
+            // Tiles on the edges are padded to a whole cache line.
+            texels_.resize(texels_.size() + (layout_ == TextureLayout::TILED ?
+                static_cast<size_t>(tilesPerRow) * tileRows * TileSize * TileSize :
+                static_cast<size_t>(width) * height));
+            for(unsigned y = 0; y < height; ++y)
+            {
+                for(unsigned x = 0; x < width; ++x)
+                {
+                    texels_[GetIndex(level, x, y)] = current[static_cast<size_t>(y) * width + x];
+                }
+            }
+            if(width == 1 && height == 1)
+            {
+                break;
+            }
+            if(filter == MipFilter::KAISER)
+            {
+                DownsampleKaiser(current, width, height, next);
+            }
+            else
+            {
+                DownsampleBox(current, width, height, next);
+            }
+            current.swap(next);
+            width = std::max(width / 2, 1u);
+            height = std::max(height / 2, 1u);
+        }
+    }
+
+    void SampledTexture::SampleBilinear(float const *u, float const *v, size_t count,
+        unsigned level, Color *colors) const
+    {
+        using namespace Math::Simd;
+        if(level >= levels_.size())
+        {
+            throw std::out_of_range("The texture has no such level.");
+        }
+        unsigned const levels[4] = { level, level, level, level };
+        Float4 channels[4];
+        float lanes[4][4];
+        for(size_t first = 0; first < count; first += Width)
+        {
+            size_t const lanesUsed = std::min<size_t>(Width, count - first);
+            // The last few samples get padded to a whole register.
+            float paddedU[4] = {}, paddedV[4] = {};
+            std::copy(u + first, u + first + lanesUsed, paddedU);
+            std::copy(v + first, v + first + lanesUsed, paddedV);
+            Bilinear4(paddedU, paddedV, levels, channels);
+            for(unsigned channel = 0; channel < 4; ++channel)
+            {
+                StoreUnaligned(lanes[channel], Add(channels[channel], Splat(0.5f)));
+            }
+            for(size_t lane = 0; lane < lanesUsed; ++lane)
+            {
+                colors[first + lane] = ToColor(lanes[0][lane], lanes[1][lane],
+                    lanes[2][lane], lanes[3][lane]);
+            }
+        }
+    }
+
+    void SampledTexture::SampleTrilinear(float const *u, float const *v, float const *lod,
+        size_t count, Color *colors) const
+    {
+        using namespace Math::Simd;
+        float const last = static_cast<float>(levels_.size() - 1);
+        Float4 fine[4], coarse[4];
+        float lanes[4][4];
+        for(size_t first = 0; first < count; first += Width)
+        {
+            size_t const lanesUsed = std::min<size_t>(Width, count - first);
+            float paddedU[4] = {}, paddedV[4] = {}, blend[4] = {};
+            unsigned fineLevels[4] = {}, coarseLevels[4] = {};
+            for(size_t lane = 0; lane < lanesUsed; ++lane)
+            {
+                paddedU[lane] = u[first + lane];
+                paddedV[lane] = v[first + lane];
+                // Written so a NaN ends up on the largest level.
+                float const clamped = lod[first + lane] > 0.0f ?
+                    std::min(lod[first + lane], last) : 0.0f;
+                fineLevels[lane] = static_cast<unsigned>(clamped);
+                coarseLevels[lane] = std::min(fineLevels[lane] + 1, static_cast<unsigned>(last));
+                blend[lane] = clamped - static_cast<float>(fineLevels[lane]);
+            }
+            Bilinear4(paddedU, paddedV, fineLevels, fine);
+            Bilinear4(paddedU, paddedV, coarseLevels, coarse);
+            Float4 const weight = LoadUnaligned(blend);
+            for(unsigned channel = 0; channel < 4; ++channel)
+            {
+                Float4 const mixed = MulAdd(Sub(coarse[channel], fine[channel]), weight,
+                    fine[channel]);
+                StoreUnaligned(lanes[channel], Add(mixed, Splat(0.5f)));
+            }
+            for(size_t lane = 0; lane < lanesUsed; ++lane)
+            {
+                colors[first + lane] = ToColor(lanes[0][lane], lanes[1][lane],
+                    lanes[2][lane], lanes[3][lane]);
+            }
+        }
+    }
+
+    Color SampledTexture::GetTexel(unsigned level, unsigned x, unsigned y) const
+    {
+        return texels_[GetIndex(levels_.at(level), x, y)];
+    }
+
+    unsigned SampledTexture::GetLevelCount() const
+    {
+        return static_cast<unsigned>(levels_.size());
+    }
+
+    unsigned SampledTexture::GetWidth(unsigned level) const
+    {
+        return levels_.at(level).width_;
+    }
+
+    unsigned SampledTexture::GetHeight(unsigned level) const
+    {
+        return levels_.at(level).height_;
+    }
+
+    TextureLayout SampledTexture::GetLayout() const
+    {
+        return layout_;
+    }
+
+    MipFilter SampledTexture::GetFilter() const
+    {
+        return filter_;
+    }
+
+    size_t SampledTexture::GetIndex(Level const &level, unsigned x, unsigned y) const
+    {
+        if(layout_ == TextureLayout::LINEAR)
+        {
+            return level.offset_ + static_cast<size_t>(y) * level.width_ + x;
+        }
+        size_t const tile = static_cast<size_t>(y / TileSize) * level.tilesPerRow_ + x / TileSize;
+        return level.offset_ + tile * TileSize * TileSize + (y % TileSize) * TileSize +
+            x % TileSize;
+    }
+
+    void SampledTexture::Bilinear4(float const *u, float const *v, unsigned const *levels,
+        Math::Simd::Float4 *channels) const
+    {
+        using namespace Math::Simd;
+        float widths[4], heights[4];
+        for(unsigned lane = 0; lane < Width; ++lane)
+        {
+            Level const &level = levels_.at(levels[lane]);
+            widths[lane] = static_cast<float>(level.width_);
+            heights[lane] = static_cast<float>(level.height_);
+        }
+        // Texel centers sit half a texel in.
+        Float4 const half = Splat(0.5f);
+        Float4 const x = Sub(Mul(LoadUnaligned(u), LoadUnaligned(widths)), half);
+        Float4 const y = Sub(Mul(LoadUnaligned(v), LoadUnaligned(heights)), half);
+        Float4 const left = Floor(x);
+        Float4 const top = Floor(y);
+        Float4 const fractionX = Sub(x, left);
+        Float4 const fractionY = Sub(y, top);
+        float columns[4], rows[4];
+        StoreUnaligned(columns, left);
+        StoreUnaligned(rows, top);
+
+        // The four corners of every lane, fetched one lane at a time.
+        Color corners[4][4];
+        for(unsigned lane = 0; lane < Width; ++lane)
+        {
+            Level const &level = levels_[levels[lane]];
+            int const width = static_cast<int>(level.width_);
+            int const height = static_cast<int>(level.height_);
+            int x0 = static_cast<int>(columns[lane]) % width;
+            int y0 = static_cast<int>(rows[lane]) % height;
+            x0 += x0 < 0 ? width : 0;
+            y0 += y0 < 0 ? height : 0;
+            unsigned const x1 = x0 + 1 == width ? 0 : x0 + 1;
+            unsigned const y1 = y0 + 1 == height ? 0 : y0 + 1;
+            corners[0][lane] = texels_[GetIndex(level, x0, y0)];
+            corners[1][lane] = texels_[GetIndex(level, x1, y0)];
+            corners[2][lane] = texels_[GetIndex(level, x0, y1)];
+            corners[3][lane] = texels_[GetIndex(level, x1, y1)];
+        }
+
+        for(unsigned channel = 0; channel < 4; ++channel)
+        {
+            Float4 values[4];
+            for(unsigned corner = 0; corner < 4; ++corner)
+            {
+                Color const *texels = corners[corner];
+                values[corner] = Set(GetChannel(texels[0], channel),
+                    GetChannel(texels[1], channel), GetChannel(texels[2], channel),
+                    GetChannel(texels[3], channel));
+            }
+            Float4 const upper = MulAdd(Sub(values[1], values[0]), fractionX, values[0]);
+            Float4 const lower = MulAdd(Sub(values[3], values[2]), fractionX, values[2]);
+            channels[channel] = MulAdd(Sub(lower, upper), fractionY, upper);
+        }
+    }
+}
@@ -0,0 +1,600 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Scene.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Saves a Node subtree to a compact binary scene and loads it back.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/Scene.hpp"
+#include "Ludus/System/Reflection.hpp"
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Ludus
+{
+    /** Marks the start of a scene file. */
+    static constexpr char SceneMagic[4] = { 'L', 'D', 'S', 'N' };
+    /** Bumped whenever the layout of the file changes. */
+    static constexpr std::uint32_t SceneVersion = 2;
+    /** Every section starts on a multiple of this. */
+    static constexpr std::uint64_t SectionAlignment = 16;
+    /** The parent of the root. */
+    static constexpr std::uint32_t NoParent = UINT32_MAX;
+
+    /* ===================================================================== */
+    /** The start of a scene. Offsets count from the start of the file. */
+    /* ===================================================================== */
+    struct SceneHeader
+    {
+        /** Always SceneMagic. */
+        char magic_[4];
+        /** Always SceneVersion. */
+        std::uint32_t version_;
+        /** The number of nodes, the root first. */
+        std::uint32_t nodeCount_;
+        /** The number of payload blocks. */
+        std::uint32_t blockCount_;
+        /** Where the table of names starts. */
+        std::uint64_t stringOffset_;
+        /** The size of the table of names. */
+        std::uint64_t stringBytes_;
+        /** Where the node records start. */
+        std::uint64_t nodeOffset_;
+        /** Where the block headers start. */
+        std::uint64_t blockOffset_;
+    };
+
+    /* ===================================================================== */
+    /** A node of the scene, in breadth first order. */
+    /* ===================================================================== */
+    struct NodeRecord
+    {
+        /** Where the name starts in the table of names. */
+        std::uint32_t name_;
+        /** The length of the name. */
+        std::uint32_t nameLength_;
+        /** The index of the parent, NoParent for the root. */
+        std::uint32_t parent_;
+        /** The index of the first child, the others follow it. */
+        std::uint32_t firstChild_;
+        /** The number of children. */
+        std::uint32_t childCount_;
+        /** Keeps the record a multiple of 8 bytes. */
+        std::uint32_t reserved_;
+    };
+
+    /* ===================================================================== */
+    /** Where a payload block is and what it holds. */
+    /* ===================================================================== */
+    struct BlockHeader
+    {
+        /** What the block holds, a SceneBlock. */
+        std::uint32_t kind_;
+        /** The size of the element of every node. */
+        std::uint32_t elementSize_;
+        /** Where the block starts. */
+        std::uint64_t offset_;
+        /** The size of the block. */
+        std::uint64_t byteCount_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Every node of a loaded scene, in a single allocation.
+    **/
+    /* ===================================================================== */
+    struct NodeBlock
+    {
+        /* ================================================================= */
+        /**
+         * Allocates room for the nodes, without building any.
+         * @param count             The number of nodes.
+        **/
+        /* ================================================================= */
+        explicit NodeBlock(size_t count) :
+            nodes_(static_cast<Node *>(::operator new(count * sizeof(Node),
+            std::align_val_t(alignof(Node))))), constructed_(0)
+        {
+        }
+        /* ================================================================= */
+        /**
+         * Destroys the nodes built so far and frees the room.
+        **/
+        /* ================================================================= */
+        ~NodeBlock()
+        {
+            for(size_t node = constructed_; node-- > 0;)
+            {
+                nodes_[node].~Node();
+            }
+            ::operator delete(nodes_, std::align_val_t(alignof(Node)));
+        }
+        NodeBlock(NodeBlock const &) = delete;
+        NodeBlock &operator=(NodeBlock const &) = delete;
+
+        /** The nodes, in the order of the scene. */
+        Node *nodes_;
+        /** The number of nodes built. */
+        size_t constructed_;
+    };
+
+    /* ===================================================================== */
+    /**
+     * Gets the packed size of a value: the sum of its reflected leaves.
+     * @tparam T                    The type of the value.
+     * @returns                     The packed size.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static constexpr size_t GetPackedSize()
+    {
+        if constexpr(IsReflected<T>::value)
+        {
+            size_t size = 0;
+            ForEachField<T>([&size](auto const &field)
+            {
+                size += GetPackedSize<typename std::decay_t<decltype(field)>::Type>();
+            });
+            return size;
+        }
+        else
+        {
+            static_assert(std::is_arithmetic<T>::value,
+                "Only numbers and reflected types can be packed.");
+            return sizeof(T);
+        }
+    }
+
+    /* ===================================================================== */
+    /**
+     * Gets where a field starts in a packed value.
+     * @tparam T                    The reflected type of the value.
+     * @param field                 The index of the field.
+     * @returns                     The offset of the field.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static constexpr size_t GetPackedOffset(size_t field)
+    {
+        size_t offset = 0;
+        size_t index = 0;
+        ForEachField<T>([&](auto const &member)
+        {
+            if(index++ < field)
+            {
+                offset += GetPackedSize<typename std::decay_t<decltype(member)>::Type>();
+            }
+        });
+        return offset;
+    }
+
+    /* ===================================================================== */
+    /**
+     * Packs a value field by field, without any padding.
+     * @param out                   Where to write, moved past the value.
+     * @param value                 The value to pack.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static void Pack(std::uint8_t *&out, T const &value)
+    {
+        if constexpr(IsReflected<T>::value)
+        {
+            VisitFields(value, [&out](auto const &, auto const &field)
+            {
+                Pack(out, field);
+            });
+        }
+        else
+        {
+            std::memcpy(out, &value, sizeof(T));
+            out += sizeof(T);
+        }
+    }
+
+    /* ===================================================================== */
+    /**
+     * Unpacks a value written by Pack.
+     * @param in                    Where to read, moved past the value.
+     * @param value                 The value to fill.
+    **/
+    /* ===================================================================== */
+    template <typename T>
+    static void Unpack(std::uint8_t const *&in, T &value)
+    {
+        if constexpr(IsReflected<T>::value)
+        {
+            VisitFields(value, [&in](auto const &, auto &field)
+            {
+                Unpack(in, field);
+            });
+        }
+        else
+        {
+            std::memcpy(&value, in, sizeof(T));
+            in += sizeof(T);
+        }
+    }
+
+    /* ===================================================================== */
+    /**
+     * Rounds an offset up to the start of the next section.
+     * @param offset                The offset to round.
+     * @returns                     The aligned offset.
+    **/
+    /* ===================================================================== */
+    static std::uint64_t AlignSection(std::uint64_t offset)
+    {
+        return (offset + SectionAlignment - 1) & ~(SectionAlignment - 1);
+    }
+
+    /** The size of the transform of a node. */
+    static constexpr size_t TransformSize = GetPackedSize<Transform>();
+    /** Where the position starts in a packed transform. */
+    static constexpr size_t PositionOffset = GetPackedOffset<Transform>(
+        FindField<Transform>("position_"));
+    /** Where the rotation starts in a packed transform. */
+    static constexpr size_t RotationOffset = GetPackedOffset<Transform>(
+        FindField<Transform>("rotation_"));
+    /** Where the scale starts in a packed transform. */
+    static constexpr size_t ScaleOffset = GetPackedOffset<Transform>(
+        FindField<Transform>("scale_"));
+
+    std::vector<std::uint8_t> Scene::Serialize(Node const &root)
+    {
+        // Breadth first puts the children of every node next to each
+        // other, the list itself is the queue.
+        std::vector<Node const *> nodes = { &root };
+        std::vector<std::uint32_t> parents = { NoParent };
+        std::string strings;
+        std::unordered_map<std::string, std::uint32_t> offsets;
+        std::vector<NodeRecord> records;
+        for(size_t i = 0; i < nodes.size(); ++i)
+        {
+            Node const &node = *nodes[i];
+            // Repeated names are stored once.
+            auto inserted = offsets.emplace(node.name_,
+                static_cast<std::uint32_t>(strings.size()));
+            if(inserted.second)
+            {
+                strings += node.name_;
+                if(strings.size() > UINT32_MAX)
+                {
+                    throw std::length_error("The names of the scene are too long.");
+                }
+            }
+            if(nodes.size() + node.Size() >= NoParent)
+            {
+                throw std::length_error("The scene has too many nodes.");
+            }
+            records.push_back(NodeRecord{ inserted.first->second,
+                static_cast<std::uint32_t>(node.name_.size()), parents[i],
+                static_cast<std::uint32_t>(nodes.size()),
+                static_cast<std::uint32_t>(node.Size()), 0 });
+            for(std::shared_ptr<Node> const &child : node.children_)
+            {
+                nodes.push_back(child.get());
+                parents.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        SceneHeader header = { { SceneMagic[0], SceneMagic[1], SceneMagic[2],
+            SceneMagic[3] }, SceneVersion, static_cast<std::uint32_t>(nodes.size()),
+            1, 0, strings.size(), 0, 0 };
+        header.stringOffset_ = sizeof(SceneHeader);
+        header.nodeOffset_ = AlignSection(header.stringOffset_ + strings.size());
+        header.blockOffset_ = AlignSection(header.nodeOffset_ +
+            records.size() * sizeof(NodeRecord));
+        BlockHeader const block = { static_cast<std::uint32_t>(SceneBlock::TRANSFORMS),
+            static_cast<std::uint32_t>(TransformSize),
+            AlignSection(header.blockOffset_ + sizeof(BlockHeader)),
+            nodes.size() * TransformSize };
+
+        std::vector<std::uint8_t> bytes(block.offset_ + block.byteCount_);
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        std::memcpy(bytes.data() + header.stringOffset_, strings.data(), strings.size());
+        std::memcpy(bytes.data() + header.nodeOffset_, records.data(),
+            records.size() * sizeof(NodeRecord));
+        std::memcpy(bytes.data() + header.blockOffset_, &block, sizeof(block));
+        std::uint8_t *out = bytes.data() + block.offset_;
+        for(Node const *node : nodes)
+        {
+            Pack(out, node->transform_);
+        }
+        return bytes;
+    }
+
+    std::shared_ptr<Node> Scene::Deserialize(std::uint8_t const *data, size_t size)
+    {
+        return Instantiate(SceneView(data, size));
+    }
+
+    std::shared_ptr<Node> Scene::Instantiate(SceneView const &scene)
+    {
+        size_t const count = scene.nodeCount_;
+        NodeRecord const *records = static_cast<NodeRecord const *>(scene.records_);
+        // The root shares the block, the links between nodes don't own
+        // anything so the whole tree goes away at once.
+        std::shared_ptr<NodeBlock> block = std::make_shared<NodeBlock>(count);
+        Node *nodes = block->nodes_;
+        std::uint64_t children = 0;
+        for(size_t i = 0; i < count; ++i)
+        {
+            NodeRecord const &record = records[i];
+            std::string_view const name = NodeView(scene, static_cast<std::uint32_t>(i)).GetName();
+            Node &node = *::new(nodes + i) Node();
+            ++block->constructed_;
+            node.name_.assign(name.data(), name.size());
+            if(scene.transforms_)
+            {
+                std::uint8_t const *in = scene.transforms_ + i * TransformSize;
+                Unpack(in, node.transform_);
+            }
+            if(i == 0)
+            {
+                if(record.parent_ != NoParent)
+                {
+                    throw std::runtime_error("The scene holds a broken node.");
+                }
+            }
+            else
+            {
+                // Every node has to land exactly where its parent says, so
+                // the tree matches what a view of the scene sees.
+                if(record.parent_ >= i)
+                {
+                    throw std::runtime_error("The scene holds a broken node.");
+                }
+                Node &parent = nodes[record.parent_];
+                NodeRecord const &parentRecord = records[record.parent_];
+                if(i - parentRecord.firstChild_ != parent.children_.size() ||
+                    parent.children_.size() >= parentRecord.childCount_)
+                {
+                    throw std::runtime_error("The scene holds a broken node.");
+                }
+                parent.AddChild(std::shared_ptr<Node>(std::shared_ptr<Node>(), &node));
+            }
+            node.children_.reserve(record.childCount_);
+            children += record.childCount_;
+        }
+        if(children != count - 1)
+        {
+            throw std::runtime_error("The scene is missing nodes.");
+        }
+        // Linking marked the children dirty, only the root is left.
+        nodes[0].transform_.SetPosition(nodes[0].transform_.GetPosition());
+        return std::shared_ptr<Node>(block, nodes);
+    }
+
+    void Scene::Save(Node const &root, std::string const &path)
+    {
+        std::vector<std::uint8_t> const bytes = Serialize(root);
+        std::ofstream stream(path, std::ios::binary);
+        if(!stream || !stream.write(reinterpret_cast<char const *>(bytes.data()),
+            bytes.size()))
+        {
+            throw std::runtime_error("The scene " + path + " can't be written.");
+        }
+    }
+
+    std::shared_ptr<Node> Scene::Load(std::string const &path)
+    {
+        return Instantiate(SceneView(path));
+    }
+
+    NodeView::NodeView(SceneView const &scene, std::uint32_t index) :
+        scene_(&scene), index_(index)
+    {
+    }
+
+    std::string_view NodeView::GetName() const
+    {
+        NodeRecord const &record = static_cast<NodeRecord const *>(scene_->records_)[index_];
+        if(std::uint64_t(record.name_) + record.nameLength_ > scene_->stringBytes_)
+        {
+            throw std::runtime_error("The scene holds a broken name.");
+        }
+        return std::string_view(scene_->strings_ + record.name_, record.nameLength_);
+    }
+
+    size_t NodeView::Size() const
+    {
+        return static_cast<NodeRecord const *>(scene_->records_)[index_].childCount_;
+    }
+
+    NodeView NodeView::At(size_t i) const
+    {
+        NodeRecord const &record = static_cast<NodeRecord const *>(scene_->records_)[index_];
+        if(i >= record.childCount_)
+        {
+            throw NodeNotFound(std::to_string(i));
+        }
+        // Children always come after their parent, which rules out loops.
+        std::uint64_t const child = std::uint64_t(record.firstChild_) + i;
+        if(child <= index_ || child >= scene_->nodeCount_)
+        {
+            throw std::runtime_error("The scene holds a broken node.");
+        }
+        return NodeView(*scene_, static_cast<std::uint32_t>(child));
+    }
+
+    NodeView NodeView::Find(std::string_view name) const
+    {
+        for(size_t i = 0; i < Size(); ++i)
+        {
+            NodeView const child = At(i);
+            if(child.GetName() == name)
+            {
+                return child;
+            }
+        }
+        throw NodeNotFound(std::string(name));
+    }
+
+    bool NodeView::HasParent() const
+    {
+        return static_cast<NodeRecord const *>(scene_->records_)[index_].parent_ != NoParent;
+    }
+
+    NodeView NodeView::GetParent() const
+    {
+        std::uint32_t const parent =
+            static_cast<NodeRecord const *>(scene_->records_)[index_].parent_;
+        if(parent == NoParent)
+        {
+            throw NodeNotFound("parent of " + std::string(GetName()));
+        }
+        if(parent >= index_)
+        {
+            throw std::runtime_error("The scene holds a broken node.");
+        }
+        return NodeView(*scene_, parent);
+    }
+
+    Math::Vec3 NodeView::GetPosition() const
+    {
+        Math::Vec3 position;
+        if(scene_->transforms_)
+        {
+            std::uint8_t const *in = scene_->transforms_ + index_ * TransformSize +
+                PositionOffset;
+            Unpack(in, position);
+        }
+        return position;
+    }
+
+    Math::Quat NodeView::GetRotation() const
+    {
+        Math::Quat rotation;
+        if(scene_->transforms_)
+        {
+            std::uint8_t const *in = scene_->transforms_ + index_ * TransformSize +
+                RotationOffset;
+            Unpack(in, rotation);
+        }
+        return rotation;
+    }
+
+    Math::Vec3 NodeView::GetScale() const
+    {
+        Math::Vec3 scale(1.0f, 1.0f, 1.0f);
+        if(scene_->transforms_)
+        {
+            std::uint8_t const *in = scene_->transforms_ + index_ * TransformSize +
+                ScaleOffset;
+            Unpack(in, scale);
+        }
+        return scale;
+    }
+
+    std::uint32_t NodeView::GetIndex() const
+    {
+        return index_;
+    }
+
+    SceneView::SceneView(std::string const &path) :
+        file_(std::make_unique<MappedFile>(path)), data_(file_->GetData()),
+        size_(file_->GetSize()), nodeCount_(0), strings_(nullptr), stringBytes_(0),
+        records_(nullptr), transforms_(nullptr)
+    {
+        Open();
+    }
+
+    SceneView::SceneView(std::uint8_t const *data, size_t size) :
+        data_(data), size_(size), nodeCount_(0), strings_(nullptr), stringBytes_(0),
+        records_(nullptr), transforms_(nullptr)
+    {
+        Open();
+    }
+
+    NodeView SceneView::GetRoot() const
+    {
+        return NodeView(*this, 0);
+    }
+
+    NodeView SceneView::GetNode(size_t index) const
+    {
+        if(index >= nodeCount_)
+        {
+            throw std::out_of_range("The scene has no node " + std::to_string(index) + ".");
+        }
+        return NodeView(*this, static_cast<std::uint32_t>(index));
+    }
+
+    size_t SceneView::GetNodeCount() const
+    {
+        return nodeCount_;
+    }
+
+    void SceneView::Open()
+    {
+        if(size_ < sizeof(SceneHeader))
+        {
+            throw std::runtime_error("The scene is truncated.");
+        }
+        // Records and blocks are read in place, so the start has to be
+        // aligned like them. Mapped files and heap blocks always are.
+        if(reinterpret_cast<std::uintptr_t>(data_) % alignof(std::uint64_t) != 0)
+        {
+            throw std::runtime_error("The scene isn't aligned to 8 bytes.");
+        }
+        SceneHeader header;
+        std::memcpy(&header, data_, sizeof(header));
+        if(std::memcmp(header.magic_, SceneMagic, sizeof(SceneMagic)) != 0 ||
+            header.version_ != SceneVersion)
+        {
+            throw std::runtime_error("The data is not a supported scene.");
+        }
+
+        auto const fits = [this](std::uint64_t offset, std::uint64_t bytes)
+        {
+            return offset <= size_ && bytes <= size_ - offset;
+        };
+        if(header.nodeCount_ == 0 || !fits(header.stringOffset_, header.stringBytes_) ||
+            header.nodeOffset_ % alignof(NodeRecord) != 0 ||
+            !fits(header.nodeOffset_, std::uint64_t(header.nodeCount_) * sizeof(NodeRecord)) ||
+            header.blockOffset_ % alignof(BlockHeader) != 0 ||
+            !fits(header.blockOffset_, std::uint64_t(header.blockCount_) * sizeof(BlockHeader)))
+        {
+            throw std::runtime_error("The scene is truncated.");
+        }
+        nodeCount_ = header.nodeCount_;
+        strings_ = reinterpret_cast<char const *>(data_ + header.stringOffset_);
+        stringBytes_ = header.stringBytes_;
+        records_ = data_ + header.nodeOffset_;
+
+        BlockHeader const *blocks = reinterpret_cast<BlockHeader const *>(
+            data_ + header.blockOffset_);
+        for(std::uint32_t i = 0; i < header.blockCount_; ++i)
+        {
+            BlockHeader const &block = blocks[i];
+            if(!fits(block.offset_, block.byteCount_))
+            {
+                throw std::runtime_error("The scene is truncated.");
+            }
+            if(block.kind_ != static_cast<std::uint32_t>(SceneBlock::TRANSFORMS))
+            {
+                continue;
+            }
+            if(block.elementSize_ != TransformSize ||
+                block.byteCount_ != std::uint64_t(TransformSize) * nodeCount_)
+            {
+                throw std::runtime_error("The scene holds broken transforms.");
+            }
+            transforms_ = data_ + block.offset_;
+        }
+    }
+}
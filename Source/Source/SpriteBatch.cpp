@@ -0,0 +1,149 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            SpriteBatch.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Collects the sprites of a frame and hands them to the renderer in as few
+ * draws as possible.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/SpriteBatch.hpp"
+#include "Ludus/Graphics/Renderer.hpp"
+#include "Ludus/Graphics/TextureAtlas.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Ludus
+{
+    namespace
+    {
+        /** The number of sprites handed to a single job. */
+        constexpr size_t SpritesPerJob = 2048;
+
+        /* ================================================================= */
+        /**
+         * Builds the part of the sort key deciding which batch a sprite
+         * belongs to: the layer, then the blend mode, then the page.
+         * @param sprite            The sprite.
+         * @param page              The atlas page of the sprite.
+         * @returns                 The batch key.
+        **/
+        /* ================================================================= */
+        std::uint32_t BatchKey(Sprite const &sprite, unsigned page)
+        {
+            std::uint32_t const layer = static_cast<std::uint32_t>(
+                static_cast<std::int32_t>(sprite.layer_) + 32768);
+            return (layer << 16) |
+                (static_cast<std::uint32_t>(sprite.blend_) << 12) |
+                (page & 0xFFFu);
+        }
+    }
+
+    SpriteBatch::SpriteBatch(TextureAtlas const &atlas, JobSystem *jobs) :
+        atlas_(atlas), jobs_(jobs), batches_(0)
+    {
+    }
+
+    void SpriteBatch::Draw(Sprite const &sprite)
+    {
+        sprites_.push_back(sprite);
+    }
+
+    void SpriteBatch::Flush(Renderer &renderer)
+    {
+        batches_ = 0;
+        if(sprites_.empty())
+        {
+            return;
+        }
+
+        // The index in the low bits keeps the sort stable for free.
+        keys_.resize(sprites_.size());
+        for(size_t i = 0; i < sprites_.size(); ++i)
+        {
+            unsigned const page = atlas_.GetRegion(sprites_[i].region_).page_;
+            keys_[i] = (static_cast<std::uint64_t>(BatchKey(sprites_[i], page)) << 32) | i;
+        }
+        std::sort(keys_.begin(), keys_.end());
+
+        size_t const first = renderer.AllocateQuads(sprites_.size());
+        Vertex2D *vertices = renderer.GetQuadVertices(first);
+        if(jobs_)
+        {
+            jobs_->ParallelFor(keys_.size(), SpritesPerJob,
+                [this, vertices](size_t begin, size_t end)
+                { BuildVertices(vertices, begin, end); });
+        }
+        else
+        {
+            BuildVertices(vertices, 0, keys_.size());
+        }
+
+        // Every run of equal batch keys is a single draw.
+        size_t runStart = 0;
+        for(size_t i = 1; i <= keys_.size(); ++i)
+        {
+            if(i < keys_.size() && (keys_[i] >> 32) == (keys_[runStart] >> 32))
+            {
+                continue;
+            }
+            Sprite const &sprite = sprites_[keys_[runStart] & 0xFFFFFFFFu];
+            unsigned const page = atlas_.GetRegion(sprite.region_).page_;
+            renderer.DrawQuads(first + runStart, i - runStart,
+                &atlas_.GetPage(page), sprite.blend_);
+            ++batches_;
+            runStart = i;
+        }
+        sprites_.clear();
+    }
+
+    size_t SpriteBatch::GetBatchCount() const
+    {
+        return batches_;
+    }
+
+    void SpriteBatch::BuildVertices(Vertex2D *vertices, size_t begin,
+        size_t end) const
+    {
+        for(size_t i = begin; i < end; ++i)
+        {
+            Sprite const &sprite = sprites_[keys_[i] & 0xFFFFFFFFu];
+            AtlasRegion const &region = atlas_.GetRegion(sprite.region_);
+            float const halfWidth = sprite.width_ * 0.5f;
+            float const halfHeight = sprite.height_ * 0.5f;
+            // Unrotated sprites stay exactly axis aligned.
+            float cosine = 1.0f, sine = 0.0f;
+            if(sprite.rotation_ != 0.0f)
+            {
+                cosine = std::cos(sprite.rotation_);
+                sine = std::sin(sprite.rotation_);
+            }
+
+            // Corners going around the quad from the top left.
+            float const cornersX[4] = { -halfWidth, halfWidth, halfWidth, -halfWidth };
+            float const cornersY[4] = { -halfHeight, -halfHeight, halfHeight, halfHeight };
+            float const u[4] = { region.u0_, region.u1_, region.u1_, region.u0_ };
+            float const v[4] = { region.v0_, region.v0_, region.v1_, region.v1_ };
+            Vertex2D *quad = vertices + i * 4;
+            for(unsigned corner = 0; corner < 4; ++corner)
+            {
+                quad[corner].x_ = sprite.x_ + cornersX[corner] * cosine -
+                    cornersY[corner] * sine;
+                quad[corner].y_ = sprite.y_ + cornersX[corner] * sine +
+                    cornersY[corner] * cosine;
+                quad[corner].u_ = u[corner];
+                quad[corner].v_ = v[corner];
+                quad[corner].color_ = sprite.color_;
+            }
+        }
+    }
+}
@@ -0,0 +1,421 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Task.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Lets gameplay code that spans many frames be written top to bottom.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/Task.hpp"
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace Ludus
+{
+    /** The sizes of the pooled frames are multiples of this. */
+    static constexpr size_t FrameGranularity = 64;
+    /** The number of pools, larger frames come from the heap. */
+    static constexpr size_t FramePoolCount = 32;
+
+    /* ===================================================================== */
+    /**
+     * The free frames of a thread, one list per size. A free frame holds
+     * the next one in its first bytes.
+    **/
+    /* ===================================================================== */
+    struct FramePool
+    {
+        /* ================================================================= */
+        /**
+         * Frees the frames kept when the thread exits.
+        **/
+        /* ================================================================= */
+        ~FramePool()
+        {
+            for(void *frame : free_)
+            {
+                while(frame)
+                {
+                    void *const next = *static_cast<void **>(frame);
+                    ::operator delete(frame);
+                    frame = next;
+                }
+            }
+        }
+
+        /** The first free frame of every size. */
+        void *free_[FramePoolCount] = {};
+    };
+
+    /** The frames freed on this thread. */
+    static thread_local FramePool framePool;
+
+    Task Task::promise_type::get_return_object()
+    {
+        return Task(Handle::from_promise(*this));
+    }
+
+    std::suspend_always Task::promise_type::initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    Task::promise_type::FinalAwaiter Task::promise_type::final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void Task::promise_type::return_void() const
+    {
+    }
+
+    void Task::promise_type::unhandled_exception()
+    {
+        exception_ = std::current_exception();
+    }
+
+    void *Task::promise_type::operator new(size_t size)
+    {
+        size_t const pool = (size + FrameGranularity - 1) / FrameGranularity;
+        if(pool > FramePoolCount)
+        {
+            return ::operator new(size);
+        }
+        void *&head = framePool.free_[pool - 1];
+        if(head)
+        {
+            void *const frame = head;
+            head = *static_cast<void **>(frame);
+            return frame;
+        }
+        return ::operator new(pool * FrameGranularity);
+    }
+
+    void Task::promise_type::operator delete(void *frame, size_t size)
+    {
+        size_t const pool = (size + FrameGranularity - 1) / FrameGranularity;
+        if(pool > FramePoolCount)
+        {
+            ::operator delete(frame);
+            return;
+        }
+        void *&head = framePool.free_[pool - 1];
+        *static_cast<void **>(frame) = head;
+        head = frame;
+    }
+
+    bool Task::promise_type::FinalAwaiter::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<> Task::promise_type::FinalAwaiter::await_suspend(Handle task) noexcept
+    {
+        promise_type &promise = task.promise();
+        // An awaited task stays for its Task to free, its parent goes on.
+        if(promise.continuation_)
+        {
+            return promise.continuation_;
+        }
+        if(promise.scheduler_)
+        {
+            promise.scheduler_->Finish(task);
+        }
+        return std::noop_coroutine();
+    }
+
+    void Task::promise_type::FinalAwaiter::await_resume() const noexcept
+    {
+    }
+
+    Task::Awaiter::Awaiter(Handle task) :
+        task_(task)
+    {
+    }
+
+    bool Task::Awaiter::await_ready() const noexcept
+    {
+        return !task_ || task_.done();
+    }
+
+    std::coroutine_handle<> Task::Awaiter::await_suspend(Handle parent) const noexcept
+    {
+        task_.promise().scheduler_ = parent.promise().scheduler_;
+        task_.promise().continuation_ = parent;
+        return task_;
+    }
+
+    void Task::Awaiter::await_resume() const
+    {
+        if(task_ && task_.promise().exception_)
+        {
+            std::rethrow_exception(task_.promise().exception_);
+        }
+    }
+
+    Task::Task(Task &&task) noexcept :
+        handle_(std::exchange(task.handle_, nullptr))
+    {
+    }
+
+    Task &Task::operator=(Task &&task) noexcept
+    {
+        if(this != &task)
+        {
+            if(handle_)
+            {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(task.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Task::~Task()
+    {
+        if(handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    bool Task::IsDone() const
+    {
+        return !handle_ || handle_.done();
+    }
+
+    Task::Awaiter Task::operator co_await() && noexcept
+    {
+        return Awaiter(handle_);
+    }
+
+    Task::Task(Handle handle) :
+        handle_(handle)
+    {
+    }
+
+    bool NextFrame::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void NextFrame::await_suspend(Task::Handle task) const
+    {
+        TaskScheduler::GetScheduler(task).frame_.push_back(task);
+    }
+
+    void NextFrame::await_resume() const noexcept
+    {
+    }
+
+    bool NextFixedStep::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void NextFixedStep::await_suspend(Task::Handle task) const
+    {
+        TaskScheduler::GetScheduler(task).fixedStep_.push_back(task);
+    }
+
+    void NextFixedStep::await_resume() const noexcept
+    {
+    }
+
+    WaitSeconds::WaitSeconds(double seconds) :
+        seconds_(seconds)
+    {
+    }
+
+    bool WaitSeconds::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void WaitSeconds::await_suspend(Task::Handle task) const
+    {
+        // Resumed right from the wheel, which fires during Update.
+        TaskScheduler::GetScheduler(task).timers_.Schedule(seconds_, [task]() { task.resume(); });
+    }
+
+    void WaitSeconds::await_resume() const noexcept
+    {
+    }
+
+    WaitForJob::WaitForJob(JobSystem &jobs, JobSystem::Job job) :
+        jobs_(jobs), job_(std::move(job))
+    {
+    }
+
+    bool WaitForJob::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void WaitForJob::await_suspend(Task::Handle task)
+    {
+        task_ = task;
+        // Nothing in the frame of the task is touched from the worker, it
+        // may be freed before the job finishes.
+        jobs_.Schedule([job = std::move(job_), task,
+            inbox = TaskScheduler::GetScheduler(task).inbox_]()
+            {
+                std::exception_ptr error;
+                try
+                {
+                    job();
+                }
+                catch(...)
+                {
+                    error = std::current_exception();
+                }
+                inbox->Post(task, std::move(error));
+            });
+    }
+
+    void WaitForJob::await_resume() const
+    {
+        if(std::exception_ptr const error = std::exchange(task_.promise().resumeError_, nullptr))
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void TaskScheduler::Inbox::Post(Task::Handle task, std::exception_ptr error)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.emplace_back(task, std::move(error));
+    }
+
+    TaskScheduler::TaskScheduler() :
+        Node("TaskScheduler"), tasks_(nullptr), taskCount_(0),
+        inbox_(std::make_shared<Inbox>())
+    {
+    }
+
+    TaskScheduler::~TaskScheduler()
+    {
+        // Freeing a task frees the tasks it awaits with it.
+        while(tasks_)
+        {
+            Task::promise_type *const task = tasks_;
+            tasks_ = task->next_;
+            Task::Handle::from_promise(*task).destroy();
+        }
+    }
+
+    void TaskScheduler::Start(Task task)
+    {
+        Task::Handle const handle = std::exchange(task.handle_, nullptr);
+        if(!handle)
+        {
+            return;
+        }
+        Task::promise_type &promise = handle.promise();
+        promise.scheduler_ = this;
+        promise.previous_ = nullptr;
+        promise.next_ = tasks_;
+        if(tasks_)
+        {
+            tasks_->previous_ = &promise;
+        }
+        tasks_ = &promise;
+        ++taskCount_;
+        handle.resume();
+        Rethrow();
+    }
+
+    void TaskScheduler::BeginFrame()
+    {
+        // What the tasks wait on from here is for the frame after.
+        resuming_.swap(frame_);
+        ResumeAll(resuming_);
+    }
+
+    void TaskScheduler::Update(double const &dt)
+    {
+        {
+            std::lock_guard<std::mutex> lock(inbox_->mutex_);
+            woken_.swap(inbox_->ready_);
+        }
+        for(std::pair<Task::Handle, std::exception_ptr> &woken : woken_)
+        {
+            woken.first.promise().resumeError_ = std::move(woken.second);
+            woken.first.resume();
+        }
+        woken_.clear();
+        timers_.Advance(dt);
+        Rethrow();
+    }
+
+    void TaskScheduler::FixedUpdate(double const &fixedDt)
+    {
+        UNREFERENCED(fixedDt);
+        resuming_.swap(fixedStep_);
+        ResumeAll(resuming_);
+    }
+
+    size_t TaskScheduler::GetTaskCount() const
+    {
+        return taskCount_;
+    }
+
+    TaskScheduler &TaskScheduler::GetScheduler(Task::Handle task)
+    {
+        if(!task.promise().scheduler_)
+        {
+            throw std::logic_error("Tasks can only wait once a scheduler started them.");
+        }
+        return *task.promise().scheduler_;
+    }
+
+    void TaskScheduler::Finish(Task::Handle task) noexcept
+    {
+        Task::promise_type &promise = task.promise();
+        if(promise.previous_)
+        {
+            promise.previous_->next_ = promise.next_;
+        }
+        else
+        {
+            tasks_ = promise.next_;
+        }
+        if(promise.next_)
+        {
+            promise.next_->previous_ = promise.previous_;
+        }
+        --taskCount_;
+        if(promise.exception_ && !failure_)
+        {
+            failure_ = std::move(promise.exception_);
+        }
+        task.destroy();
+    }
+
+    void TaskScheduler::ResumeAll(std::vector<std::coroutine_handle<> > &waiting)
+    {
+        for(std::coroutine_handle<> const task : waiting)
+        {
+            task.resume();
+        }
+        waiting.clear();
+        Rethrow();
+    }
+
+    void TaskScheduler::Rethrow()
+    {
+        if(failure_)
+        {
+            std::rethrow_exception(std::exchange(failure_, nullptr));
+        }
+    }
+}
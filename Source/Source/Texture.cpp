@@ -0,0 +1,96 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Texture.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * An image held in memory as rows of packed RGBA colors.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/Texture.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Ludus
+{
+    Texture::Texture() :
+        width_(0), height_(0), texels_()
+    {
+    }
+
+    Texture::Texture(unsigned width, unsigned height, Color fill) :
+        width_(width), height_(height),
+        texels_(static_cast<size_t>(width) * height, fill)
+    {
+    }
+
+    Texture::Texture(unsigned width, unsigned height, std::vector<Color> texels) :
+        width_(width), height_(height), texels_(std::move(texels))
+    {
+        if(texels_.size() != static_cast<size_t>(width) * height)
+        {
+            throw std::invalid_argument("The texel count doesn't match the "
+                "dimensions of the texture.");
+        }
+    }
+
+    void Texture::Blit(Texture const &source, unsigned x, unsigned y)
+    {
+        if(x >= width_ || y >= height_)
+        {
+            return;
+        }
+        unsigned const columns = std::min(source.width_, width_ - x);
+        unsigned const rows = std::min(source.height_, height_ - y);
+        for(unsigned row = 0; row < rows; ++row)
+        {
+            Color const *from = source.GetData() + static_cast<size_t>(row) * source.width_;
+            std::copy(from, from + columns,
+                texels_.begin() + static_cast<size_t>(y + row) * width_ + x);
+        }
+    }
+
+    void Texture::Resize(unsigned width, unsigned height, Color fill)
+    {
+        width_ = width;
+        height_ = height;
+        texels_.assign(static_cast<size_t>(width) * height, fill);
+    }
+
+    unsigned Texture::GetWidth() const
+    {
+        return width_;
+    }
+
+    unsigned Texture::GetHeight() const
+    {
+        return height_;
+    }
+
+    Color Texture::GetTexel(unsigned x, unsigned y) const
+    {
+        return texels_[static_cast<size_t>(y) * width_ + x];
+    }
+
+    void Texture::SetTexel(unsigned x, unsigned y, Color color)
+    {
+        texels_[static_cast<size_t>(y) * width_ + x] = color;
+    }
+
+    Color const *Texture::GetData() const
+    {
+        return texels_.data();
+    }
+
+    Color *Texture::GetData()
+    {
+        return texels_.data();
+    }
+}
@@ -0,0 +1,187 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            TextureAtlas.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Packs many small images into a few large pages.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/TextureAtlas.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Ludus
+{
+    SkylinePacker::SkylinePacker(unsigned width, unsigned height) :
+        width_(width), height_(height), used_(0),
+        skyline_(1, Segment{ 0, 0, width })
+    {
+    }
+
+    bool SkylinePacker::Pack(unsigned width, unsigned height, unsigned &x,
+        unsigned &y)
+    {
+        size_t best = skyline_.size();
+        unsigned bestTop = std::numeric_limits<unsigned>::max();
+        unsigned bestWidth = std::numeric_limits<unsigned>::max();
+        for(size_t i = 0; i < skyline_.size(); ++i)
+        {
+            unsigned top = 0;
+            if(!Fit(i, width, top) || top + height > height_)
+            {
+                continue;
+            }
+            // Lowest top first, then the narrowest segment to keep the
+            // wide ones for wide images.
+            if(top + height < bestTop ||
+                (top + height == bestTop && skyline_[i].width_ < bestWidth))
+            {
+                best = i;
+                bestTop = top + height;
+                bestWidth = skyline_[i].width_;
+            }
+        }
+        if(best == skyline_.size())
+        {
+            return false;
+        }
+
+        x = skyline_[best].x_;
+        y = bestTop - height;
+        skyline_.insert(skyline_.begin() + best, Segment{ x, bestTop, width });
+
+        // Cut away whatever the new segment now covers.
+        size_t i = best + 1;
+        while(i < skyline_.size())
+        {
+            Segment &segment = skyline_[i];
+            unsigned const covered = x + width;
+            if(segment.x_ >= covered)
+            {
+                break;
+            }
+            unsigned const shrink = covered - segment.x_;
+            if(shrink < segment.width_)
+            {
+                segment.x_ += shrink;
+                segment.width_ -= shrink;
+                break;
+            }
+            skyline_.erase(skyline_.begin() + i);
+        }
+        // Neighbours at the same height become a single segment.
+        for(size_t j = 0; j + 1 < skyline_.size();)
+        {
+            if(skyline_[j].y_ == skyline_[j + 1].y_)
+            {
+                skyline_[j].width_ += skyline_[j + 1].width_;
+                skyline_.erase(skyline_.begin() + j + 1);
+            }
+            else
+            {
+                ++j;
+            }
+        }
+        used_ += static_cast<size_t>(width) * height;
+        return true;
+    }
+
+    float SkylinePacker::GetOccupancy() const
+    {
+        return static_cast<float>(used_) /
+            (static_cast<float>(width_) * static_cast<float>(height_));
+    }
+
+    bool SkylinePacker::Fit(size_t index, unsigned width, unsigned &y) const
+    {
+        unsigned const x = skyline_[index].x_;
+        if(x + width > width_)
+        {
+            return false;
+        }
+        // The rectangle rests on the highest segment below it.
+        y = 0;
+        unsigned remaining = width;
+        for(size_t i = index; remaining > 0 && i < skyline_.size(); ++i)
+        {
+            y = std::max(y, skyline_[i].y_);
+            remaining -= std::min(remaining, skyline_[i].width_);
+        }
+        return true;
+    }
+
+    TextureAtlas::TextureAtlas(unsigned pageSize, unsigned padding) :
+        pageSize_(pageSize), padding_(padding)
+    {
+    }
+
+    size_t TextureAtlas::Add(Texture image)
+    {
+        if(image.GetWidth() + padding_ > pageSize_ ||
+            image.GetHeight() + padding_ > pageSize_)
+        {
+            throw std::invalid_argument("The image is larger than an atlas page.");
+        }
+        size_t const region = regions_.size();
+        regions_.push_back(AtlasRegion());
+        pending_.push_back(Pending{ region, std::move(image) });
+        return region;
+    }
+
+    void TextureAtlas::Build()
+    {
+        // Placing tall images first leaves a flatter skyline.
+        std::stable_sort(pending_.begin(), pending_.end(),
+            [](Pending const &lhs, Pending const &rhs)
+            { return lhs.image_.GetHeight() > rhs.image_.GetHeight(); });
+
+        float const scale = 1.0f / static_cast<float>(pageSize_);
+        for(Pending const &pending : pending_)
+        {
+            unsigned const width = pending.image_.GetWidth();
+            unsigned const height = pending.image_.GetHeight();
+            unsigned x = 0, y = 0;
+            unsigned page = 0;
+            while(page < packers_.size() &&
+                !packers_[page].Pack(width + padding_, height + padding_, x, y))
+            {
+                ++page;
+            }
+            if(page == packers_.size())
+            {
+                pages_.push_back(std::make_unique<Texture>(pageSize_, pageSize_));
+                packers_.emplace_back(pageSize_, pageSize_);
+                packers_.back().Pack(width + padding_, height + padding_, x, y);
+            }
+
+            pages_[page]->Blit(pending.image_, x, y);
+            regions_[pending.region_] = AtlasRegion{ page,
+                x * scale, y * scale, (x + width) * scale, (y + height) * scale };
+        }
+        pending_.clear();
+    }
+
+    AtlasRegion const &TextureAtlas::GetRegion(size_t region) const
+    {
+        return regions_[region];
+    }
+
+    unsigned TextureAtlas::GetPageCount() const
+    {
+        return static_cast<unsigned>(pages_.size());
+    }
+
+    Texture const &TextureAtlas::GetPage(unsigned page) const
+    {
+        return *pages_[page];
+    }
+}
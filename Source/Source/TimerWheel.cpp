@@ -0,0 +1,343 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            TimerWheel.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Runs callbacks after a delay, for any number of timers.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/TimerWheel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Ludus
+{
+    /** The bits of the tick each ring covers. */
+    static constexpr unsigned LevelBits = 8;
+    /** The slots of a ring. */
+    static constexpr unsigned SlotCount = 1u << LevelBits;
+    /** Masks a tick down to a slot. */
+    static constexpr std::uint64_t SlotMask = SlotCount - 1;
+    /** The rings of the wheel. */
+    static constexpr unsigned LevelCount = 4;
+    /** The furthest ahead the wheel reaches, later timers wait on the top ring. */
+    static constexpr std::uint64_t MaxDelta = (std::uint64_t(1) << (LevelBits * LevelCount)) - 1;
+    /** Marks the end of a list. */
+    static constexpr std::uint32_t NoTimer = UINT32_MAX;
+    /** The slots tracked by a word of the occupied bits. */
+    static constexpr unsigned WordBits = 64;
+
+    /* ===================================================================== */
+    /**
+     * Finds the lowest set bit of a word.
+     * @param word              The word, not zero.
+     * @returns                 The position of the bit.
+    **/
+    /* ===================================================================== */
+    static unsigned LowestBit(std::uint64_t word)
+    {
+#ifdef _MSC_VER
+        unsigned long bit;
+        _BitScanForward64(&bit, word);
+        return static_cast<unsigned>(bit);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+    }
+
+    /* ===================================================================== */
+    /**
+     * Finds the next slot of a ring holding timers.
+     * @param occupied          The occupied bits of the ring.
+     * @param from              The slot to look after.
+     * @returns                 How many slots ahead it is, going around
+     *                          the ring back to from, or zero if the ring
+     *                          is empty.
+    **/
+    /* ===================================================================== */
+    static unsigned FindNextSlot(std::uint64_t const *occupied, unsigned from)
+    {
+        for(unsigned distance = 1; distance <= SlotCount;)
+        {
+            unsigned const slot = (from + distance) & SlotMask;
+            std::uint64_t const word = occupied[slot / WordBits] >> (slot % WordBits);
+            if(word)
+            {
+                return distance + LowestBit(word);
+            }
+            distance += WordBits - slot % WordBits;
+        }
+        return 0;
+    }
+
+    TimerWheel::TimerWheel() :
+        TimerWheel(0.001)
+    {
+    }
+
+    TimerWheel::TimerWheel(double tick) :
+        Node("TimerWheel"), tick_(tick), time_(0.0), current_(0),
+        buckets_(SlotCount * LevelCount, NoTimer),
+        occupied_(SlotCount * LevelCount / WordBits, 0), free_(NoTimer), pending_(0)
+    {
+        if(!(tick > 0.0))
+        {
+            throw std::invalid_argument("The tick of a timer wheel must be positive.");
+        }
+    }
+
+    TimerId TimerWheel::Schedule(double delay, Callback callback, double period)
+    {
+        std::uint32_t index = free_;
+        if(index != NoTimer)
+        {
+            free_ = timers_[index].previous_;
+        }
+        else
+        {
+            if(timers_.size() >= NoTimer)
+            {
+                throw std::length_error("Too many timers are pending.");
+            }
+            index = static_cast<std::uint32_t>(timers_.size());
+            timers_.push_back(Timer{ 0, 0, nullptr, NoTimer, NoTimer, 0, 0, TimerState::FREE });
+        }
+        Timer &timer = timers_[index];
+        // The slot of the current tick was already fired, so nothing is due
+        // sooner than the next one.
+        double const expiry = std::ceil((time_ + std::max(delay, 0.0)) / tick_);
+        timer.expiry_ = std::max(current_ + 1, static_cast<std::uint64_t>(expiry));
+        timer.period_ = period > 0.0 ?
+            std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::llround(period / tick_))) : 0;
+        timer.callback_ = std::move(callback);
+        timer.state_ = TimerState::PENDING;
+        Insert(index);
+        ++pending_;
+        return TimerId{ index, timer.generation_ };
+    }
+
+    bool TimerWheel::Cancel(TimerId timer)
+    {
+        if(timer.index_ >= timers_.size() || timers_[timer.index_].generation_ != timer.generation_)
+        {
+            return false;
+        }
+        switch(timers_[timer.index_].state_)
+        {
+        case TimerState::PENDING:
+            Unlink(timer.index_);
+            Release(timer.index_);
+            --pending_;
+            return true;
+        case TimerState::FIRING:
+            // Off the wheel already, the firing loop frees it.
+            timers_[timer.index_].state_ = TimerState::CANCELLED;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool TimerWheel::IsPending(TimerId timer) const
+    {
+        if(timer.index_ >= timers_.size())
+        {
+            return false;
+        }
+        Timer const &pending = timers_[timer.index_];
+        return pending.generation_ == timer.generation_ &&
+            (pending.state_ == TimerState::PENDING || pending.state_ == TimerState::FIRING);
+    }
+
+    void TimerWheel::Advance(double dt)
+    {
+        time_ += std::max(dt, 0.0);
+        std::uint64_t const target = static_cast<std::uint64_t>(time_ / tick_);
+        while(current_ < target)
+        {
+            // The ticks in between have nothing to fire or move, so a long
+            // frame costs no more than a short one.
+            std::uint64_t const next = FindNextTick();
+            if(next > target)
+            {
+                current_ = target;
+                break;
+            }
+            current_ = next - 1;
+            Tick();
+        }
+    }
+
+    void TimerWheel::Update(double const &dt)
+    {
+        Advance(dt);
+    }
+
+    double TimerWheel::GetTime() const
+    {
+        return time_;
+    }
+
+    size_t TimerWheel::GetPendingCount() const
+    {
+        return pending_;
+    }
+
+    void TimerWheel::Insert(std::uint32_t index)
+    {
+        Timer &timer = timers_[index];
+        // Timers too far ahead are placed at the edge of the wheel, and
+        // placed again from their real expiry when that slot comes around.
+        std::uint64_t const delta = std::min(timer.expiry_ - current_, MaxDelta);
+        unsigned level = 0;
+        while(level + 1 < LevelCount && delta >= (std::uint64_t(1) << (LevelBits * (level + 1))))
+        {
+            ++level;
+        }
+        std::uint64_t const slot = ((current_ + delta) >> (LevelBits * level)) & SlotMask;
+        std::uint32_t const bucket = static_cast<std::uint32_t>(level * SlotCount + slot);
+        std::uint32_t &head = buckets_[bucket];
+        timer.bucket_ = bucket;
+        timer.previous_ = NoTimer;
+        timer.next_ = head;
+        if(head != NoTimer)
+        {
+            timers_[head].previous_ = index;
+        }
+        head = index;
+        occupied_[bucket / WordBits] |= std::uint64_t(1) << (bucket % WordBits);
+    }
+
+    void TimerWheel::Unlink(std::uint32_t index)
+    {
+        Timer &timer = timers_[index];
+        if(timer.previous_ != NoTimer)
+        {
+            timers_[timer.previous_].next_ = timer.next_;
+        }
+        else
+        {
+            buckets_[timer.bucket_] = timer.next_;
+            if(timer.next_ == NoTimer)
+            {
+                occupied_[timer.bucket_ / WordBits] &=
+                    ~(std::uint64_t(1) << (timer.bucket_ % WordBits));
+            }
+        }
+        if(timer.next_ != NoTimer)
+        {
+            timers_[timer.next_].previous_ = timer.previous_;
+        }
+    }
+
+    void TimerWheel::Release(std::uint32_t index)
+    {
+        Timer &timer = timers_[index];
+        timer.callback_ = nullptr;
+        timer.state_ = TimerState::FREE;
+        ++timer.generation_;
+        timer.previous_ = free_;
+        free_ = index;
+    }
+
+    void TimerWheel::Cascade(unsigned level, unsigned slot)
+    {
+        unsigned const bucket = level * SlotCount + slot;
+        std::uint32_t index = buckets_[bucket];
+        buckets_[bucket] = NoTimer;
+        occupied_[bucket / WordBits] &= ~(std::uint64_t(1) << (bucket % WordBits));
+        while(index != NoTimer)
+        {
+            std::uint32_t const next = timers_[index].next_;
+            Insert(index);
+            index = next;
+        }
+    }
+
+    std::uint64_t TimerWheel::FindNextTick() const
+    {
+        std::uint64_t next = UINT64_MAX;
+        for(unsigned level = 0; level < LevelCount; ++level)
+        {
+            // A slot of a coarse ring moves down on the tick its ring reaches
+            // it, when all the finer rings are back at zero.
+            unsigned const shift = LevelBits * level;
+            std::uint64_t const position = current_ >> shift;
+            unsigned const distance = FindNextSlot(&occupied_[level * SlotCount / WordBits],
+                static_cast<unsigned>(position & SlotMask));
+            if(distance)
+            {
+                next = std::min(next, (position + distance) << shift);
+            }
+        }
+        return next;
+    }
+
+    void TimerWheel::Tick()
+    {
+        ++current_;
+        // Every time a ring comes around, the next slot of the ring above
+        // moves down. The finer rings go first so the coarser ones land on
+        // slots that are already empty.
+        unsigned slot = static_cast<unsigned>(current_ & SlotMask);
+        for(unsigned level = 1; !slot && level < LevelCount; ++level)
+        {
+            slot = static_cast<unsigned>((current_ >> (LevelBits * level)) & SlotMask);
+            Cascade(level, slot);
+        }
+
+        unsigned const bucket = static_cast<unsigned>(current_ & SlotMask);
+        std::uint32_t &head = buckets_[bucket];
+        if(head == NoTimer)
+        {
+            return;
+        }
+        // Take the whole slot off the wheel first, so what the callbacks
+        // schedule doesn't end up in the batch.
+        firing_.clear();
+        for(std::uint32_t index = head; index != NoTimer; index = timers_[index].next_)
+        {
+            timers_[index].state_ = TimerState::FIRING;
+            firing_.push_back(index);
+        }
+        head = NoTimer;
+        occupied_[bucket / WordBits] &= ~(std::uint64_t(1) << (bucket % WordBits));
+        pending_ -= firing_.size();
+        for(std::uint32_t const index : firing_)
+        {
+            if(timers_[index].state_ == TimerState::CANCELLED)
+            {
+                Release(index);
+                continue;
+            }
+            // Moved out, scheduling from the callback may move the timers.
+            Callback callback = std::move(timers_[index].callback_);
+            callback();
+            Timer &timer = timers_[index];
+            if(timer.state_ == TimerState::FIRING && timer.period_)
+            {
+                timer.callback_ = std::move(callback);
+                timer.expiry_ += timer.period_;
+                timer.state_ = TimerState::PENDING;
+                Insert(index);
+                ++pending_;
+            }
+            else
+            {
+                Release(index);
+            }
+        }
+    }
+}
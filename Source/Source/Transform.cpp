@@ -0,0 +1,88 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Transform.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * The local position, rotation and scale of a Node, along with its cached
+ * world matrix.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/Transform.hpp"
+
+namespace Ludus
+{
+    Transform::Transform() :
+        position_(), rotation_(), scale_(1.0f, 1.0f, 1.0f),
+        world_(Math::Mat4::Identity()), parent_(nullptr), dirty_(false),
+        childDirty_(false)
+    {
+    }
+
+    void Transform::SetPosition(Math::Vec3 const &position)
+    {
+        position_ = position;
+        MarkDirty();
+    }
+
+    void Transform::SetRotation(Math::Quat const &rotation)
+    {
+        rotation_ = rotation;
+        MarkDirty();
+    }
+
+    void Transform::SetScale(Math::Vec3 const &scale)
+    {
+        scale_ = scale;
+        MarkDirty();
+    }
+
+    Math::Vec3 const &Transform::GetPosition() const
+    {
+        return position_;
+    }
+
+    Math::Quat const &Transform::GetRotation() const
+    {
+        return rotation_;
+    }
+
+    Math::Vec3 const &Transform::GetScale() const
+    {
+        return scale_;
+    }
+
+    Math::Mat4 Transform::GetLocalMatrix() const
+    {
+        return Math::Mat4::Compose(position_, rotation_, scale_);
+    }
+
+    Math::Mat4 const &Transform::GetWorldMatrix() const
+    {
+        return world_;
+    }
+
+    bool Transform::IsDirty() const
+    {
+        return dirty_;
+    }
+
+    void Transform::MarkDirty()
+    {
+        dirty_ = true;
+        // Stop as soon as an ancestor already knows, everything above
+        // it was marked by whoever marked it.
+        for(Transform *ancestor = parent_; ancestor && !ancestor->childDirty_;
+            ancestor = ancestor->parent_)
+        {
+            ancestor->childDirty_ = true;
+        }
+    }
+}
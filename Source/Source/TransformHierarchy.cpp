@@ -0,0 +1,137 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            TransformHierarchy.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Recomputes the world matrices of every dirty subtree of a Node hierarchy.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/System/TransformHierarchy.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include "Ludus/System/Node.hpp"
+
+namespace Ludus
+{
+    TransformHierarchy::TransformHierarchy(JobSystem *jobs) :
+        jobs_(jobs), grain_(512)
+    {
+    }
+
+    void TransformHierarchy::Update(Node &root)
+    {
+        Gather(root);
+        for(size_t level = 0; level + 1 < levels_.size(); ++level)
+        {
+            size_t const begin = levels_[level];
+            size_t const count = levels_[level + 1] - begin;
+            if(jobs_)
+            {
+                jobs_->ParallelFor(count, grain_, [this, begin](size_t first, size_t last)
+                    { Compute(begin + first, begin + last); });
+            }
+            else
+            {
+                Compute(begin, begin + count);
+            }
+        }
+    }
+
+    void TransformHierarchy::SetGrainSize(size_t grain)
+    {
+        grain_ = grain ? grain : 1;
+    }
+
+    size_t TransformHierarchy::GetUpdatedCount() const
+    {
+        return transforms_.size();
+    }
+
+    size_t TransformHierarchy::GetLevelCount() const
+    {
+        return levels_.empty() ? 0 : levels_.size() - 1;
+    }
+
+    void TransformHierarchy::Gather(Node &root)
+    {
+        transforms_.clear();
+        parents_.clear();
+        positions_.clear();
+        rotations_.clear();
+        scales_.clear();
+        levels_.clear();
+        frontier_.clear();
+        frontier_.push_back(Pending{ &root, -1, false });
+
+        while(!frontier_.empty())
+        {
+            size_t const levelStart = transforms_.size();
+            next_.clear();
+            for(Pending const &pending : frontier_)
+            {
+                Transform &transform = pending.node_->GetTransform();
+                bool const dirty = pending.inherited_ || transform.dirty_;
+                bool const descend = dirty || transform.childDirty_;
+                std::int32_t entry = -1;
+                if(dirty)
+                {
+                    entry = static_cast<std::int32_t>(transforms_.size());
+                    transforms_.push_back(&transform);
+                    parents_.push_back(pending.parent_);
+                    positions_.push_back(transform.position_);
+                    rotations_.push_back(transform.rotation_);
+                    scales_.push_back(transform.scale_);
+                }
+                transform.dirty_ = false;
+                transform.childDirty_ = false;
+                if(descend)
+                {
+                    Node &node = *pending.node_;
+                    for(unsigned i = 0; i < node.Size(); ++i)
+                    {
+                        next_.push_back(Pending{ &node.At(i), entry, dirty });
+                    }
+                }
+            }
+            // Levels only holding clean ancestors have nothing to compute.
+            if(transforms_.size() != levelStart)
+            {
+                levels_.push_back(levelStart);
+            }
+            frontier_.swap(next_);
+        }
+        levels_.push_back(transforms_.size());
+        worlds_.resize(transforms_.size());
+    }
+
+    void TransformHierarchy::Compute(size_t begin, size_t end)
+    {
+        for(size_t i = begin; i < end; ++i)
+        {
+            Math::Mat4 const local = Math::Mat4::Compose(positions_[i],
+                rotations_[i], scales_[i]);
+            if(parents_[i] >= 0)
+            {
+                // The parent lives in an earlier level that already finished.
+                worlds_[i] = worlds_[parents_[i]] * local;
+            }
+            else if(Transform const *parent = transforms_[i]->parent_)
+            {
+                // Roots of dirty subtrees hang off clean, up to date parents.
+                worlds_[i] = parent->world_ * local;
+            }
+            else
+            {
+                worlds_[i] = local;
+            }
+            transforms_[i]->world_ = worlds_[i];
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            UploadRing.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * A ring of memory the data changing every frame gets written to.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/UploadRing.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Ludus
+{
+    UploadRing::UploadRing(size_t bytesPerFrame, unsigned framesInFlight) :
+        lines_(), capacity_(0), head_(0), tail_(0), fences_()
+    {
+        // The frame being written comes on top of the ones in flight. The
+        // live frames only wrap once, so they skip less than one frame
+        // at the end of the ring, and one more frame makes up for it.
+        size_t const lines = (bytesPerFrame + Alignment - 1) / Alignment *
+            (static_cast<size_t>(framesInFlight) + 2);
+        lines_ = std::make_unique<Line[]>(std::max<size_t>(lines, 1));
+        capacity_ = std::max<size_t>(lines, 1) * Alignment;
+        fences_.reserve(static_cast<size_t>(framesInFlight) + 2);
+    }
+
+    UploadAllocation UploadRing::Allocate(size_t size)
+    {
+        size_t const aligned = (size + Alignment - 1) / Alignment * Alignment;
+        size_t offset = static_cast<size_t>(head_ % capacity_);
+        // Allocations never wrap around, the end of the ring is skipped.
+        size_t const skipped = offset + aligned > capacity_ ? capacity_ - offset : 0;
+        if(head_ + skipped + aligned - tail_ > capacity_)
+        {
+            throw std::length_error("The upload ring is full, the frames in "
+                "flight still use it.");
+        }
+        head_ += skipped;
+        offset = skipped ? 0 : offset;
+        head_ += aligned;
+        return UploadAllocation{ reinterpret_cast<std::uint8_t *>(lines_.get()) + offset,
+            offset, size };
+    }
+
+    void UploadRing::Fence(std::uint64_t frame)
+    {
+        fences_.push_back(FrameFence{ frame, head_ });
+    }
+
+    void UploadRing::Reclaim(std::uint64_t frame)
+    {
+        auto const done = std::find_if(fences_.begin(), fences_.end(),
+            [frame](FrameFence const &fence) { return fence.frame_ > frame; });
+        if(done != fences_.begin())
+        {
+            tail_ = (done - 1)->head_;
+            fences_.erase(fences_.begin(), done);
+        }
+    }
+
+    size_t UploadRing::GetCapacity() const
+    {
+        return capacity_;
+    }
+
+    size_t UploadRing::GetUsed() const
+    {
+        return static_cast<size_t>(head_ - tail_);
+    }
+}
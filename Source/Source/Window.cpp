@@ -16,12 +16,55 @@
 /* ========================================================================= */
 #include "Ludus/Precompile.hpp"
 #include "Ludus/Graphics/Window.hpp"
+#include "Ludus/Graphics/Device.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
 
 namespace Ludus
 {
+    namespace
+    {
+        /* ================================================================= */
+        /**
+         * Gets the time on the clock the input is stamped with.
+         * @returns                 The time of the steady clock, in
+         *                          nanoseconds.
+        **/
+        /* ================================================================= */
+        std::int64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    }
+
     Window::Window(Settings const &settings, Swapchain const &swapchain) :
-        settings_(settings), swapchain_(swapchain)
+        settings_(settings), swapchain_(swapchain), images_(), front_(0),
+        queued_(), pitch_(swapchain.width_), rows_(swapchain.height_),
+        width_(swapchain.width_), height_(swapchain.height_), reallocations_(0),
+        period_(0), vblank_(0), statistics_(), latencySum_(0), latencyCount_(0)
     {
+        if(swapchain_.buffers_ < 2 || swapchain_.buffers_ > 3)
+        {
+            throw std::invalid_argument("A swapchain has two or three images.");
+        }
+        if(swapchain_.framesInFlight_ == 0 || swapchain_.refreshRate_ == 0)
+        {
+            throw std::invalid_argument("A swapchain needs frames in flight and a refresh rate.");
+        }
+        images_.resize(swapchain_.buffers_);
+        for(Image &image : images_)
+        {
+            image.pixels_.assign(static_cast<size_t>(swapchain_.width_) *
+                swapchain_.height_, PackColor(0, 0, 0));
+            image.inputTime_ = -1;
+        }
+        queued_.reserve(swapchain_.buffers_);
+        period_ = 1000000000 / swapchain_.refreshRate_;
+        vblank_ = Now() + period_;
     }
 
     void Window::SetTitle(std::wstring const &title)
@@ -31,8 +74,9 @@ namespace Ludus
 
     void Window::SetSwapchainDimensions(unsigned const &width, unsigned const &height)
     {
-        UNREFERENCED(width);
-        UNREFERENCED(height);
+        // Only the last size asked for before the end of the frame is used.
+        width_ = width;
+        height_ = height;
     }
 
     void Window::SetRenderingAPI(Graphics::DeviceType const &api)
@@ -42,12 +86,12 @@ namespace Ludus
 
     unsigned Window::GetWidth() const
     {
-        return 0;
+        return width_;
     }
 
     unsigned Window::GetHeight() const
     {
-        return 0;
+        return height_;
     }
 
     std::wstring const &Window::GetTitle() const
@@ -59,4 +103,188 @@ namespace Ludus
     {
         return settings_.device_;
     }
+
+    void Window::WaitForFrame()
+    {
+        Refresh(Now());
+        while(queued_.size() >= swapchain_.framesInFlight_)
+        {
+            WaitForRefresh();
+        }
+    }
+
+    void Window::Present(Device &device, std::int64_t inputTime)
+    {
+        ++statistics_.presented_;
+        Refresh(Now());
+        unsigned image = FindFreeImage();
+        switch(swapchain_.presentMode_)
+        {
+        case PresentMode::IMMEDIATE:
+            break;
+        case PresentMode::FIFO:
+            while(image == images_.size())
+            {
+                WaitForRefresh();
+                image = FindFreeImage();
+            }
+            break;
+        case PresentMode::MAILBOX:
+            // Only the newest frame waits, the one it replaces is lost.
+            if(!queued_.empty())
+            {
+                image = queued_.back();
+                queued_.pop_back();
+                ++statistics_.dropped_;
+            }
+            break;
+        }
+
+        Image &target = images_[image];
+        unsigned const width = std::min(device.GetWidth(), swapchain_.width_);
+        unsigned const height = std::min(device.GetHeight(), swapchain_.height_);
+        Color const *source = device.GetColorBuffer();
+        for(unsigned y = 0; y < height; ++y)
+        {
+            std::memcpy(target.pixels_.data() + static_cast<size_t>(y) * pitch_,
+                source + static_cast<size_t>(y) * device.GetPitch(), width * sizeof(Color));
+        }
+        target.inputTime_ = inputTime;
+
+        if(swapchain_.presentMode_ == PresentMode::IMMEDIATE)
+        {
+            Show(image, Now());
+        }
+        else
+        {
+            queued_.push_back(image);
+        }
+
+        if(width_ != swapchain_.width_ || height_ != swapchain_.height_ ||
+            width_ != device.GetWidth() || height_ != device.GetHeight())
+        {
+            Resize(device);
+        }
+    }
+
+    unsigned Window::GetPitch() const
+    {
+        return pitch_;
+    }
+
+    size_t Window::GetReallocationCount() const
+    {
+        return reallocations_;
+    }
+
+    Window::Swapchain const &Window::GetSwapchain() const
+    {
+        return swapchain_;
+    }
+
+    Color const *Window::GetFrontBuffer()
+    {
+        Refresh(Now());
+        return images_[front_].pixels_.data();
+    }
+
+    Window::PresentStatistics Window::GetPresentStatistics()
+    {
+        Refresh(Now());
+        PresentStatistics statistics = statistics_;
+        statistics.averageLatency_ = latencyCount_ ?
+            latencySum_ / static_cast<std::int64_t>(latencyCount_) : 0;
+        return statistics;
+    }
+
+    void Window::Resize(Device &device)
+    {
+        device.Resize(width_, height_);
+        unsigned const width = swapchain_.width_;
+        unsigned const height = swapchain_.height_;
+        swapchain_.width_ = width_;
+        swapchain_.height_ = height_;
+        if(width_ <= pitch_ && height_ <= rows_)
+        {
+            return;
+        }
+
+        // Grows by a quarter at least, like the device.
+        unsigned const pitch = width_ > pitch_ ? std::max(width_, pitch_ + pitch_ / 4) : pitch_;
+        rows_ = height_ > rows_ ? std::max(height_, rows_ + rows_ / 4) : rows_;
+        std::vector<Color> front(static_cast<size_t>(pitch) * rows_, PackColor(0, 0, 0));
+        // The display keeps showing what it had, the queued frames are lost.
+        Color const *source = images_[front_].pixels_.data();
+        for(unsigned y = 0; y < std::min(height, height_); ++y)
+        {
+            std::memcpy(front.data() + static_cast<size_t>(y) * pitch,
+                source + static_cast<size_t>(y) * pitch_,
+                std::min(width, width_) * sizeof(Color));
+        }
+        pitch_ = pitch;
+        for(Image &image : images_)
+        {
+            image.pixels_.assign(front.size(), PackColor(0, 0, 0));
+            image.inputTime_ = -1;
+        }
+        images_[front_].pixels_.swap(front);
+        statistics_.dropped_ += queued_.size();
+        queued_.clear();
+        ++reallocations_;
+    }
+
+    void Window::Refresh(std::int64_t now)
+    {
+        while(vblank_ <= now)
+        {
+            if(queued_.empty())
+            {
+                // Nothing to show, skip the refreshes that went by.
+                vblank_ += ((now - vblank_) / period_ + 1) * period_;
+                break;
+            }
+            unsigned const image = queued_.front();
+            queued_.erase(queued_.begin());
+            Show(image, vblank_);
+            vblank_ += period_;
+        }
+    }
+
+    void Window::WaitForRefresh()
+    {
+        std::int64_t const now = Now();
+        if(vblank_ > now)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(vblank_ - now));
+        }
+        Refresh(std::max(Now(), vblank_));
+    }
+
+    void Window::Show(unsigned image, std::int64_t time)
+    {
+        front_ = image;
+        ++statistics_.displayed_;
+        std::int64_t const inputTime = images_[image].inputTime_;
+        if(inputTime >= 0)
+        {
+            std::int64_t const latency = std::max<std::int64_t>(time - inputTime, 0);
+            statistics_.lastLatency_ = latency;
+            statistics_.maxLatency_ = std::max(statistics_.maxLatency_, latency);
+            latencySum_ += latency;
+            ++latencyCount_;
+        }
+    }
+
+    unsigned Window::FindFreeImage() const
+    {
+        for(unsigned image = 0; image < images_.size(); ++image)
+        {
+            if(image != front_ && std::find(queued_.begin(), queued_.end(), image) ==
+                queued_.end())
+            {
+                return image;
+            }
+        }
+        return static_cast<unsigned>(images_.size());
+    }
 }
@@ -0,0 +1,314 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            World.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Owns every entity and its components, grouped by archetype.
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Entity/World.hpp"
+#include "Ludus/System/Engine.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <exception>
+
+namespace Ludus
+{
+    /** The access declared by the system running on this thread. */
+    static thread_local Access const *declaredAccess = nullptr;
+
+    World::World() :
+        Node("World"), jobs_(nullptr), version_(1)
+    {
+    }
+
+    void World::Destroy(Entity entity)
+    {
+        CheckAccess(Access::All());
+        Lookup(entity);
+        Record &record = records_[entity.index_];
+        Archetype &archetype = *archetypes_[record.archetype_];
+        Signature const signature = archetype.GetSignature();
+        for(ComponentId id = 0; id < MaxComponents; ++id)
+        {
+            if(signature & (Signature(1) << id))
+            {
+                ComponentRegistry::GetInfo(id).destroy_(
+                    archetype.GetComponent(record.row_, id));
+            }
+        }
+        Entity const moved = archetype.Remove(record.row_);
+        if(moved != entity)
+        {
+            records_[moved.index_].row_ = record.row_;
+        }
+        // Bumping the generation makes every old handle stale.
+        ++record.generation_;
+        free_.push_back(entity.index_);
+    }
+
+    bool World::IsAlive(Entity entity) const
+    {
+        // Freed slots moved on to a generation no handle has yet.
+        return entity.index_ < records_.size() &&
+            records_[entity.index_].generation_ == entity.generation_;
+    }
+
+    void World::AddSystem(System system, Access access)
+    {
+        // Join the last phase unless something in it conflicts. Exclusive
+        // systems may move entities around, so they never share a phase.
+        Access const all = Access::All();
+        bool conflicts = phases_.empty() || access.Covers(all);
+        for(size_t i = phases_.empty() ? 0 : phases_.back(); i < systems_.size(); ++i)
+        {
+            conflicts = conflicts || systems_[i].access_.ConflictsWith(access) ||
+                systems_[i].access_.Covers(all);
+        }
+        if(conflicts)
+        {
+            phases_.push_back(systems_.size());
+        }
+        systems_.push_back(Entry{ std::move(system), access });
+    }
+
+    void World::SetJobSystem(JobSystem *jobs)
+    {
+        jobs_ = jobs;
+    }
+
+    JobSystem *World::GetJobSystem() const
+    {
+        return jobs_;
+    }
+
+    void World::Initialize()
+    {
+        Engine const *engine = dynamic_cast<Engine const *>(&GetParent());
+        if(jobs_ || !engine)
+        {
+            return;
+        }
+        try
+        {
+            jobs_ = &engine->Find<JobSystem>();
+        }
+        catch(std::runtime_error const &)
+        {
+            // No workers, everything runs on the main thread.
+        }
+    }
+
+    void World::Update(double const &dt)
+    {
+        for(size_t phase = 0; phase < phases_.size(); ++phase)
+        {
+            size_t const first = phases_[phase];
+            size_t const last = phase + 1 < phases_.size() ?
+                phases_[phase + 1] : systems_.size();
+            if(!jobs_ || last - first == 1)
+            {
+                for(size_t i = first; i < last; ++i)
+                {
+                    RunSystem(systems_[i], dt);
+                }
+                continue;
+            }
+            // The first system runs here while the workers take the rest.
+            JobCounter counter;
+            for(size_t i = first + 1; i < last; ++i)
+            {
+                Entry *entry = &systems_[i];
+                jobs_->Schedule([this, entry, dt]() { RunSystem(*entry, dt); },
+                    &counter);
+            }
+            std::exception_ptr error;
+            try
+            {
+                RunSystem(systems_[first], dt);
+            }
+            catch(...)
+            {
+                error = std::current_exception();
+            }
+            // The jobs point at the counter and the systems, so the whole
+            // phase is waited on before anything is thrown.
+            try
+            {
+                jobs_->Wait(counter);
+            }
+            catch(...)
+            {
+                error = error ? error : std::current_exception();
+            }
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    size_t World::GetPhaseCount() const
+    {
+        return phases_.size();
+    }
+
+    void World::CheckAccess(Access const &access)
+    {
+        if(declaredAccess && !declaredAccess->Covers(access))
+        {
+            throw std::logic_error("A system touched components it didn't declare.");
+        }
+    }
+
+    void World::RunSystem(Entry &entry, double dt)
+    {
+        // Restored afterwards, waiting on jobs may run another system in
+        // the middle of this one.
+        Access const *const previous = declaredAccess;
+        declaredAccess = &entry.access_;
+        try
+        {
+            entry.system_(*this, dt);
+        }
+        catch(...)
+        {
+            declaredAccess = previous;
+            throw;
+        }
+        declaredAccess = previous;
+    }
+
+    size_t World::GetEntityCount() const
+    {
+        return records_.size() - free_.size();
+    }
+
+    size_t World::GetArchetypeCount() const
+    {
+        return archetypes_.size();
+    }
+
+    Archetype const &World::GetArchetype(size_t archetype) const
+    {
+        return *archetypes_[archetype];
+    }
+
+    Archetype &World::GetArchetype(size_t archetype)
+    {
+        return *archetypes_[archetype];
+    }
+
+    std::uint32_t World::GetVersion() const
+    {
+        return version_.load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t World::NextVersion()
+    {
+        return version_.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    Entity World::Allocate(Signature signature, size_t &row)
+    {
+        std::uint32_t const archetype = FindArchetype(signature);
+        Entity entity = {};
+        if(free_.empty())
+        {
+            entity.index_ = static_cast<std::uint32_t>(records_.size());
+            records_.push_back(Record{ archetype, 0, 0 });
+        }
+        else
+        {
+            entity.index_ = free_.back();
+            free_.pop_back();
+            records_[entity.index_].archetype_ = archetype;
+        }
+        Record &record = records_[entity.index_];
+        entity.generation_ = record.generation_;
+        record.row_ = row = archetypes_[archetype]->Allocate(entity);
+        return entity;
+    }
+
+    World::Record const &World::Lookup(Entity entity) const
+    {
+        if(!IsAlive(entity))
+        {
+            throw std::invalid_argument("The entity is not alive.");
+        }
+        return records_[entity.index_];
+    }
+
+    std::uint32_t World::FindArchetype(Signature signature)
+    {
+        auto const found = lookup_.find(signature);
+        if(found != lookup_.end())
+        {
+            return found->second;
+        }
+        std::uint32_t const index = static_cast<std::uint32_t>(archetypes_.size());
+        archetypes_.push_back(std::make_unique<Archetype>(signature));
+        lookup_.emplace(signature, index);
+        return index;
+    }
+
+    size_t World::Relocate(Entity entity, Signature signature)
+    {
+        Record &record = records_[entity.index_];
+        Archetype &from = *archetypes_[record.archetype_];
+        std::uint32_t const target = FindArchetype(signature);
+        Archetype &to = *archetypes_[target];
+        size_t const row = to.Allocate(entity);
+        Chunk const &source = from.GetChunkOf(record.row_);
+        Chunk &destination = to.GetChunkOf(row);
+        std::uint32_t const version = NextVersion();
+
+        // Components gained are new in the destination chunk.
+        Signature const current = from.GetSignature();
+        for(ComponentId id = 0; id < MaxComponents; ++id)
+        {
+            if((signature & ~current) & (Signature(1) << id))
+            {
+                destination.MarkAdded(to.GetColumnIndex(id), version);
+            }
+        }
+        for(ComponentId id = 0; id < MaxComponents; ++id)
+        {
+            Signature const bit = Signature(1) << id;
+            if(!(current & bit))
+            {
+                continue;
+            }
+            ComponentInfo const &info = ComponentRegistry::GetInfo(id);
+            void *component = from.GetComponent(record.row_, id);
+            if(signature & bit)
+            {
+                info.move_(to.GetComponent(row, id), component);
+                // Kept components carry their history along.
+                size_t const fromColumn = from.GetColumnIndex(id);
+                size_t const toColumn = to.GetColumnIndex(id);
+                destination.MarkChanged(toColumn, source.GetChangedVersion(fromColumn));
+                destination.MarkAdded(toColumn, source.GetAddedVersion(fromColumn));
+            }
+            else
+            {
+                info.destroy_(component);
+            }
+        }
+        Entity const moved = from.Remove(record.row_);
+        if(moved != entity)
+        {
+            records_[moved.index_].row_ = record.row_;
+        }
+        record.archetype_ = target;
+        record.row_ = row;
+        return row;
+    }
+}
@@ -257,3 +257,3400 @@ TEST_CASE("Testing the Graphics interface.")
         CHECK(window.GetTitle() == titleSet);
     }
 }
+
+/*  ======================================================================== */
+/*  TRANSFORMS                                                               */
+/*  ======================================================================== */
+#include <Ludus/System/JobSystem.hpp>
+#include <Ludus/System/TransformHierarchy.hpp>
+
+TEST_CASE("Testing the transform hierarchy.", "[Transform]")
+{
+    using Ludus::Node;
+    using namespace Ludus::Math;
+
+    Node root("Root");
+    std::shared_ptr<Node> child = std::make_shared<Node>("Child");
+    std::shared_ptr<Node> grandChild = std::make_shared<Node>("Grand-Child");
+    std::shared_ptr<Node> sibling = std::make_shared<Node>("Sibling");
+    root.AddChild(child);
+    root.AddChild(sibling);
+    child->AddChild(grandChild);
+
+    root.GetTransform().SetPosition(Vec3(1.0f, 0.0f, 0.0f));
+    child->GetTransform().SetRotation(
+        Quat::FromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), 1.5707963f));
+    grandChild->GetTransform().SetPosition(Vec3(2.0f, 0.0f, 0.0f));
+
+    Ludus::TransformHierarchy hierarchy;
+    hierarchy.Update(root);
+
+    SECTION("World matrices compose the parents.")
+    {
+        // The grand child is pushed along x, rotated onto y, then moved
+        // by the root.
+        Vec3 const origin = TransformPoint(
+            grandChild->GetTransform().GetWorldMatrix(), Vec3());
+        CHECK(origin.x_ == Catch::Approx(1.0f).margin(1e-5));
+        CHECK(origin.y_ == Catch::Approx(2.0f).margin(1e-5));
+        CHECK(hierarchy.GetUpdatedCount() == 4);
+        CHECK(hierarchy.GetLevelCount() == 3);
+        CHECK_FALSE(grandChild->GetTransform().IsDirty());
+    }
+
+    SECTION("Only dirty subtrees get recomputed.")
+    {
+        hierarchy.Update(root);
+        CHECK(hierarchy.GetUpdatedCount() == 0);
+
+        child->GetTransform().SetScale(Vec3(2.0f, 2.0f, 2.0f));
+        hierarchy.Update(root);
+        // The child and the grand child, not the root nor the sibling.
+        CHECK(hierarchy.GetUpdatedCount() == 2);
+        Vec3 const origin = TransformPoint(
+            grandChild->GetTransform().GetWorldMatrix(), Vec3());
+        CHECK(origin.y_ == Catch::Approx(4.0f).margin(1e-5));
+    }
+
+    SECTION("Parallel updates match the serial ones.")
+    {
+        Node serialRoot("Serial");
+        Node parallelRoot("Parallel");
+        for(int i = 0; i < 64; ++i)
+        {
+            for(Node *parent : { &serialRoot, &parallelRoot })
+            {
+                std::shared_ptr<Node> branch = std::make_shared<Node>();
+                branch->GetTransform().SetPosition(Vec3(float(i), 1.0f, 0.0f));
+                for(int j = 0; j < 16; ++j)
+                {
+                    std::shared_ptr<Node> leaf = std::make_shared<Node>();
+                    leaf->GetTransform().SetRotation(
+                        Quat::FromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), 0.1f * j));
+                    leaf->GetTransform().SetPosition(Vec3(0.0f, 0.0f, float(j)));
+                    branch->AddChild(leaf);
+                }
+                parent->AddChild(branch);
+            }
+        }
+
+        Ludus::JobSystem jobs(3);
+        Ludus::TransformHierarchy parallel(&jobs);
+        parallel.SetGrainSize(8);
+        hierarchy.Update(serialRoot);
+        parallel.Update(parallelRoot);
+        CHECK(parallel.GetUpdatedCount() == hierarchy.GetUpdatedCount());
+        for(unsigned i = 0; i < serialRoot.Size(); ++i)
+        {
+            for(unsigned j = 0; j < serialRoot[i].Size(); ++j)
+            {
+                REQUIRE(NearlyEqual(
+                    serialRoot[i][j].GetTransform().GetWorldMatrix(),
+                    parallelRoot[i][j].GetTransform().GetWorldMatrix()));
+            }
+        }
+    }
+}
+
+TEST_CASE("Propagating the exceptions of jobs.", "[Jobs]")
+{
+    Ludus::JobSystem jobs(3);
+
+    SECTION("A failed piece comes out of the loop once every piece is done.")
+    {
+        for(int run = 0; run < 50; ++run)
+        {
+            std::atomic<size_t> done(0);
+            size_t const failing = run % 2 ? 0 : 96;
+            CHECK_THROWS_AS(jobs.ParallelFor(128, 8, [&](size_t begin, size_t end)
+                {
+                    if(begin == failing)
+                    {
+                        throw std::runtime_error("The piece failed.");
+                    }
+                    done += end - begin;
+                }), std::runtime_error);
+            CHECK(done == 120);
+        }
+    }
+
+    SECTION("Jobs throwing on the workers fail their counter.")
+    {
+        Ludus::JobCounter counter;
+        std::atomic<int> done(0);
+        // Nobody waits on this one, so its exception is dropped.
+        jobs.Schedule([]() { throw std::logic_error("Unseen."); });
+        for(int i = 0; i < 16; ++i)
+        {
+            jobs.Schedule([i, &done]()
+                {
+                    if(i == 5)
+                    {
+                        throw std::runtime_error("The job failed.");
+                    }
+                    ++done;
+                }, &counter);
+        }
+        CHECK_THROWS_AS(jobs.Wait(counter), std::runtime_error);
+        CHECK(counter.IsDone());
+        CHECK(done == 15);
+    }
+}
+
+/*  ======================================================================== */
+/*  MATH                                                                     */
+/*  ======================================================================== */
+#include <Ludus/Math/Batch.hpp>
+#include <random>
+
+TEST_CASE("Testing the vector types.", "[Math]")
+{
+    using namespace Ludus::Math;
+
+    SECTION("Vec4 operations go through the registers correctly.")
+    {
+        Vec4 const a(1.0f, 2.0f, 3.0f, 4.0f);
+        Vec4 const b(4.0f, 3.0f, 2.0f, 1.0f);
+        Vec4 const sum = a + b;
+        CHECK(sum.x_ == 5.0f);
+        CHECK(sum.w_ == 5.0f);
+        CHECK(Dot(a, b) == 20.0f);
+        CHECK(Length(Normalize(a)) == Catch::Approx(1.0f));
+    }
+
+    SECTION("Matrices compose and transform like the textbook formulas.")
+    {
+        Quat const rotation = Quat::FromAxisAngle(Vec3(0.0f, 0.0f, 1.0f),
+            1.5707963f);
+        Mat4 const m = Mat4::Compose(Vec3(1.0f, 2.0f, 3.0f), rotation,
+            Vec3(2.0f, 2.0f, 2.0f));
+        Vec3 const point = TransformPoint(m, Vec3(1.0f, 0.0f, 0.0f));
+        CHECK(point.x_ == Catch::Approx(1.0f).margin(1e-5));
+        CHECK(point.y_ == Catch::Approx(4.0f).margin(1e-5));
+        CHECK(point.z_ == Catch::Approx(3.0f).margin(1e-5));
+        Vec3 const rotated = Rotate(rotation, Vec3(1.0f, 0.0f, 0.0f));
+        CHECK(rotated.y_ == Catch::Approx(1.0f).margin(1e-5));
+        CHECK(NearlyEqual(m * Mat4::Identity(), m));
+        CHECK(NearlyEqual(Mat4::Identity() * m, m));
+    }
+}
+
+TEST_CASE("Testing the batch kernels against the scalar ones.", "[Math]")
+{
+    using namespace Ludus::Math;
+    // An odd count makes sure the leftovers are handled.
+    size_t const count = 1027;
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> range(-10.0f, 10.0f);
+
+    SECTION("Transforming points.")
+    {
+        std::vector<float> x(count), y(count), z(count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            x[i] = range(random);
+            y[i] = range(random);
+            z[i] = range(random);
+        }
+        Mat4 const m = Mat4::Compose(Vec3(1.0f, -2.0f, 3.0f),
+            Normalize(Quat(0.1f, 0.2f, 0.3f, 0.9f)), Vec3(1.0f, 2.0f, 3.0f));
+        std::vector<float> fx(count), fy(count), fz(count);
+        std::vector<float> sx(count), sy(count), sz(count);
+        TransformPoints(m, PointStream{ x.data(), y.data(), z.data() },
+            PointOutput{ fx.data(), fy.data(), fz.data() }, count);
+        Scalar::TransformPoints(m, PointStream{ x.data(), y.data(), z.data() },
+            PointOutput{ sx.data(), sy.data(), sz.data() }, count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(fx[i] == Catch::Approx(sx[i]).margin(1e-4));
+            REQUIRE(fy[i] == Catch::Approx(sy[i]).margin(1e-4));
+            REQUIRE(fz[i] == Catch::Approx(sz[i]).margin(1e-4));
+        }
+    }
+
+    SECTION("Multiplying matrices.")
+    {
+        std::vector<Mat4> lhs(count), rhs(count), fast(count), slow(count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            for(unsigned j = 0; j < 16; ++j)
+            {
+                lhs[i].m_[j] = range(random);
+                rhs[i].m_[j] = range(random);
+            }
+        }
+        MultiplyMatrices(lhs.data(), rhs.data(), fast.data(), count);
+        Scalar::MultiplyMatrices(lhs.data(), rhs.data(), slow.data(), count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(NearlyEqual(fast[i], slow[i], 1e-3f));
+        }
+    }
+
+    SECTION("Normalizing quaternions.")
+    {
+        std::vector<float> x(count), y(count), z(count), w(count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            x[i] = range(random);
+            y[i] = range(random);
+            z[i] = range(random);
+            w[i] = range(random);
+        }
+        NormalizeQuats(QuatStream{ x.data(), y.data(), z.data(), w.data() },
+            count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            float const length = x[i] * x[i] + y[i] * y[i] + z[i] * z[i] +
+                w[i] * w[i];
+            REQUIRE(length == Catch::Approx(1.0f).margin(1e-5));
+        }
+    }
+}
+
+TEST_CASE("Benchmarking the batch kernels.", "[Math][!benchmark]")
+{
+    using namespace Ludus::Math;
+    size_t const count = 100000;
+    std::vector<float> x(count, 1.0f), y(count, 2.0f), z(count, 3.0f);
+    std::vector<float> w(count, 4.0f);
+    std::vector<float> ox(count), oy(count), oz(count);
+    std::vector<Mat4> lhs(count, Mat4::Identity()), rhs(count, Mat4::Identity());
+    std::vector<Mat4> out(count);
+    Mat4 const m = Mat4::Compose(Vec3(1.0f, 2.0f, 3.0f), Quat(),
+        Vec3(2.0f, 2.0f, 2.0f));
+
+    BENCHMARK("Transform points, naive AoS loop")
+    {
+        for(size_t i = 0; i < count; ++i)
+        {
+            Vec3 const p = TransformPoint(m, Vec3(x[i], y[i], z[i]));
+            ox[i] = p.x_;
+            oy[i] = p.y_;
+            oz[i] = p.z_;
+        }
+        return ox[count - 1];
+    };
+    BENCHMARK("Transform points, scalar SoA")
+    {
+        Scalar::TransformPoints(m, PointStream{ x.data(), y.data(), z.data() },
+            PointOutput{ ox.data(), oy.data(), oz.data() }, count);
+        return ox[count - 1];
+    };
+    BENCHMARK("Transform points, SIMD SoA")
+    {
+        TransformPoints(m, PointStream{ x.data(), y.data(), z.data() },
+            PointOutput{ ox.data(), oy.data(), oz.data() }, count);
+        return ox[count - 1];
+    };
+    BENCHMARK("Multiply matrices, scalar")
+    {
+        Scalar::MultiplyMatrices(lhs.data(), rhs.data(), out.data(), count);
+        return out[count - 1].m_[0];
+    };
+    BENCHMARK("Multiply matrices, SIMD")
+    {
+        MultiplyMatrices(lhs.data(), rhs.data(), out.data(), count);
+        return out[count - 1].m_[0];
+    };
+    BENCHMARK("Normalize quaternions, scalar")
+    {
+        Scalar::NormalizeQuats(QuatStream{ x.data(), y.data(), z.data(),
+            w.data() }, count);
+        return x[count - 1];
+    };
+    BENCHMARK("Normalize quaternions, SIMD")
+    {
+        NormalizeQuats(QuatStream{ x.data(), y.data(), z.data(), w.data() },
+            count);
+        return x[count - 1];
+    };
+}
+
+/*  ======================================================================== */
+/*  SPRITES                                                                  */
+/*  ======================================================================== */
+#include <Ludus/Graphics/Device.hpp>
+#include <Ludus/Graphics/Renderer.hpp>
+#include <Ludus/Graphics/SpriteBatch.hpp>
+#include <Ludus/Graphics/TextureAtlas.hpp>
+
+TEST_CASE("Testing the atlas packer.", "[Sprite]")
+{
+    using namespace Ludus;
+
+    SECTION("Packed rectangles stay inside the page and never overlap.")
+    {
+        SkylinePacker packer(256, 256);
+        std::mt19937 random(7);
+        std::uniform_int_distribution<unsigned> size(4, 40);
+        struct Rect { unsigned x_, y_, w_, h_; };
+        std::vector<Rect> placed;
+        for(int i = 0; i < 200; ++i)
+        {
+            Rect rect = { 0, 0, size(random), size(random) };
+            if(packer.Pack(rect.w_, rect.h_, rect.x_, rect.y_))
+            {
+                REQUIRE(rect.x_ + rect.w_ <= 256);
+                REQUIRE(rect.y_ + rect.h_ <= 256);
+                for(Rect const &other : placed)
+                {
+                    bool const apart = rect.x_ + rect.w_ <= other.x_ ||
+                        other.x_ + other.w_ <= rect.x_ ||
+                        rect.y_ + rect.h_ <= other.y_ ||
+                        other.y_ + other.h_ <= rect.y_;
+                    REQUIRE(apart);
+                }
+                placed.push_back(rect);
+            }
+        }
+        CHECK(packer.GetOccupancy() > 0.7f);
+    }
+
+    SECTION("Images overflow into new pages and keep their texels.")
+    {
+        TextureAtlas atlas(64, 1);
+        std::vector<size_t> regions;
+        for(std::uint8_t i = 0; i < 20; ++i)
+        {
+            regions.push_back(atlas.Add(Texture(20, 20, PackColor(i, 0, 0))));
+        }
+        atlas.Build();
+        CHECK(atlas.GetPageCount() > 1);
+        for(std::uint8_t i = 0; i < 20; ++i)
+        {
+            AtlasRegion const &region = atlas.GetRegion(regions[i]);
+            Texture const &page = atlas.GetPage(region.page_);
+            unsigned const x = static_cast<unsigned>(region.u0_ * 64) + 10;
+            unsigned const y = static_cast<unsigned>(region.v0_ * 64) + 10;
+            REQUIRE(page.GetTexel(x, y) == PackColor(i, 0, 0));
+        }
+        REQUIRE_THROWS(atlas.Add(Texture(64, 64)));
+    }
+}
+
+TEST_CASE("Testing the sprite batching.", "[Sprite]")
+{
+    using namespace Ludus;
+    Color const red = PackColor(255, 0, 0);
+    Color const blue = PackColor(0, 0, 255);
+
+    // Two images that don't fit on the same page.
+    TextureAtlas atlas(32, 1);
+    size_t const redImage = atlas.Add(Texture(24, 24, red));
+    size_t const blueImage = atlas.Add(Texture(24, 24, blue));
+    atlas.Build();
+    REQUIRE(atlas.GetPageCount() == 2);
+
+    Device device(128, 128);
+    Renderer renderer(device);
+    JobSystem jobs(3);
+    SpriteBatch batch(atlas, &jobs);
+
+    SECTION("Thousands of sprites collapse into one batch per page and blend.")
+    {
+        renderer.Clear(PackColor(0, 0, 0));
+        for(int i = 0; i < 5000; ++i)
+        {
+            Sprite sprite = {};
+            sprite.x_ = static_cast<float>(i % 128);
+            sprite.y_ = static_cast<float>((i / 128) % 128);
+            sprite.width_ = sprite.height_ = 4.0f;
+            sprite.rotation_ = (i % 3) ? 0.0f : 0.5f;
+            sprite.color_ = PackColor(255, 255, 255);
+            sprite.region_ = static_cast<std::uint32_t>(i % 2 ? redImage : blueImage);
+            sprite.blend_ = (i % 5) ? BlendMode::ALPHA : BlendMode::ADDITIVE;
+            batch.Draw(sprite);
+        }
+        batch.Flush(renderer);
+        CHECK(batch.GetBatchCount() == 4);
+        renderer.Submit();
+        CHECK(renderer.GetStatistics().draws_ == 4);
+        CHECK(renderer.GetStatistics().quads_ == 5000);
+    }
+
+    SECTION("Layers are drawn in order and the texels land on screen.")
+    {
+        Sprite below = {};
+        below.x_ = below.y_ = 64.0f;
+        below.width_ = below.height_ = 32.0f;
+        below.color_ = PackColor(255, 255, 255);
+        below.region_ = static_cast<std::uint32_t>(redImage);
+        below.blend_ = BlendMode::OPAQUE;
+        below.layer_ = 0;
+        Sprite above = below;
+        above.width_ = above.height_ = 8.0f;
+        above.region_ = static_cast<std::uint32_t>(blueImage);
+        above.layer_ = 1;
+
+        // Queued in the wrong order on purpose.
+        batch.Draw(above);
+        batch.Draw(below);
+        batch.Flush(renderer);
+        renderer.Submit();
+        CHECK(device.GetPixel(64, 64) == blue);
+        CHECK(device.GetPixel(52, 52) == red);
+        CHECK(device.GetPixel(10, 10) == PackColor(0, 0, 0));
+    }
+}
+
+/*  ======================================================================== */
+/*  INSTANCING                                                               */
+/*  ======================================================================== */
+#include <Ludus/Graphics/Culling.hpp>
+#include <Ludus/Graphics/Mesh.hpp>
+
+TEST_CASE("Testing the instanced drawing.", "[Instancing]")
+{
+    using namespace Ludus;
+    using namespace Ludus::Math;
+    // A unit cube centered on the origin.
+    Mesh const cube({ Vec3(-0.5f, -0.5f, -0.5f), Vec3(0.5f, -0.5f, -0.5f),
+        Vec3(0.5f, 0.5f, -0.5f), Vec3(-0.5f, 0.5f, -0.5f),
+        Vec3(-0.5f, -0.5f, 0.5f), Vec3(0.5f, -0.5f, 0.5f),
+        Vec3(0.5f, 0.5f, 0.5f), Vec3(-0.5f, 0.5f, 0.5f) },
+        { 0, 1, 2, 0, 2, 3, 4, 6, 5, 4, 7, 6, 0, 4, 5, 0, 5, 1,
+          3, 2, 6, 3, 6, 7, 0, 3, 7, 0, 7, 4, 1, 5, 6, 1, 6, 2 });
+    CHECK(cube.GetTriangleCount() == 12);
+    CHECK(cube.GetBoundsRadius() == Catch::Approx(std::sqrt(0.75f)));
+    CHECK_THROWS_AS(Mesh({ Vec3() }, { 0, 1, 2 }), std::invalid_argument);
+
+    Mat4 const viewProjection = Mat4::Perspective(1.0f, 1.0f, 0.1f, 100.0f) *
+        Mat4::LookAt(Vec3(0.0f, 0.0f, 10.0f), Vec3(), Vec3(0.0f, 1.0f, 0.0f));
+    Quat const noRotation = Quat::FromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), 0.0f);
+
+    SECTION("The frustum keeps what the camera sees.")
+    {
+        Frustum const frustum = Frustum::FromMatrix(viewProjection);
+        Instance instances[5] = {};
+        // In front, behind the camera, far off to the side, past the far
+        // plane and straddling the left plane.
+        Vec3 const positions[5] = { Vec3(), Vec3(0.0f, 0.0f, 20.0f),
+            Vec3(100.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, -200.0f),
+            Vec3(-5.6f, 0.0f, 0.0f) };
+        for(unsigned i = 0; i < 5; ++i)
+        {
+            instances[i].transform_ = Mat4::Compose(positions[i], noRotation,
+                Vec3(1.0f, 1.0f, 1.0f));
+        }
+        InstanceCuller culler;
+        REQUIRE(culler.Cull(frustum, cube, instances, 5) == 2);
+        CHECK(culler.GetVisible()[0] == 0);
+        CHECK(culler.GetVisible()[1] == 4);
+
+        // Scaling the straddling cube down pulls it out of the view.
+        instances[4].transform_ = Mat4::Compose(positions[4], noRotation,
+            Vec3(0.1f, 0.1f, 0.1f));
+        CHECK(culler.Cull(frustum, cube, instances, 5) == 1);
+    }
+
+    Device device(64, 64);
+    Renderer renderer(device);
+
+    SECTION("Many instances cost a single command.")
+    {
+        std::vector<Instance> instances(100000);
+        for(size_t i = 0; i < instances.size(); ++i)
+        {
+            // Half of the cubes sit behind the camera.
+            float const z = (i % 2) ? 15.0f : -20.0f - static_cast<float>(i % 50);
+            instances[i].transform_ = Mat4::Compose(
+                Vec3(static_cast<float>(i % 7) - 3.0f,
+                static_cast<float>(i % 5) - 2.0f, z), noRotation,
+                Vec3(0.5f, 0.5f, 0.5f));
+            instances[i].color_ = PackColor(0, static_cast<std::uint8_t>(i), 255);
+        }
+        renderer.Clear(PackColor(0, 0, 0));
+        renderer.SetViewProjection(viewProjection);
+        renderer.DrawInstanced(cube, instances.data(), instances.size());
+        CHECK(renderer.GetCommandCount() == 2);
+        renderer.Submit();
+
+        Renderer::Statistics const &statistics = renderer.GetStatistics();
+        CHECK(statistics.draws_ == 1);
+        CHECK(statistics.instances_ == 100000);
+        CHECK(statistics.visibleInstances_ == 50000);
+        CHECK(statistics.triangles_ > 0);
+        CHECK(statistics.triangles_ <= 50000 * 12);
+    }
+
+    SECTION("The nearest instance wins the depth test.")
+    {
+        Color const red = PackColor(255, 0, 0);
+        Color const green = PackColor(0, 255, 0);
+        Instance instances[2] = {};
+        // The far cube is drawn last and must stay hidden.
+        instances[0].transform_ = Mat4::Compose(Vec3(0.0f, 0.0f, 2.0f),
+            noRotation, Vec3(1.0f, 1.0f, 1.0f));
+        instances[0].color_ = red;
+        instances[1].transform_ = Mat4::Compose(Vec3(),
+            noRotation, Vec3(4.0f, 4.0f, 4.0f));
+        instances[1].color_ = green;
+
+        renderer.Clear(PackColor(0, 0, 0));
+        renderer.SetViewProjection(viewProjection);
+        renderer.DrawInstanced(cube, instances, 2);
+        renderer.Submit();
+        CHECK(device.GetPixel(32, 32) == red);
+        CHECK(device.GetDepth(32, 32) < 1.0f);
+        CHECK(device.GetPixel(0, 0) == PackColor(0, 0, 0));
+        CHECK(device.GetPixel(24, 32) == green);
+    }
+}
+
+/*  ======================================================================== */
+/*  CAPTURE                                                                  */
+/*  ======================================================================== */
+#include <Ludus/Graphics/FrameCapture.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+TEST_CASE("Testing the frame capture.", "[Capture]")
+{
+    using namespace Ludus;
+    using namespace Ludus::Math;
+    std::string const path = (std::filesystem::temp_directory_path() /
+        "Ludus-Capture.ldfc").string();
+
+    Texture checker(2, 2, { PackColor(255, 0, 0), PackColor(0, 255, 0),
+        PackColor(0, 0, 255), PackColor(255, 255, 255) });
+    Mesh const triangle({ Vec3(-1.0f, -1.0f, 0.0f), Vec3(1.0f, -1.0f, 0.0f),
+        Vec3(0.0f, 1.0f, 0.0f) }, { 0, 1, 2 });
+    Instance instances[2] = {};
+    instances[0].transform_ = Mat4::Identity();
+    instances[0].color_ = PackColor(255, 255, 0);
+    instances[1].transform_ = Mat4::Compose(Vec3(0.5f, 0.5f, -0.5f),
+        Quat::FromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), 0.3f), Vec3(0.5f, 0.5f, 1.0f));
+    instances[1].color_ = PackColor(0, 255, 255);
+
+    // Records the same frame into any renderer.
+    auto const record = [&](Renderer &renderer)
+    {
+        renderer.Clear(PackColor(10, 20, 30));
+        size_t const first = renderer.AllocateQuads(2);
+        Vertex2D *vertices = renderer.GetQuadVertices(first);
+        for(unsigned quad = 0; quad < 2; ++quad)
+        {
+            float const offset = quad * 20.0f;
+            vertices[quad * 4 + 0] = { offset, offset, 0.0f, 0.0f, PackColor(255, 255, 255) };
+            vertices[quad * 4 + 1] = { offset + 24.0f, offset, 1.0f, 0.0f, PackColor(255, 255, 255) };
+            vertices[quad * 4 + 2] = { offset + 24.0f, offset + 24.0f, 1.0f, 1.0f, PackColor(255, 255, 255, 128) };
+            vertices[quad * 4 + 3] = { offset, offset + 24.0f, 0.0f, 1.0f, PackColor(255, 255, 255, 128) };
+        }
+        renderer.DrawQuads(first, 1, &checker, BlendMode::OPAQUE);
+        renderer.DrawQuads(first + 1, 1, &checker, BlendMode::ALPHA);
+        renderer.SetViewProjection(Mat4::Perspective(1.2f, 1.0f, 0.1f, 10.0f) *
+            Mat4::LookAt(Vec3(0.0f, 0.0f, 3.0f), Vec3(), Vec3(0.0f, 1.0f, 0.0f)));
+        renderer.DrawInstanced(triangle, instances, 2);
+    };
+
+    Device device(48, 48);
+    Renderer renderer(device);
+    record(renderer);
+    renderer.CaptureNextFrame(path);
+    renderer.Submit();
+    std::vector<Color> const expected(device.GetColorBuffer(),
+        device.GetColorBuffer() + 48 * 48);
+    REQUIRE(renderer.GetPassTimings().size() == 4);
+    CHECK(std::string(renderer.GetPassTimings()[3].name_) == "Instanced");
+
+    SECTION("Replaying the capture draws the same frame.")
+    {
+        FrameCapture const capture = FrameCapture::Load(path);
+        CHECK(capture.GetWidth() == 48);
+        CHECK(capture.GetHeight() == 48);
+        CHECK(capture.GetCommandCount() == 4);
+
+        // The originals can change without touching the capture.
+        checker.SetTexel(0, 0, PackColor(0, 0, 0));
+        instances[0].color_ = PackColor(0, 0, 0);
+
+        Device replayDevice(capture.GetWidth(), capture.GetHeight());
+        Renderer replayRenderer(replayDevice);
+        for(unsigned run = 0; run < 2; ++run)
+        {
+            capture.Record(replayRenderer);
+            replayRenderer.Submit();
+            CHECK(std::equal(expected.begin(), expected.end(),
+                replayDevice.GetColorBuffer()));
+        }
+        CHECK(replayRenderer.GetStatistics().draws_ == 3);
+        CHECK(replayRenderer.GetStatistics().visibleInstances_ == 2);
+    }
+
+    SECTION("Broken files are rejected.")
+    {
+        CHECK_THROWS_AS(FrameCapture::Load(path + ".missing"), std::runtime_error);
+        std::vector<char> bytes;
+        {
+            std::ifstream file(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+        }
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(bytes.data(), bytes.size() / 2);
+        }
+        CHECK_THROWS_AS(FrameCapture::Load(path), std::runtime_error);
+        bytes[0] = 'X';
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(bytes.data(), bytes.size());
+        }
+        CHECK_THROWS_AS(FrameCapture::Load(path), std::runtime_error);
+    }
+
+    SECTION("Indices that wrap around or empty textures are rejected.")
+    {
+        std::vector<char> bytes;
+        {
+            std::ifstream file(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+        }
+        // The commands start after the header and their count, 40 bytes
+        // each, and the only texture follows them.
+        auto const save = [&](std::vector<char> const &broken)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(broken.data(), broken.size());
+        };
+        auto const patch = [](std::vector<char> &broken, size_t offset, std::uint64_t value)
+        {
+            std::memcpy(broken.data() + offset, &value, sizeof(value));
+        };
+        std::vector<char> broken = bytes;
+        // (first + count) * 4 wraps around to zero.
+        patch(broken, 24 + 40, 0x4000000000000000ull - 0x40000000ull);
+        patch(broken, 24 + 40 + 8, 0x40000000ull);
+        save(broken);
+        CHECK_THROWS_AS(FrameCapture::Load(path), std::runtime_error);
+
+        broken = bytes;
+        patch(broken, 24 + 120 + 8, ~std::uint64_t(0));
+        patch(broken, 24 + 120 + 16, 3);
+        save(broken);
+        CHECK_THROWS_AS(FrameCapture::Load(path), std::runtime_error);
+
+        // A 0x0 texture, its texels dropped.
+        broken = bytes;
+        patch(broken, 24 + 160 + 8, 0);
+        patch(broken, 24 + 160 + 16, 0);
+        broken.erase(broken.begin() + 24 + 160 + 24, broken.begin() + 24 + 160 + 40);
+        save(broken);
+        CHECK_THROWS_AS(FrameCapture::Load(path), std::runtime_error);
+
+        save(bytes);
+        CHECK_NOTHROW(FrameCapture::Load(path));
+    }
+
+    SECTION("A failed capture still draws and clears the frame.")
+    {
+        record(renderer);
+        renderer.CaptureNextFrame((std::filesystem::path(path) / "Missing" /
+            "Frame.ldfc").string());
+        CHECK_THROWS_AS(renderer.Submit(), std::runtime_error);
+        CHECK(renderer.GetCommandCount() == 0);
+        CHECK(std::equal(expected.begin(), expected.end(), device.GetColorBuffer()));
+        renderer.Submit();
+        CHECK(renderer.GetStatistics().commands_ == 0);
+    }
+    std::remove(path.c_str());
+}
+
+/*  ======================================================================== */
+/*  ENTITIES                                                                 */
+/*  ======================================================================== */
+#include <Ludus/Entity/Query.hpp>
+
+namespace
+{
+    struct Position { float x_, y_, z_; };
+    struct Velocity { float x_, y_, z_; };
+    struct Health { int value_; };
+    // Counts how many copies are alive to catch leaked or doubly
+    // destroyed components.
+    struct Tracked
+    {
+        static int alive_;
+        std::string name_;
+        explicit Tracked(std::string name) : name_(std::move(name)) { ++alive_; }
+        Tracked(Tracked &&other) noexcept : name_(std::move(other.name_)) { ++alive_; }
+        Tracked &operator=(Tracked &&other) noexcept { name_ = std::move(other.name_); return *this; }
+        ~Tracked() { --alive_; }
+    };
+    int Tracked::alive_ = 0;
+}
+
+TEST_CASE("Testing the entity storage.", "[ECS]")
+{
+    using namespace Ludus;
+    World world;
+
+    SECTION("Entities keep their components through structural changes.")
+    {
+        std::vector<Entity> entities;
+        for(int i = 0; i < 3000; ++i)
+        {
+            entities.push_back(world.Create(Position{ float(i), 0.0f, 0.0f },
+                Health{ i }));
+        }
+        CHECK(world.GetEntityCount() == 3000);
+        for(int i = 0; i < 3000; i += 3)
+        {
+            world.Add(entities[i], Velocity{ 1.0f, 2.0f, 3.0f });
+        }
+        for(int i = 1; i < 3000; i += 3)
+        {
+            world.Destroy(entities[i]);
+        }
+        world.Remove<Health>(entities[0]);
+        CHECK(world.GetEntityCount() == 2000);
+        CHECK_FALSE(world.IsAlive(entities[1]));
+        CHECK_THROWS_AS(world.Destroy(entities[1]), std::invalid_argument);
+        CHECK_THROWS_AS(world.Get<Health>(entities[0]), std::out_of_range);
+
+        for(int i = 0; i < 3000; ++i)
+        {
+            if(i % 3 == 1)
+            {
+                continue;
+            }
+            REQUIRE(world.Get<Position>(entities[i]).x_ == float(i));
+            CHECK(world.Has<Velocity>(entities[i]) == (i % 3 == 0));
+            if(i != 0)
+            {
+                CHECK(world.Get<Health>(entities[i]).value_ == i);
+            }
+        }
+
+        // Reused slots don't bring the old handles back.
+        Entity const reused = world.Create(Health{ -1 });
+        CHECK(reused.index_ == entities[2998].index_);
+        CHECK(reused != entities[2998]);
+        CHECK_FALSE(world.IsAlive(entities[2998]));
+    }
+
+    SECTION("Components are constructed and destroyed exactly once.")
+    {
+        {
+            World scoped;
+            std::vector<Entity> entities;
+            for(int i = 0; i < 1000; ++i)
+            {
+                entities.push_back(scoped.Create(Tracked("entity " + std::to_string(i))));
+            }
+            for(int i = 0; i < 1000; i += 2)
+            {
+                scoped.Add(entities[i], Health{ i });
+            }
+            for(int i = 0; i < 1000; i += 4)
+            {
+                scoped.Destroy(entities[i]);
+            }
+            CHECK(Tracked::alive_ == 750);
+            CHECK(scoped.Get<Tracked>(entities[999]).name_ == "entity 999");
+            CHECK(scoped.Get<Tracked>(entities[2]).name_ == "entity 2");
+        }
+        CHECK(Tracked::alive_ == 0);
+    }
+
+    SECTION("Queries visit every matching archetype in packed columns.")
+    {
+        for(int i = 0; i < 10000; ++i)
+        {
+            Entity const entity = world.Create(Position{ 0.0f, 0.0f, 0.0f },
+                Velocity{ 1.0f, float(i), 0.0f });
+            if(i % 2)
+            {
+                world.Add(entity, Health{ i });
+            }
+        }
+        world.Create(Position{ 5.0f, 5.0f, 5.0f });
+
+        Query<Position, Velocity const> movers(world);
+        CHECK(movers.Count() == 10000);
+        movers.ForEach([](Position &position, Velocity const &velocity)
+        {
+            position.x_ += velocity.x_;
+            position.y_ += velocity.y_;
+        });
+
+        size_t chunks = 0;
+        Query<Position const> positions(world);
+        positions.ForEachChunk([&chunks](size_t count, Entity const *, Position const *column)
+        {
+            REQUIRE(count > 0);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(column) % Chunk::Alignment == 0);
+            ++chunks;
+        });
+        CHECK(chunks >= 3);
+
+        float total = 0.0f;
+        Query<Position const, Health const> healthy(world);
+        healthy.ForEach([&world, &total](Entity entity, Position const &position,
+            Health const &health)
+        {
+            REQUIRE(world.Get<Health>(entity).value_ == health.value_);
+            REQUIRE(position.y_ == float(health.value_));
+            total += position.x_;
+        });
+        CHECK(total == 5000.0f);
+
+        // Archetypes created after the first run are picked up too.
+        world.Create(Position{}, Velocity{}, Tracked("late"));
+        CHECK(movers.Count() == 10001);
+    }
+}
+
+TEST_CASE("Running the entity world as an engine system.", "[ECS]")
+{
+    using namespace Ludus;
+    Engine engine;
+    engine.AddOn<World>();
+    World &world = engine.Find<World>();
+    Entity const entity = world.Create(Position{}, Velocity{ 1.0f, 0.0f, 0.0f });
+
+    unsigned frames = 0;
+    world.AddSystem([](World &world, double dt)
+    {
+        UNREFERENCED(dt);
+        Query<Position, Velocity const>(world).ForEach(
+            [](Position &position, Velocity const &velocity)
+            {
+                position.x_ += velocity.x_;
+            });
+    });
+    world.AddSystem([&engine, &frames](World &, double)
+    {
+        if(++frames == 3)
+        {
+            engine.Stop();
+        }
+    });
+    engine.Run();
+    CHECK(frames == 3);
+    CHECK(world.Get<Position>(entity).x_ == 3.0f);
+}
+
+TEST_CASE("Running queries and systems in parallel.", "[ECS]")
+{
+    using namespace Ludus;
+    JobSystem jobs(4);
+    World world;
+    world.SetJobSystem(&jobs);
+    for(int i = 0; i < 100000; ++i)
+    {
+        Entity const entity = world.Create(Position{ 0.0f, 0.0f, 0.0f },
+            Velocity{ float(i % 7), 1.0f, 0.0f });
+        if(i % 3 == 0)
+        {
+            world.Add(entity, Health{ 100 });
+        }
+    }
+
+    SECTION("Every entity is visited exactly once.")
+    {
+        std::atomic<size_t> visited(0);
+        Query<Position, Velocity const> movers(world);
+        movers.ParallelForEach([&visited](Position &position, Velocity const &velocity)
+        {
+            position.x_ += velocity.x_;
+            position.y_ += velocity.y_;
+            visited.fetch_add(1, std::memory_order_relaxed);
+        });
+        CHECK(visited.load() == 100000);
+
+        bool correct = true;
+        Query<Position const, Velocity const>(world).ForEach(
+            [&correct](Position const &position, Velocity const &velocity)
+        {
+            correct = correct && position.x_ == velocity.x_ && position.y_ == 1.0f;
+        });
+        CHECK(correct);
+    }
+
+    SECTION("Conflicting systems are split into phases.")
+    {
+        std::atomic<int> order(0);
+        int moved = -1, healed = -1, drawn = -1;
+        world.AddSystem([&](World &world, double)
+        {
+            Query<Position, Velocity const>(world).ParallelForEach(
+                [](Position &position, Velocity const &velocity)
+            {
+                position.x_ += velocity.x_;
+            });
+            moved = order++;
+        }, Access::Of<Position, Velocity const>());
+        // Touches none of the components above, joins the first phase.
+        world.AddSystem([&](World &world, double)
+        {
+            Query<Health>(world).ParallelForEach([](Health &health)
+            {
+                health.value_ -= 1;
+            });
+            healed = order++;
+        }, Access::Of<Health>());
+        // Reads what the first system writes, has to wait for it.
+        world.AddSystem([&](World &world, double)
+        {
+            size_t far = 0;
+            Query<Position const>(world).ForEach([&far](Position const &position)
+            {
+                far += position.x_ > 3.0f;
+            });
+            // Every i with i % 7 of 4, 5 or 6.
+            CHECK(far == 42856);
+            drawn = order++;
+        }, Access::Of<Position const>());
+        CHECK(world.GetPhaseCount() == 2);
+
+        world.Update(0.016);
+        CHECK(drawn == 2);
+        CHECK(moved + healed == 1);
+        CHECK(world.Get<Health>(Entity{ 0, 0 }).value_ == 99);
+    }
+
+    SECTION("Queries outside of the declared access are refused.")
+    {
+        world.AddSystem([](World &world, double)
+        {
+            Query<Position, Velocity const>(world).ParallelForEach(
+                [](Position &, Velocity const &)
+            {
+            });
+        }, Access::Of<Position const, Velocity const>());
+        CHECK_THROWS_AS(world.Update(0.016), std::logic_error);
+        // Nothing is declared outside of a system.
+        CHECK_NOTHROW(Query<Position>(world).Count());
+        CHECK(Access::Of<Position>().ConflictsWith(Access::Of<Position const>()));
+        CHECK_FALSE(Access::Of<Position const>().ConflictsWith(
+            Access::Of<Position const, Health>()));
+    }
+
+    SECTION("Components got outside of the declared access are refused.")
+    {
+        float x = -1.0f;
+        world.AddSystem([&x](World &world, double)
+        {
+            x = world.Get<Position const>(Entity{ 0, 0 }).x_;
+            world.Get<Position>(Entity{ 0, 0 }).x_ = 5.0f;
+        }, Access::Of<Position const>());
+        CHECK_THROWS_AS(world.Update(0.016), std::logic_error);
+        CHECK(x == 0.0f);
+        CHECK(world.Get<Position const>(Entity{ 0, 0 }).x_ == 0.0f);
+    }
+
+    SECTION("Only exclusive systems change the shape of entities.")
+    {
+        world.AddSystem([](World &world, double)
+        {
+            world.Get<Health>(Entity{ 0, 0 }).value_ = 50;
+        }, Access::Of<Health>());
+        world.AddSystem([](World &world, double)
+        {
+            world.Create(Health{ 1 });
+            world.Remove<Health>(Entity{ 3, 0 });
+        }, Access::All());
+        world.AddSystem([](World &world, double)
+        {
+            world.Get<Position const>(Entity{ 0, 0 });
+        }, Access::Of<Position const>());
+        // The exclusive system splits the two that could have shared.
+        CHECK(world.GetPhaseCount() == 3);
+        world.Update(0.016);
+        CHECK(world.GetEntityCount() == 100001);
+        CHECK_FALSE(world.Has<Health>(Entity{ 3, 0 }));
+
+        world.AddSystem([](World &world, double)
+        {
+            world.Destroy(Entity{ 0, 0 });
+        }, Access::Of<Position, Velocity, Health>());
+        CHECK_THROWS_AS(world.Update(0.016), std::logic_error);
+        CHECK(world.IsAlive(Entity{ 0, 0 }));
+    }
+
+    SECTION("A failing system fails the update once its phase is done.")
+    {
+        std::atomic<int> healed(0);
+        world.AddSystem([](World &, double)
+        {
+            throw std::runtime_error("The system failed.");
+        }, Access::Of<Position>());
+        world.AddSystem([&healed](World &world, double)
+        {
+            Query<Health>(world).ForEach([](Health &health) { health.value_ -= 1; });
+            ++healed;
+        }, Access::Of<Health>());
+        world.AddSystem([](World &, double)
+        {
+            throw std::runtime_error("The system failed too.");
+        }, Access::Of<Velocity>());
+        REQUIRE(world.GetPhaseCount() == 1);
+        for(int run = 0; run < 20; ++run)
+        {
+            CHECK_THROWS_AS(world.Update(0.016), std::runtime_error);
+        }
+        CHECK(healed == 20);
+        CHECK(world.Get<Health const>(Entity{ 0, 0 }).value_ == 80);
+    }
+}
+
+TEST_CASE("Filtering queries by changed and added components.", "[ECS]")
+{
+    using namespace Ludus;
+    World world;
+    std::vector<Entity> entities;
+    for(int i = 0; i < 5000; ++i)
+    {
+        entities.push_back(world.Create(Position{}, Velocity{ 1.0f, 0.0f, 0.0f }));
+    }
+    size_t const chunkCount = world.GetArchetype(0).GetChunkCount();
+    REQUIRE(chunkCount > 2);
+
+    auto countChunks = [](auto &query)
+    {
+        size_t chunks = 0;
+        query.ForEachChunk([&chunks](size_t, Entity const *, auto *...)
+        {
+            ++chunks;
+        });
+        return chunks;
+    };
+
+    SECTION("Only chunks written since the last run are visited.")
+    {
+        Query<Changed<Position const> > moved(world);
+        CHECK(countChunks(moved) == chunkCount);
+        CHECK(countChunks(moved) == 0);
+
+        world.Get<Position>(entities[4999]).x_ = 1.0f;
+        size_t visited = 0;
+        moved.ForEach([&visited](Entity entity, Position const &position)
+        {
+            UNREFERENCED(entity);
+            visited += position.x_ == 1.0f;
+        });
+        CHECK(visited == 1);
+        CHECK(countChunks(moved) == 0);
+
+        // Reading doesn't count as a change, writing does.
+        Query<Position const, Velocity const> reader(world);
+        reader.ForEach([](Position const &, Velocity const &) {});
+        CHECK(countChunks(moved) == 0);
+        Query<Position, Velocity const> mover(world);
+        mover.ForEach([](Position &position, Velocity const &velocity)
+        {
+            position.x_ += velocity.x_;
+        });
+        CHECK(countChunks(moved) == chunkCount);
+        // A query doesn't see its own writes on the next run.
+        Query<Changed<Position>, Velocity const> self(world);
+        CHECK(countChunks(self) == chunkCount);
+        CHECK(countChunks(self) == 0);
+    }
+
+    SECTION("Only chunks where entities gained a component are visited.")
+    {
+        Query<Position const, Added<Health const> > healed(world);
+        CHECK(countChunks(healed) == 0);
+        world.Add(entities[10], Health{ 10 });
+        world.Add(entities[20], Health{ 20 });
+        size_t visited = 0;
+        healed.ForEach([&visited](Position const &, Health const &)
+        {
+            ++visited;
+        });
+        CHECK(visited == 2);
+        CHECK(countChunks(healed) == 0);
+
+        // Moving into a chunk keeps the versions of the entity.
+        Query<Changed<Health const> > changed(world);
+        CHECK(countChunks(changed) == 1);
+        world.Get<Health>(entities[20]).value_ = 21;
+        world.Destroy(entities[10]);
+        CHECK(countChunks(changed) == 1);
+        CHECK(world.Get<Health>(entities[20]).value_ == 21);
+    }
+}
+
+TEST_CASE("Benchmarking the entity storage against nodes.", "[ECS][!benchmark]")
+{
+    using namespace Ludus;
+    constexpr size_t Count = 500000;
+
+    // The old way: one heap allocated object per entity, updated through
+    // a virtual call.
+    class Mover : public Node
+    {
+    public:
+        void Update(double const &dt) override
+        {
+            position_.x_ += velocity_.x_ * float(dt);
+            position_.y_ += velocity_.y_ * float(dt);
+            position_.z_ += velocity_.z_ * float(dt);
+        }
+        Position position_ = {};
+        Velocity velocity_ = { 1.0f, 2.0f, 3.0f };
+    };
+    Node root;
+    for(size_t i = 0; i < Count; ++i)
+    {
+        root.AddChild(std::make_shared<Mover>());
+    }
+
+    World world;
+    for(size_t i = 0; i < Count; ++i)
+    {
+        world.Create(Position{}, Velocity{ 1.0f, 2.0f, 3.0f });
+    }
+    Query<Position, Velocity const> movers(world);
+
+    BENCHMARK("Nodes with virtual updates")
+    {
+        for(unsigned i = 0; i < Count; ++i)
+        {
+            root.At(i).Update(0.016);
+        }
+        return root.Size();
+    };
+    BENCHMARK("Entities through a query")
+    {
+        movers.ForEach([](Position &position, Velocity const &velocity)
+        {
+            position.x_ += velocity.x_ * 0.016f;
+            position.y_ += velocity.y_ * 0.016f;
+            position.z_ += velocity.z_ * 0.016f;
+        });
+        return world.GetEntityCount();
+    };
+    JobSystem jobs;
+    world.SetJobSystem(&jobs);
+    BENCHMARK("Entities through a parallel query")
+    {
+        movers.ParallelForEach([](Position &position, Velocity const &velocity)
+        {
+            position.x_ += velocity.x_ * 0.016f;
+            position.y_ += velocity.y_ * 0.016f;
+            position.z_ += velocity.z_ * 0.016f;
+        });
+        return world.GetEntityCount();
+    };
+}
+
+/*  ======================================================================== */
+/*  REFLECTION                                                               */
+/*  ======================================================================== */
+#include <Ludus/System/Reflection.hpp>
+
+namespace
+{
+    class Player : public Ludus::Node
+    {
+    public:
+        Player() : Node("Player"), health_(100), speed_(2.5f), alive_(true) {}
+        int GetHealth() const { return health_; }
+    private:
+        std::int32_t health_;
+        float speed_;
+        bool alive_;
+
+        LUDUS_REFLECT(Player, LUDUS_BASE(Ludus::Node), LUDUS_FIELD(health_),
+            LUDUS_FIELD(speed_), LUDUS_FIELD(alive_))
+    };
+
+    // Everything is known while compiling.
+    static_assert(Ludus::GetFieldCount<Player>() == 5, "Every field is listed.");
+    static_assert(Ludus::FindField<Player>("speed_") == 3, "Fields keep their order.");
+    static_assert(Ludus::FindField<Player>("missing_") == 5, "Unknown fields aren't found.");
+    static_assert(std::get<2>(Ludus::GetFields<Player>()).type_.kind_ ==
+        Ludus::FieldKind::SIGNED, "The kind follows the type.");
+    static_assert(!Ludus::IsReflected<int>::value, "Plain types aren't reflected.");
+}
+
+TEST_CASE("Reflecting the fields of objects.", "[Reflection]")
+{
+    using namespace Ludus;
+    Player player;
+    player.GetTransform().SetPosition(Math::Vec3(1.0f, 2.0f, 3.0f));
+
+    SECTION("Fields describe their name, type and place in the object.")
+    {
+        std::vector<std::string> names;
+        std::vector<std::string> types;
+        ForEachField<Player>([&](auto const &field)
+        {
+            names.push_back(field.name_);
+            types.push_back(field.type_.name_);
+            auto const &value = field.Get(player);
+            CHECK(field.GetOffset() == size_t(reinterpret_cast<char const *>(&value) -
+                reinterpret_cast<char const *>(static_cast<
+                typename std::decay_t<decltype(field)>::Owner const *>(&player))));
+        });
+        CHECK(names == std::vector<std::string>{ "name_", "transform_", "health_",
+            "speed_", "alive_" });
+        CHECK(types == std::vector<std::string>{ "string", "Transform", "int32",
+            "float", "bool" });
+        CHECK(std::string(GetTypeName<Player>()) == "Player");
+        CHECK(std::string(GetTypeName<Math::Quat>()) == "Quat");
+    }
+
+    SECTION("Objects can be walked and written field by field.")
+    {
+        std::string text;
+        std::function<void(std::string const &, float)> print =
+            [&text](std::string const &name, float value)
+        {
+            text += name + "=" + std::to_string(int(value)) + " ";
+        };
+        VisitFields(player.GetTransform(), [&](auto const &field, auto &value)
+        {
+            VisitFields(value, [&](auto const &inner, auto &component)
+            {
+                print(std::string(field.name_) + "." + inner.name_, component);
+            });
+        });
+        CHECK(text == "position_.x_=1 position_.y_=2 position_.z_=3 "
+            "rotation_.x_=0 rotation_.y_=0 rotation_.z_=0 rotation_.w_=1 "
+            "scale_.x_=1 scale_.y_=1 scale_.z_=1 ");
+
+        VisitFields(player, [](auto const &field, auto &value)
+        {
+            if constexpr(std::is_same<std::decay_t<decltype(value)>, std::int32_t>::value)
+            {
+                CHECK(std::string(field.name_) == "health_");
+                value = 42;
+            }
+        });
+        CHECK(player.GetHealth() == 42);
+    }
+}
+
+/*  ======================================================================== */
+/*  SCENES                                                                   */
+/*  ======================================================================== */
+#include <Ludus/System/Scene.hpp>
+
+TEST_CASE("Saving and loading scenes.", "[Scene]")
+{
+    using namespace Ludus;
+    using namespace Ludus::Math;
+
+    Node root("Level");
+    std::shared_ptr<Node> props = std::make_shared<Node>("Props");
+    std::shared_ptr<Node> lamp = std::make_shared<Node>("Lamp");
+    root.AddChild(props);
+    root.AddChild(std::make_shared<Node>("Player"));
+    props->AddChild(std::make_shared<Node>("Crate"));
+    props->AddChild(std::make_shared<Node>("Crate"));
+    props->AddChild(lamp);
+    root.GetTransform().SetPosition(Vec3(1.0f, 0.0f, 0.0f));
+    props->GetTransform().SetScale(Vec3(2.0f, 2.0f, 2.0f));
+    lamp->GetTransform().SetPosition(Vec3(0.0f, 3.0f, 0.0f));
+    lamp->GetTransform().SetRotation(
+        Quat::FromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), 0.5f));
+
+    SECTION("The hierarchy, names and transforms come back.")
+    {
+        std::vector<std::uint8_t> const bytes = Scene::Serialize(root);
+        std::shared_ptr<Node> loaded = Scene::Deserialize(bytes.data(), bytes.size());
+        REQUIRE(loaded->GetName() == "Level");
+        REQUIRE(loaded->Size() == 2);
+        Node &copy = loaded->Find("Props");
+        REQUIRE(copy.Size() == 3);
+        CHECK(copy[0].GetName() == "Crate");
+        CHECK(copy[1].GetName() == "Crate");
+        CHECK(&copy.GetParent() == loaded.get());
+        CHECK((*loaded)[1].GetName() == "Player");
+        CHECK((*loaded)[1].Size() == 0);
+
+        Transform const &light = copy.Find("Lamp").GetTransform();
+        CHECK(light.GetPosition().y_ == 3.0f);
+        CHECK(light.GetRotation().z_ == lamp->GetTransform().GetRotation().z_);
+        CHECK(light.GetRotation().w_ == lamp->GetTransform().GetRotation().w_);
+        CHECK(copy.GetTransform().GetScale().x_ == 2.0f);
+
+        // Loaded nodes are dirty, so their world matrices get built.
+        CHECK(loaded->GetTransform().IsDirty());
+        CHECK(copy.Find("Lamp").GetTransform().IsDirty());
+        TransformHierarchy hierarchy;
+        hierarchy.Update(root);
+        hierarchy.Update(*loaded);
+        CHECK(NearlyEqual(light.GetWorldMatrix(),
+            lamp->GetTransform().GetWorldMatrix()));
+    }
+
+    SECTION("Scenes go through files and broken ones are refused.")
+    {
+        std::string const path = (std::filesystem::temp_directory_path() /
+            "Ludus-Scene.ldsn").string();
+        Scene::Save(root, path);
+        CHECK(Scene::Load(path)->Find("Props").Find("Lamp").GetName() == "Lamp");
+        std::remove(path.c_str());
+        CHECK_THROWS_AS(Scene::Load(path), std::runtime_error);
+
+        std::vector<std::uint8_t> bytes = Scene::Serialize(root);
+        std::vector<std::uint8_t> const truncated(bytes.begin(), bytes.end() - 1);
+        CHECK_THROWS_AS(Scene::Deserialize(truncated.data(), truncated.size()),
+            std::runtime_error);
+        bytes[0] = 'X';
+        CHECK_THROWS_AS(Scene::Deserialize(bytes.data(), bytes.size()),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE("Viewing scenes in place.", "[Scene]")
+{
+    using namespace Ludus;
+    using namespace Ludus::Math;
+
+    Node root("World");
+    for(int region = 0; region < 3; ++region)
+    {
+        std::shared_ptr<Node> parent = std::make_shared<Node>(
+            "Region " + std::to_string(region));
+        for(int prop = 0; prop < 4; ++prop)
+        {
+            std::shared_ptr<Node> child = std::make_shared<Node>(
+                "Prop " + std::to_string(prop));
+            child->GetTransform().SetPosition(Vec3(float(region), float(prop), 0.0f));
+            parent->AddChild(child);
+        }
+        root.AddChild(parent);
+    }
+    root.At(1).GetTransform().SetScale(Vec3(3.0f, 3.0f, 3.0f));
+    root.At(2).GetTransform().SetRotation(
+        Quat::FromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), 0.25f));
+
+    std::string const path = (std::filesystem::temp_directory_path() /
+        "Ludus-View.ldsn").string();
+    Scene::Save(root, path);
+    {
+        SceneView const scene(path);
+        CHECK(scene.GetNodeCount() == 16);
+        NodeView const world = scene.GetRoot();
+        CHECK(world.GetName() == "World");
+        CHECK_FALSE(world.HasParent());
+        CHECK_THROWS_AS(world.GetParent(), NodeNotFound);
+        REQUIRE(world.Size() == 3);
+
+        NodeView const region = world.Find("Region 2");
+        NodeView const prop = region.At(3);
+        CHECK(prop.GetName() == "Prop 3");
+        CHECK(prop.GetPosition().x_ == 2.0f);
+        CHECK(prop.GetPosition().y_ == 3.0f);
+        CHECK(prop.GetParent().GetIndex() == region.GetIndex());
+        CHECK(region.GetRotation().y_ == root.At(2).GetTransform().GetRotation().y_);
+        CHECK(world.At(1).GetScale().z_ == 3.0f);
+        CHECK(world.GetScale().x_ == 1.0f);
+        CHECK_THROWS_AS(region.At(4), NodeNotFound);
+        CHECK_THROWS_AS(world.Find("Region 3"), NodeNotFound);
+        CHECK_THROWS_AS(scene.GetNode(16), std::out_of_range);
+
+        // Children are next to each other, so a view reads them in order.
+        for(size_t i = 0; i < 3; ++i)
+        {
+            CHECK(world.At(i).GetIndex() == i + 1);
+        }
+
+        // The same bytes still build real nodes.
+        std::shared_ptr<Node> loaded = Scene::Instantiate(scene);
+        CHECK(loaded->Find("Region 0").Find("Prop 2").GetTransform().GetPosition().y_ == 2.0f);
+    }
+    std::remove(path.c_str());
+
+    // Views check the nodes they visit.
+    std::vector<std::uint8_t> bytes = Scene::Serialize(root);
+    SceneView const scene(bytes.data(), bytes.size());
+    CHECK(scene.GetRoot().At(0).At(0).GetName() == "Prop 0");
+    CHECK_THROWS_AS(SceneView(bytes.data() + 4, bytes.size() - 4), std::runtime_error);
+}
+
+TEST_CASE("Benchmarking loading a scene of a million nodes.", "[Scene][!benchmark]")
+{
+    using namespace Ludus;
+    constexpr size_t Groups = 1000;
+    constexpr size_t PerGroup = 999;
+
+    // One allocation per node, the way levels were built by hand.
+    auto const build = []()
+    {
+        std::shared_ptr<Node> root = std::make_shared<Node>("Level");
+        for(size_t group = 0; group < Groups; ++group)
+        {
+            std::shared_ptr<Node> parent = std::make_shared<Node>("Group");
+            for(size_t node = 0; node < PerGroup; ++node)
+            {
+                parent->AddChild(std::make_shared<Node>("Prop"));
+            }
+            root->AddChild(parent);
+        }
+        return root;
+    };
+    std::vector<std::uint8_t> const bytes = Scene::Serialize(*build());
+    REQUIRE(Scene::Deserialize(bytes.data(), bytes.size())->Size() == Groups);
+
+    BENCHMARK("Building with make_shared and AddChild")
+    {
+        return build()->Size();
+    };
+    BENCHMARK("Loading the scene")
+    {
+        return Scene::Deserialize(bytes.data(), bytes.size())->Size();
+    };
+
+    // Only the pages of the nodes visited are read.
+    std::string const path = (std::filesystem::temp_directory_path() /
+        "Ludus-Million.ldsn").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<char const *>(bytes.data()), bytes.size());
+    }
+    BENCHMARK("Mapping the scene and reading one node")
+    {
+        SceneView const scene(path);
+        return scene.GetRoot().At(Groups / 2).At(PerGroup / 2).GetPosition().x_;
+    };
+    std::remove(path.c_str());
+}
+
+/*  ======================================================================== */
+/*  ASSETS                                                                   */
+/*  ======================================================================== */
+#include <Ludus/Assets/AssetManager.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    /** Writes a temporary file for the asset tests. */
+    std::string WriteAsset(std::string const &name, std::string const &contents)
+    {
+        std::string const path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream file(path, std::ios::binary);
+        file << contents;
+        return path;
+    }
+
+    /** Keeps the I/O thread busy until it's let go. */
+    std::atomic<bool> gateOpen(false);
+
+    struct GatedAsset
+    {
+        explicit GatedAsset(std::vector<std::uint8_t> &&bytes)
+        {
+            UNREFERENCED(bytes);
+            while(!gateOpen.load())
+            {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    /** Delivers the finished callbacks until nothing is pending. */
+    void DrainAssets(Ludus::AssetManager &assets)
+    {
+        while(assets.GetPendingCount() != 0)
+        {
+            assets.BeginFrame();
+            std::this_thread::yield();
+        }
+    }
+}
+
+TEST_CASE("Streaming assets.", "[Assets]")
+{
+    using namespace Ludus;
+    std::string const path = WriteAsset("Ludus-Asset.txt", "Hello, assets!");
+    AssetManager assets(2);
+
+    SECTION("Duplicate loads share a single asset.")
+    {
+        AssetHandle<std::string> first = assets.Load<std::string>(path);
+        AssetHandle<std::string> second = assets.Load<std::string>(path, AssetPriority::HIGH);
+        DrainAssets(assets);
+        REQUIRE(first.IsReady());
+        CHECK(first.Get() == "Hello, assets!");
+        CHECK(&first.Get() == &second.Get());
+        CHECK(first.GetPath() == path);
+    }
+
+    SECTION("Callbacks only run on the main thread, at the start of a frame.")
+    {
+        std::thread::id const main = std::this_thread::get_id();
+        unsigned calls = 0;
+        AssetHandle<std::string> handle = assets.Load<std::string>(path,
+            AssetPriority::NORMAL, [&](AssetHandle<std::string> const &asset)
+            {
+                CHECK(std::this_thread::get_id() == main);
+                CHECK(asset.Get() == "Hello, assets!");
+                ++calls;
+            });
+        while(!handle.IsReady())
+        {
+            std::this_thread::yield();
+        }
+        CHECK(calls == 0);
+        DrainAssets(assets);
+        CHECK(calls == 1);
+
+        // Asking for a loaded asset still calls back on the next frame.
+        assets.Load<std::string>(path, AssetPriority::NORMAL,
+            [&](AssetHandle<std::string> const &) { ++calls; });
+        CHECK(calls == 1);
+        assets.BeginFrame();
+        CHECK(calls == 2);
+        CHECK(assets.GetPendingCount() == 0);
+    }
+
+    SECTION("Missing files fail with an error.")
+    {
+        bool failed = false;
+        AssetHandle<std::string> handle = assets.Load<std::string>(
+            path + ".missing", AssetPriority::NORMAL,
+            [&](AssetHandle<std::string> const &asset)
+            {
+                failed = asset.GetState() == AssetState::FAILED;
+            });
+        DrainAssets(assets);
+        CHECK(failed);
+        CHECK_FALSE(handle.GetError().empty());
+        CHECK_THROWS_AS(handle.Get(), std::runtime_error);
+    }
+
+    SECTION("Assets are freed with their last handle.")
+    {
+        {
+            AssetHandle<std::string> handle = assets.Load<std::string>(path);
+            DrainAssets(assets);
+            REQUIRE(handle.IsReady());
+            WriteAsset("Ludus-Asset.txt", "Reloaded");
+            // Still cached while somebody holds it.
+            CHECK(assets.Load<std::string>(path).Get() == "Hello, assets!");
+        }
+        AssetHandle<std::string> handle = assets.Load<std::string>(path);
+        DrainAssets(assets);
+        CHECK(handle.Get() == "Reloaded");
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Loading assets by priority.", "[Assets]")
+{
+    using namespace Ludus;
+    std::string const path = WriteAsset("Ludus-Priority.txt", "Priority");
+    AssetManager assets(1);
+    std::vector<std::string> order;
+    auto const record = [&order](std::string const &name)
+    {
+        return [&order, name](AssetHandle<std::string> const &) { order.push_back(name); };
+    };
+
+    // Hold the only I/O thread while the rest gets queued.
+    gateOpen = false;
+    AssetHandle<GatedAsset> gate = assets.Load<GatedAsset>(path);
+    while(gate.GetState() != AssetState::LOADING)
+    {
+        std::this_thread::yield();
+    }
+    // Different files so nothing gets coalesced.
+    std::vector<std::string> paths;
+    for(char const *name : { "Low", "Normal", "Critical" })
+    {
+        paths.push_back(WriteAsset(std::string("Ludus-") + name + ".txt", name));
+    }
+    assets.Load<std::string>(paths[0], AssetPriority::LOW, record("Low"));
+    assets.Load<std::string>(paths[1], AssetPriority::NORMAL, record("Normal"));
+    assets.Load<std::string>(paths[2], AssetPriority::CRITICAL, record("Critical"));
+    // Asking again for the low one moves it ahead of the normal one.
+    assets.Load<std::string>(paths[0], AssetPriority::HIGH);
+    gateOpen = true;
+    DrainAssets(assets);
+
+    CHECK(gate.IsReady());
+    CHECK(order == std::vector<std::string>{ "Critical", "Low", "Normal" });
+    for(std::string const &file : paths)
+    {
+        std::remove(file.c_str());
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Streaming assets while the engine runs.", "[Assets]")
+{
+    using namespace Ludus;
+    std::string const path = WriteAsset("Ludus-Engine.txt", "Level");
+    Engine engine;
+    engine.AddOn<AssetManager>();
+    std::string loaded;
+    engine.Find<AssetManager>().Load<std::string>(path, AssetPriority::NORMAL,
+        [&](AssetHandle<std::string> const &asset)
+        {
+            loaded = asset.Get();
+            engine.Stop();
+        });
+    engine.Run();
+    CHECK(loaded == "Level");
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Streaming loose files through either file backend.", "[Assets]")
+{
+    using namespace Ludus;
+    std::vector<std::string> paths;
+    for(int i = 0; i < 40; ++i)
+    {
+        paths.push_back(WriteAsset("Ludus-Batch-" + std::to_string(i) + ".txt",
+            std::string(100 + i, static_cast<char>('a' + i % 26))));
+    }
+
+    for(FileBackend backend : { FileBackend::PREAD, FileBackend::IO_URING })
+    {
+        AssetManager assets(2, backend);
+        CHECK(assets.GetFileBackend() ==
+            (FileReader::IsSupported(backend) ? backend : FileBackend::PREAD));
+        std::vector<AssetHandle<std::string> > handles;
+        for(std::string const &path : paths)
+        {
+            handles.push_back(assets.Load<std::string>(path, AssetPriority::LOW));
+        }
+        AssetHandle<std::string> const missing = assets.Load<std::string>(
+            paths.front() + ".missing");
+        DrainAssets(assets);
+        for(int i = 0; i < 40; ++i)
+        {
+            REQUIRE(handles[i].IsReady());
+            CHECK(handles[i].Get() == std::string(100 + i, static_cast<char>('a' + i % 26)));
+        }
+        CHECK(missing.GetState() == AssetState::FAILED);
+    }
+    for(std::string const &path : paths)
+    {
+        std::remove(path.c_str());
+    }
+}
+
+#include <Ludus/Assets/Compression.hpp>
+#include <Ludus/Assets/Pack.hpp>
+#include <random>
+
+TEST_CASE("Compressing blocks.", "[Assets]")
+{
+    using namespace Ludus;
+    std::mt19937 random(7);
+    std::vector<std::uint8_t> noise(Compression::MaxBlockSize);
+    for(std::uint8_t &byte : noise)
+    {
+        byte = static_cast<std::uint8_t>(random());
+    }
+    std::string text;
+    while(text.size() < 40000)
+    {
+        text += "The quick brown fox jumps over the lazy dog " + std::to_string(text.size() % 97);
+    }
+    std::vector<std::uint8_t> const repeated(text.begin(), text.end());
+    std::vector<std::uint8_t> const run(5000, 0x2A);
+
+    std::vector<std::uint8_t> const *const blocks[] = { &noise, &repeated, &run };
+    for(std::vector<std::uint8_t> const *block : blocks)
+    {
+        std::vector<std::uint8_t> const packed = Compression::Compress(block->data(), block->size());
+        CHECK(packed.size() <= Compression::GetMaxCompressedSize(block->size()));
+        std::vector<std::uint8_t> unpacked(block->size());
+        Compression::Decompress(packed.data(), packed.size(), unpacked.data(), unpacked.size());
+        CHECK(unpacked == *block);
+    }
+    CHECK(Compression::Compress(repeated.data(), repeated.size()).size() < repeated.size() / 4);
+    CHECK(Compression::Compress(run.data(), run.size()).size() < 64);
+    CHECK(Compression::Checksum(reinterpret_cast<std::uint8_t const *>("123456789"), 9) == 0xCBF43926u);
+
+    // Broken blocks are caught instead of read out of bounds.
+    std::vector<std::uint8_t> packed = Compression::Compress(repeated.data(), repeated.size());
+    std::vector<std::uint8_t> unpacked(repeated.size());
+    CHECK_THROWS_AS(Compression::Decompress(packed.data(), packed.size() / 2,
+        unpacked.data(), unpacked.size()), std::runtime_error);
+    CHECK_THROWS_AS(Compression::Decompress(packed.data(), packed.size(),
+        unpacked.data(), unpacked.size() - 1), std::runtime_error);
+    CHECK_THROWS_AS(Compression::Compress(noise.data(), noise.size() + 1), std::length_error);
+}
+
+TEST_CASE("Packing assets.", "[Assets]")
+{
+    using namespace Ludus;
+    PackWriter writer;
+    std::vector<std::vector<std::uint8_t> > files;
+    // Thousands of small files share blocks, a few big ones span many.
+    for(size_t i = 0; i < 3000; ++i)
+    {
+        std::string const text = "Sprite " + std::to_string(i) + std::string(i % 200, 'x');
+        files.emplace_back(text.begin(), text.end());
+    }
+    std::mt19937 random(11);
+    for(size_t size : { size_t(0), size_t(200000), size_t(65536) })
+    {
+        std::vector<std::uint8_t> big(size);
+        for(std::uint8_t &byte : big)
+        {
+            byte = static_cast<std::uint8_t>(random() % 16);
+        }
+        files.push_back(std::move(big));
+    }
+    for(size_t i = 0; i < files.size(); ++i)
+    {
+        writer.Add("Assets/" + std::to_string(i) + ".bin", files[i].data(), files[i].size());
+    }
+    CHECK_THROWS_AS(writer.Add("Assets/0.bin", nullptr, 0), std::invalid_argument);
+
+    JobSystem jobs(3);
+    std::vector<std::uint8_t> bytes = writer.Serialize(&jobs);
+    PackReader const pack(bytes.data(), bytes.size());
+    REQUIRE(pack.GetFileCount() == files.size());
+    CHECK(pack.GetBlockCount() > 4);
+    CHECK_FALSE(pack.Contains("Assets/Missing.bin"));
+    CHECK_THROWS_AS(pack.Read("Assets/Missing.bin"), std::out_of_range);
+
+    bool same = true;
+    for(size_t i = 0; i < files.size(); ++i)
+    {
+        std::string const path = "Assets/" + std::to_string(i) + ".bin";
+        same = same && pack.GetFileSize(path) == files[i].size() &&
+            pack.Read(path, i % 2 ? &jobs : nullptr) == files[i];
+    }
+    CHECK(same);
+
+    SECTION("Corrupt blocks are caught by their checksum.")
+    {
+        bytes[bytes.size() - 10] ^= 0x40;
+        PackReader const broken(bytes.data(), bytes.size());
+        std::string const last = "Assets/" + std::to_string(files.size() - 1) + ".bin";
+        CHECK_THROWS_AS(broken.Read(last, &jobs), std::runtime_error);
+        // Files in other blocks still read fine.
+        CHECK(broken.Read("Assets/0.bin") == files[0]);
+    }
+
+    SECTION("Mounted packs serve assets before loose files.")
+    {
+        std::string const path = (std::filesystem::temp_directory_path() /
+            "Ludus-Assets.ldpk").string();
+        writer.Save(path);
+        AssetManager assets(1);
+        assets.Mount(std::make_shared<PackReader const>(path));
+        AssetHandle<std::string> packed = assets.Load<std::string>("Assets/3.bin");
+        AssetHandle<std::string> missing = assets.Load<std::string>("Assets/Missing.bin");
+        DrainAssets(assets);
+        CHECK(packed.Get() == "Sprite 3xxx");
+        CHECK(missing.GetState() == AssetState::FAILED);
+        std::remove(path.c_str());
+    }
+}
+
+#include <Ludus/Assets/FileReader.hpp>
+
+namespace
+{
+    /** Writes many small files for the reader tests, returning their paths. */
+    std::vector<std::string> WriteSmallAssets(size_t count)
+    {
+        std::filesystem::path const directory =
+            std::filesystem::temp_directory_path() / "Ludus-Reads";
+        std::filesystem::create_directories(directory);
+        std::vector<std::string> paths;
+        for(size_t i = 0; i < count; ++i)
+        {
+            std::string const path = (directory / (std::to_string(i) + ".bin")).string();
+            std::ofstream file(path, std::ios::binary);
+            file << std::string(1024 + i % 3072, static_cast<char>('a' + i % 26));
+            paths.push_back(path);
+        }
+        return paths;
+    }
+}
+
+TEST_CASE("Reading files in batches.", "[Assets]")
+{
+    using namespace Ludus;
+    std::vector<std::string> paths = WriteSmallAssets(300);
+    paths.push_back(paths.front() + ".missing");
+    JobSystem jobs(2);
+
+    for(FileBackend backend : { FileBackend::PREAD, FileBackend::IO_URING })
+    {
+        if(!FileReader::IsSupported(backend))
+        {
+            continue;
+        }
+        FileReader reader(jobs, backend);
+        REQUIRE(reader.GetBackend() == backend);
+        std::atomic<size_t> good(0);
+        std::atomic<size_t> failed(0);
+        JobCounter counter;
+        reader.Read(paths, [&](FileRead &read)
+            {
+                if(!read.error_.empty())
+                {
+                    ++failed;
+                    return;
+                }
+                size_t const i = std::stoul(std::filesystem::path(read.path_).stem().string());
+                bool const same = read.bytes_.size() == 1024 + i % 3072 &&
+                    read.bytes_.back() == 'a' + i % 26;
+                good += same;
+            }, &counter);
+        jobs.Wait(counter);
+        CHECK(good == paths.size() - 1);
+        CHECK(failed == 1);
+    }
+    std::filesystem::remove_all(std::filesystem::path(paths.front()).parent_path());
+}
+
+TEST_CASE("Benchmarking reading thousands of small assets.", "[Assets][!benchmark]")
+{
+    using namespace Ludus;
+    std::vector<std::string> const paths = WriteSmallAssets(4000);
+    JobSystem jobs;
+    auto const readAll = [&](FileReader &reader)
+    {
+        std::atomic<size_t> bytes(0);
+        JobCounter counter;
+        reader.Read(paths, [&bytes](FileRead &read) { bytes += read.bytes_.size(); },
+            &counter);
+        jobs.Wait(counter);
+        return bytes.load();
+    };
+
+    FileReader pread(jobs, FileBackend::PREAD);
+    BENCHMARK("Reading with a pread thread pool")
+    {
+        return readAll(pread);
+    };
+    if(FileReader::IsSupported(FileBackend::IO_URING))
+    {
+        FileReader ring(jobs, FileBackend::IO_URING);
+        BENCHMARK("Reading with io_uring batches")
+        {
+            return readAll(ring);
+        };
+    }
+    std::filesystem::remove_all(std::filesystem::path(paths.front()).parent_path());
+}
+
+TEST_CASE("Hot reloading assets.", "[Assets]")
+{
+    using namespace Ludus;
+    using Clock = std::chrono::steady_clock;
+    std::string const path = WriteAsset("Ludus-Reload.txt", "Before");
+    AssetManager assets(1);
+    assets.SetHotReload(true);
+    AssetHandle<std::string> handle = assets.Load<std::string>(path);
+    DrainAssets(assets);
+    REQUIRE(handle.Get() == "Before");
+    std::shared_ptr<std::string const> const before = handle.GetShared();
+
+    WriteAsset("Ludus-Reload.txt", "After");
+    Clock::time_point const deadline = Clock::now() + std::chrono::seconds(5);
+    while(assets.GetPendingCount() == 0 && Clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // The reload runs in the background, only a frame swaps it in.
+    CHECK(handle.Get() == "Before");
+    while(handle.GetVersion() == 0 && Clock::now() < deadline)
+    {
+        assets.BeginFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    CHECK(handle.GetVersion() == 1);
+    CHECK(handle.Get() == "After");
+    // Whoever kept the old one still has it.
+    CHECK(*before == "Before");
+    assets.SetHotReload(false);
+    std::remove(path.c_str());
+}
+
+/*  ======================================================================== */
+/*  EVENTS                                                                   */
+/*  ======================================================================== */
+#include <Ludus/System/EventBus.hpp>
+
+namespace
+{
+    struct Damage
+    {
+        unsigned target_;
+        int amount_;
+    };
+
+    struct Spawned
+    {
+        std::string name_;
+    };
+}
+
+TEST_CASE("Sending events between systems.", "[Events]")
+{
+    using namespace Ludus;
+    EventBus bus;
+    std::vector<unsigned> batches;
+    int total = 0;
+    bus.Subscribe<Damage>([&](Damage const *events, size_t count)
+        {
+            batches.push_back(static_cast<unsigned>(count));
+            for(size_t i = 0; i < count; ++i)
+            {
+                total += events[i].amount_;
+            }
+        });
+    std::vector<std::string> names;
+    bus.Subscribe<Spawned>([&](Spawned const *events, size_t count)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                names.push_back(events[i].name_);
+                // Published while delivering, so it waits for the next drain.
+                bus.Publish(Damage{ 0, 1 });
+            }
+        });
+    CHECK(EventBus::GetEventId<Damage>() != EventBus::GetEventId<Spawned>());
+
+    SECTION("Events wait for a drain and come in order, one batch per type.")
+    {
+        bus.Publish(Damage{ 1, 10 });
+        bus.Publish(Spawned{ "Goblin" });
+        bus.Publish(Damage{ 2, 5 });
+        bus.Publish(Spawned{ "Orc" });
+        CHECK(total == 0);
+        CHECK(bus.Dispatch() == 4);
+        CHECK(batches == std::vector<unsigned>{ 2 });
+        CHECK(total == 15);
+        CHECK(names == std::vector<std::string>{ "Goblin", "Orc" });
+        CHECK(bus.Dispatch() == 2);
+        CHECK(total == 17);
+        CHECK(bus.Dispatch() == 0);
+    }
+
+    SECTION("Any thread can publish.")
+    {
+        JobSystem jobs(3);
+        jobs.ParallelFor(20000, 100, [&bus](size_t begin, size_t end)
+            {
+                for(size_t i = begin; i < end; ++i)
+                {
+                    bus.Publish(Damage{ static_cast<unsigned>(i), 1 });
+                }
+            });
+        CHECK(bus.Dispatch() == 20000);
+        CHECK(batches == std::vector<unsigned>{ 20000 });
+        CHECK(total == 20000);
+    }
+
+    SECTION("Drained entries are published into again.")
+    {
+        EventChannel<Damage> channel;
+        for(int round = 0; round < 10; ++round)
+        {
+            for(unsigned i = 0; i < 100; ++i)
+            {
+                channel.Publish(Damage{ i, 1 });
+            }
+            CHECK(channel.Dispatch() == 100);
+        }
+        CHECK(channel.GetEntryCount() == 100);
+
+        // Threads take the free entries in bulk, most rounds allocate nothing.
+        JobSystem jobs(3);
+        for(int round = 0; round < 10; ++round)
+        {
+            jobs.ParallelFor(4000, 100, [&channel](size_t begin, size_t end)
+                {
+                    for(size_t i = begin; i < end; ++i)
+                    {
+                        channel.Publish(Damage{ static_cast<unsigned>(i), 1 });
+                    }
+                });
+            CHECK(channel.Dispatch() == 4000);
+        }
+        CHECK(channel.GetEntryCount() < 20000);
+    }
+
+    SECTION("Handlers subscribed while dispatching start next drain.")
+    {
+        EventChannel<Damage> channel;
+        std::vector<int> calls;
+        channel.Subscribe([&](Damage const *, size_t)
+            {
+                calls.push_back(0);
+                // Enough handlers to make the vector grow under the caller.
+                for(int i = 1; i <= 64; ++i)
+                {
+                    channel.Subscribe([&calls, i](Damage const *, size_t)
+                        {
+                            calls.push_back(i);
+                        });
+                }
+                calls.push_back(-1);
+            });
+        channel.Publish(Damage{ 0, 1 });
+        CHECK(channel.Dispatch() == 1);
+        CHECK(calls == std::vector<int>{ 0, -1 });
+        calls.clear();
+        channel.Publish(Damage{ 0, 1 });
+        CHECK(channel.Dispatch() == 1);
+        CHECK(calls.size() == 2 + 64);
+        CHECK(calls[2] == 1);
+        CHECK(calls.back() == 64);
+    }
+
+    SECTION("The engine drains the bus during the frame.")
+    {
+        class Spawner final : public Node
+        {
+        public:
+            void Update(double const &dt) override
+            {
+                UNREFERENCED(dt);
+                static_cast<Engine &>(GetParent()).Find<EventBus>().Publish(Spawned{ "Slime" });
+            }
+        };
+        class Listener final : public Node
+        {
+        public:
+            void Initialize() override
+            {
+                static_cast<Engine &>(GetParent()).Find<EventBus>().Subscribe<Spawned>(
+                    [this](Spawned const *, size_t count) { heard_ += count; });
+            }
+            void PostDraw() override
+            {
+                // What was published this frame arrived before drawing.
+                if(heard_ == 3)
+                {
+                    static_cast<Engine &>(GetParent()).Stop();
+                }
+            }
+            size_t heard_ = 0;
+        };
+
+        Engine engine;
+        engine.AddOn<EventBus>();
+        engine.AddOn<Listener>();
+        engine.AddOn<Spawner>();
+        engine.Run();
+        CHECK(engine.Find<Listener>().heard_ == 3);
+    }
+}
+
+/*  ======================================================================== */
+/*  TIMERS                                                                   */
+/*  ======================================================================== */
+#include <Ludus/System/TimerWheel.hpp>
+
+TEST_CASE("Scheduling timers.", "[Timers]")
+{
+    using namespace Ludus;
+    TimerWheel timers;
+    std::vector<double> fired;
+    auto const record = [&]() { fired.push_back(timers.GetTime()); };
+
+    SECTION("Timers fire on the first tick at or after their time.")
+    {
+        // One delay per ring of the wheel, and one beyond its reach.
+        std::vector<double> const delays = { 0.0, 0.005, 0.3, 90.0, 20000.0, 5000000.0 };
+        for(double const delay : delays)
+        {
+            timers.Schedule(delay, record);
+        }
+        CHECK(timers.GetPendingCount() == delays.size());
+        timers.Advance(0.0004);
+        CHECK(fired.empty());
+        // Big uneven steps, the way frames after a stall come.
+        while(timers.GetPendingCount())
+        {
+            timers.Advance(fired.size() < 4 ? 0.0167 : 4321.0);
+        }
+        REQUIRE(fired.size() == delays.size());
+        // Both were due during the same frame.
+        CHECK(fired[0] == Catch::Approx(0.0171));
+        CHECK(fired[1] == Catch::Approx(0.0171));
+        for(size_t i = 2; i < delays.size(); ++i)
+        {
+            CHECK(fired[i] >= delays[i]);
+            CHECK(fired[i] < delays[i] + (i < 4 ? 0.0168 : 4321.0));
+        }
+    }
+
+    SECTION("Cancelled timers never fire, and their ids go stale.")
+    {
+        TimerId const kept = timers.Schedule(0.5, record);
+        TimerId const cancelled = timers.Schedule(0.5, record);
+        CHECK(timers.Cancel(cancelled));
+        CHECK_FALSE(timers.Cancel(cancelled));
+        CHECK_FALSE(timers.IsPending(cancelled));
+        // The freed timer is reused, the old id doesn't reach the new one.
+        TimerId const reused = timers.Schedule(0.5, record);
+        CHECK(reused.index_ == cancelled.index_);
+        CHECK_FALSE(timers.Cancel(cancelled));
+        CHECK(timers.IsPending(reused));
+        timers.Advance(1.0);
+        CHECK(fired.size() == 2);
+        CHECK_FALSE(timers.IsPending(kept));
+        CHECK_FALSE(timers.Cancel(kept));
+        CHECK(timers.GetPendingCount() == 0);
+    }
+
+    SECTION("Repeating timers fire until cancelled, even by themselves.")
+    {
+        TimerId repeating{};
+        repeating = timers.Schedule(0.1, [&]()
+            {
+                record();
+                if(fired.size() == 5)
+                {
+                    CHECK(timers.Cancel(repeating));
+                }
+            }, 0.25);
+        timers.Advance(10.0);
+        REQUIRE(fired.size() == 5);
+        CHECK(fired.back() == Catch::Approx(10.0));
+        CHECK_FALSE(timers.IsPending(repeating));
+        CHECK(timers.GetPendingCount() == 0);
+
+        // Stepped by frames, each firing is a period after the last.
+        fired.clear();
+        repeating = timers.Schedule(0.1, record, 0.25);
+        for(unsigned frame = 0; frame < 120; ++frame)
+        {
+            timers.Advance(0.001);
+        }
+        REQUIRE(fired.size() == 1);
+        for(unsigned frame = 0; frame < 300; ++frame)
+        {
+            timers.Advance(0.001);
+        }
+        REQUIRE(fired.size() == 2);
+        CHECK(fired[1] - fired[0] == Catch::Approx(0.25).margin(0.0011));
+    }
+
+    SECTION("Callbacks due together fire as one batch and can change the wheel.")
+    {
+        // Whichever fires first cancels the other, due on the same tick.
+        TimerId rivals[2] = {};
+        for(unsigned i = 0; i < 2; ++i)
+        {
+            rivals[i] = timers.Schedule(0.01, [&, i]()
+                {
+                    record();
+                    CHECK(timers.Cancel(rivals[1 - i]));
+                    // Not part of the batch firing now, even if due already.
+                    timers.Schedule(0.0, record);
+                });
+        }
+        timers.Advance(0.0105);
+        CHECK(fired.size() == 1);
+        timers.Advance(0.001);
+        CHECK(fired.size() == 2);
+        CHECK(timers.GetPendingCount() == 0);
+    }
+
+    SECTION("The engine clock drives the wheel.")
+    {
+        Engine engine;
+        engine.AddOn<TimerWheel>();
+        engine.Find<TimerWheel>().Schedule(0.05, [&engine]() { engine.Stop(); });
+        engine.Run();
+        CHECK(engine.Find<TimerWheel>().GetTime() >= 0.05);
+    }
+
+    CHECK_THROWS_AS(TimerWheel(0.0), std::invalid_argument);
+}
+
+TEST_CASE("Benchmarking a million pending timers.", "[Timers][!benchmark]")
+{
+    using namespace Ludus;
+    constexpr unsigned Timers = 1000000;
+    TimerWheel timers;
+    std::mt19937 random(42);
+    // Due in a day or two, the way respawns and long cooldowns are.
+    std::uniform_real_distribution<double> delays(86400.0, 172800.0);
+    size_t fired = 0;
+    std::vector<TimerId> ids;
+    ids.reserve(Timers);
+    for(unsigned i = 0; i < Timers; ++i)
+    {
+        ids.push_back(timers.Schedule(delays(random), [&fired]() { ++fired; }));
+    }
+
+    BENCHMARK("Running a frame")
+    {
+        timers.Advance(1.0 / 60.0);
+        return fired;
+    };
+    BENCHMARK("Scheduling and cancelling a timer")
+    {
+        return timers.Cancel(timers.Schedule(delays(random), [&fired]() { ++fired; }));
+    };
+    BENCHMARK("Scheduling and firing a hundred thousand timers")
+    {
+        TimerWheel all;
+        for(unsigned i = 0; i < Timers / 10; ++i)
+        {
+            all.Schedule(static_cast<double>(i % 1000) / 100.0, [&fired]() { ++fired; });
+        }
+        all.Advance(11.0);
+        return fired;
+    };
+}
+
+/*  ======================================================================== */
+/*  TASKS                                                                    */
+/*  ======================================================================== */
+#include <Ludus/System/Task.hpp>
+#include <cctype>
+
+namespace
+{
+    Ludus::Task CountFrames(std::vector<std::string> &log)
+    {
+        using namespace Ludus;
+        log.push_back("start");
+        for(unsigned frame = 1; frame <= 2; ++frame)
+        {
+            co_await NextFrame();
+            log.push_back("frame " + std::to_string(frame));
+        }
+        co_await NextFixedStep();
+        log.push_back("fixed step");
+        co_await WaitSeconds(0.5);
+        log.push_back("seconds");
+    }
+
+    Ludus::Task Fail(unsigned frames)
+    {
+        for(unsigned frame = 0; frame < frames; ++frame)
+        {
+            co_await Ludus::NextFrame();
+        }
+        throw std::runtime_error("The task failed.");
+    }
+
+    Ludus::Task AwaitChildren(std::vector<std::string> &log)
+    {
+        co_await CountFrames(log);
+        try
+        {
+            co_await Fail(1);
+        }
+        catch(std::runtime_error const &error)
+        {
+            log.push_back(error.what());
+        }
+    }
+
+    Ludus::Task LoadAndCompute(Ludus::AssetManager &assets, Ludus::JobSystem &jobs,
+        std::string const &path, std::string &result)
+    {
+        using namespace Ludus;
+        AssetHandle<std::string> const text = co_await LoadAsset<std::string>(assets, path);
+        std::string upper;
+        co_await WaitForJob(jobs, [&text, &upper]()
+            {
+                for(char const letter : text.Get())
+                {
+                    upper.push_back(static_cast<char>(std::toupper(letter)));
+                }
+            });
+        try
+        {
+            co_await WaitForJob(jobs, []() { throw std::runtime_error("The job failed."); });
+        }
+        catch(std::runtime_error const &error)
+        {
+            upper += error.what();
+        }
+        result = upper;
+    }
+
+    Ludus::Task WaitFrame(size_t &resumed)
+    {
+        co_await Ludus::NextFrame();
+        ++resumed;
+    }
+}
+
+TEST_CASE("Running tasks across frames.", "[Tasks]")
+{
+    using namespace Ludus;
+    TaskScheduler scheduler;
+    std::vector<std::string> log;
+
+    SECTION("Tasks resume at the point of the frame they wait for.")
+    {
+        scheduler.Start(CountFrames(log));
+        CHECK(log == std::vector<std::string>{ "start" });
+        CHECK(scheduler.GetTaskCount() == 1);
+        scheduler.Update(0.016);
+        scheduler.FixedUpdate(0.016);
+        CHECK(log.size() == 1);
+        scheduler.BeginFrame();
+        CHECK(log.back() == "frame 1");
+        // Waiting again from BeginFrame waits for the frame after.
+        scheduler.BeginFrame();
+        CHECK(log.back() == "frame 2");
+        scheduler.BeginFrame();
+        scheduler.FixedUpdate(0.016);
+        CHECK(log.back() == "fixed step");
+        scheduler.Update(0.3);
+        CHECK(log.back() == "fixed step");
+        scheduler.Update(0.3);
+        CHECK(log.back() == "seconds");
+        CHECK(scheduler.GetTaskCount() == 0);
+    }
+
+    SECTION("Tasks await other tasks and catch what they throw.")
+    {
+        scheduler.Start(AwaitChildren(log));
+        for(unsigned frame = 0; frame < 5; ++frame)
+        {
+            scheduler.BeginFrame();
+            scheduler.Update(0.3);
+            scheduler.FixedUpdate(0.016);
+        }
+        CHECK(log.back() == "The task failed.");
+        CHECK(log.size() == 6);
+        CHECK(scheduler.GetTaskCount() == 0);
+    }
+
+    SECTION("What a started task throws comes out of the scheduler.")
+    {
+        CHECK_THROWS_AS(scheduler.Start(Fail(0)), std::runtime_error);
+        scheduler.Start(Fail(1));
+        CHECK_THROWS_AS(scheduler.BeginFrame(), std::runtime_error);
+        CHECK(scheduler.GetTaskCount() == 0);
+        // Never started, it's freed with its Task.
+        Task const idle = Fail(0);
+        CHECK_FALSE(idle.IsDone());
+    }
+
+    SECTION("Tasks wait on assets and jobs without blocking the frame.")
+    {
+        std::string const path = WriteAsset("Ludus-Task.txt", "tasks");
+        AssetManager assets(1);
+        JobSystem jobs(2);
+        std::string result;
+        scheduler.Start(LoadAndCompute(assets, jobs, path, result));
+        for(unsigned frame = 0; frame < 10000 && scheduler.GetTaskCount(); ++frame)
+        {
+            assets.BeginFrame();
+            scheduler.Update(0.001);
+            std::this_thread::yield();
+        }
+        CHECK(result == "TASKSThe job failed.");
+        CHECK(scheduler.GetTaskCount() == 0);
+        std::remove(path.c_str());
+    }
+
+    SECTION("Unfinished tasks are freed with the scheduler.")
+    {
+        std::vector<std::string> unfinished;
+        {
+            TaskScheduler temporary;
+            temporary.Start(AwaitChildren(unfinished));
+            temporary.BeginFrame();
+            CHECK(temporary.GetTaskCount() == 1);
+        }
+        CHECK(unfinished == std::vector<std::string>{ "start", "frame 1" });
+    }
+
+    SECTION("The engine resumes the tasks from its frame loop.")
+    {
+        Engine engine;
+        engine.AddOn<TaskScheduler>();
+        auto const stopLater = [](Engine &running, std::vector<std::string> &steps) -> Task
+        {
+            co_await NextFrame();
+            steps.push_back("frame");
+            co_await NextFixedStep();
+            steps.push_back("fixed step");
+            co_await WaitSeconds(0.01);
+            steps.push_back("seconds");
+            running.Stop();
+        };
+        engine.Find<TaskScheduler>().Start(stopLater(engine, log));
+        engine.Run();
+        CHECK(log == std::vector<std::string>{ "frame", "fixed step", "seconds" });
+    }
+}
+
+TEST_CASE("Benchmarking tasks waiting on frames.", "[Tasks][!benchmark]")
+{
+    using namespace Ludus;
+    TaskScheduler scheduler;
+    size_t resumed = 0;
+    BENCHMARK("Starting and resuming a thousand tasks")
+    {
+        for(unsigned i = 0; i < 1000; ++i)
+        {
+            scheduler.Start(WaitFrame(resumed));
+        }
+        scheduler.BeginFrame();
+        return resumed;
+    };
+}
+
+/*  ======================================================================== */
+/*  LOGGING                                                                  */
+/*  ======================================================================== */
+#include <Ludus/System/Logger.hpp>
+
+TEST_CASE("Logging from many threads.", "[Logging]")
+{
+    using namespace Ludus;
+    Logger logger;
+    std::vector<LogRecord> records;
+    logger.AddSink([&records](LogRecord const &record) { records.push_back(record); });
+
+    SECTION("Messages are formatted later, from copies of their arguments.")
+    {
+        std::string name = "Goblin";
+        int const value = -42;
+        LUDUS_LOG_TO(logger, INFO, GAMEPLAY, "{} took {} damage, {} left, {}",
+            name, value, 0.5f, true);
+        name = "Changed";
+        LUDUS_LOG_TO(logger, WARNING, ASSETS, "No arguments.");
+        LUDUS_LOG_TO(logger, ERROR, ENGINE, "{}{}: {}", 'x', LogLevel::FATAL,
+            static_cast<char const *>("text"));
+        logger.Flush();
+        REQUIRE(records.size() == 3);
+        CHECK(records[0].message_ == "Goblin took -42 damage, 0.5 left, true");
+        CHECK(records[0].site_->level_ == LogLevel::INFO);
+        CHECK(records[0].site_->category_ == LogCategory::GAMEPLAY);
+        CHECK(records[1].message_ == "No arguments.");
+        CHECK(records[2].message_ == "x5: text");
+        CHECK(records[0].time_ <= records[1].time_);
+        CHECK(Logger::FormatLine(records[1]).find("WARNING Assets   No arguments.") !=
+            std::string::npos);
+    }
+
+    SECTION("Filtered messages don't evaluate their arguments.")
+    {
+        unsigned evaluated = 0;
+        logger.SetLevel(LogLevel::WARNING);
+        logger.SetCategoryEnabled(LogCategory::GRAPHICS, false);
+        LUDUS_LOG_TO(logger, INFO, GENERAL, "{}", ++evaluated);
+        LUDUS_LOG_TO(logger, ERROR, GRAPHICS, "{}", ++evaluated);
+        LUDUS_LOG_TO(logger, ERROR, GENERAL, "{}", ++evaluated);
+        CHECK(evaluated == 1);
+        // Below the compiled level, the call isn't even there.
+        logger.SetLevel(LogLevel::TRACE);
+        unsigned compiled = 0;
+        LUDUS_LOG_TO(logger, TRACE, GENERAL, "{}", ++compiled);
+        CHECK(compiled == (LUDUS_LOG_LEVEL == 0x00 ? 1 : 0));
+        logger.Flush();
+        REQUIRE(records.size() == 1 + compiled);
+        CHECK(records[0].message_ == "1");
+        CHECK_FALSE(logger.IsEnabled(LogLevel::ERROR, LogCategory::GRAPHICS));
+    }
+
+    SECTION("Every thread keeps its order.")
+    {
+        constexpr size_t Messages = 20000;
+        JobSystem jobs(3);
+        jobs.ParallelFor(Messages, 500, [&logger](size_t begin, size_t end)
+            {
+                for(size_t i = begin; i < end; ++i)
+                {
+                    LUDUS_LOG_TO(logger, INFO, ENGINE, "{}", i);
+                    // Slow enough for the rings to keep up.
+                    if(i % 64 == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        logger.Flush();
+        CHECK(records.size() + logger.GetDroppedCount() == Messages);
+        std::vector<std::int64_t> last(8, -1);
+        bool ordered = true;
+        for(LogRecord const &record : records)
+        {
+            if(record.thread_ >= last.size() || last[record.thread_] > record.time_)
+            {
+                ordered = false;
+                break;
+            }
+            last[record.thread_] = record.time_;
+        }
+        CHECK(ordered);
+    }
+
+    SECTION("A full ring drops messages instead of waiting.")
+    {
+        Logger small(256);
+        size_t received = 0;
+        small.AddSink([&received](LogRecord const &) { ++received; });
+        for(unsigned i = 0; i < 1000; ++i)
+        {
+            LUDUS_LOG_TO(small, INFO, GENERAL, "{} {} {}", i, i, std::string(40, 'x'));
+        }
+        small.Flush();
+        CHECK(small.GetDroppedCount() > 0);
+        CHECK(received + small.GetDroppedCount() == 1000);
+    }
+}
+
+TEST_CASE("Benchmarking logging from a hot loop.", "[Logging][!benchmark]")
+{
+    using namespace Ludus;
+    Logger logger(1 << 22);
+    size_t received = 0;
+    logger.AddSink([&received](LogRecord const &) { ++received; });
+    std::string const name = "Goblin";
+    unsigned count = 0;
+    logger.SetLevel(LogLevel::INFO);
+
+    BENCHMARK("Logging a message with three arguments")
+    {
+        LUDUS_LOG_TO(logger, INFO, GAMEPLAY, "{} took {} damage at {}", name, ++count, 0.25);
+        return count;
+    };
+    BENCHMARK("Skipping a filtered message")
+    {
+        LUDUS_LOG_TO(logger, TRACE, GAMEPLAY, "{} took {} damage at {}", name, ++count, 0.25);
+        return count;
+    };
+    logger.Flush();
+}
+
+/*  ======================================================================== */
+/*  INPUT                                                                    */
+/*  ======================================================================== */
+#include <Ludus/System/Input.hpp>
+
+namespace
+{
+    Ludus::InputEvent MakeInput(std::int64_t time, Ludus::InputDevice device,
+        Ludus::InputAction action, std::uint16_t code, float x = 0.0f, float y = 0.0f)
+    {
+        return Ludus::InputEvent{ time, device, action, 0, code, x, y };
+    }
+}
+
+TEST_CASE("Collecting input.", "[Input]")
+{
+    using namespace Ludus;
+    Input input(64);
+    input.BeginFrame();
+    std::int64_t const start = input.GetStepTime();
+
+    SECTION("Frames see what's held and what changed since the last one.")
+    {
+        input.Push(MakeInput(start + 1, InputDevice::KEYBOARD, InputAction::PRESS, 0x04));
+        input.Push(MakeInput(start + 3, InputDevice::MOUSE, InputAction::MOVE, 0, 10.0f, 20.0f));
+        input.Push(MakeInput(start + 2, InputDevice::KEYBOARD, InputAction::RELEASE, 0x04));
+        input.Push(MakeInput(start + 4, InputDevice::MOUSE, InputAction::PRESS, 1));
+        input.BeginFrame();
+        REQUIRE(input.GetFrameEvents().size() == 4);
+        CHECK(input.GetFrameEvents()[1].action_ == InputAction::RELEASE);
+        CHECK(input.WasPressed(InputDevice::KEYBOARD, 0x04));
+        CHECK(input.WasReleased(InputDevice::KEYBOARD, 0x04));
+        CHECK_FALSE(input.GetState().IsDown(InputDevice::KEYBOARD, 0x04));
+        CHECK(input.GetState().IsDown(InputDevice::MOUSE, 1));
+        CHECK(input.GetState().GetPointerY() == 20.0f);
+
+        input.BeginFrame();
+        CHECK(input.GetFrameEvents().empty());
+        CHECK_FALSE(input.WasPressed(InputDevice::MOUSE, 1));
+        CHECK(input.GetState().IsDown(InputDevice::MOUSE, 1));
+        CHECK(input.GetPreviousState().IsDown(InputDevice::MOUSE, 1));
+    }
+
+    SECTION("Fixed steps get the events of the time they stand for.")
+    {
+        constexpr std::int64_t Millisecond = 1000000;
+        input.Push(MakeInput(start + 5 * Millisecond, InputDevice::GAMEPAD,
+            InputAction::MOVE, 2, 0.75f));
+        input.Push(MakeInput(start + 25 * Millisecond, InputDevice::GAMEPAD,
+            InputAction::PRESS, 3));
+        input.BeginFrame();
+        CHECK(input.GetState().IsDown(InputDevice::GAMEPAD, 3));
+        std::vector<size_t> counts;
+        for(unsigned step = 0; step < 3; ++step)
+        {
+            input.FixedUpdate(0.01);
+            counts.push_back(input.GetStepEvents().size());
+            if(step == 1)
+            {
+                CHECK(input.GetStepState().GetAxis(2) == 0.75f);
+                CHECK_FALSE(input.GetStepState().IsDown(InputDevice::GAMEPAD, 3));
+            }
+        }
+        CHECK(counts == std::vector<size_t>{ 1, 0, 1 });
+        CHECK(input.GetStepState().IsDown(InputDevice::GAMEPAD, 3));
+        CHECK(input.GetStepTime() == start + 30 * Millisecond);
+    }
+
+    SECTION("A full ring drops events instead of waiting.")
+    {
+        for(unsigned i = 0; i < 100; ++i)
+        {
+            input.Push(MakeInput(start + i, InputDevice::KEYBOARD, InputAction::PRESS, 0x05));
+        }
+        input.BeginFrame();
+        CHECK(input.GetFrameEvents().size() == 64);
+        CHECK(input.GetDroppedCount() == 36);
+    }
+
+    SECTION("Many threads push at once.")
+    {
+        Input shared(4096);
+        std::vector<std::thread> threads;
+        for(std::uint16_t thread = 0; thread < 3; ++thread)
+        {
+            threads.emplace_back([&shared, thread]()
+                {
+                    for(unsigned i = 0; i < 1000; ++i)
+                    {
+                        shared.Push(MakeInput(Input::Now(), InputDevice::KEYBOARD,
+                            InputAction::PRESS, thread));
+                    }
+                });
+        }
+        for(std::thread &thread : threads)
+        {
+            thread.join();
+        }
+        shared.BeginFrame();
+        std::vector<InputEvent> const &events = shared.GetFrameEvents();
+        CHECK(events.size() == 3000);
+        CHECK(std::is_sorted(events.begin(), events.end(),
+            [](InputEvent const &lhs, InputEvent const &rhs) { return lhs.time_ < rhs.time_; }));
+    }
+
+    SECTION("Scripted input measures the latency without a window.")
+    {
+        constexpr std::int64_t Delay = 2000000;
+        auto script = std::make_unique<ScriptedInput>(std::vector<InputEvent>{
+            MakeInput(Delay, InputDevice::KEYBOARD, InputAction::PRESS, 0x2C),
+            MakeInput(2 * Delay, InputDevice::KEYBOARD, InputAction::RELEASE, 0x2C) });
+        ScriptedInput const &playing = *script;
+        input.AddSource(std::move(script));
+        std::int64_t latency = -1;
+        for(unsigned frame = 0; frame < 1000 && !playing.IsDone(); ++frame)
+        {
+            input.BeginFrame();
+            if(input.WasPressed(InputDevice::KEYBOARD, 0x2C))
+            {
+                latency = Input::Now() - input.GetFrameEvents().front().time_;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+        CHECK(playing.IsDone());
+        CHECK(latency >= 0);
+        CHECK(latency < 1000000000);
+    }
+}
+
+/*  ======================================================================== */
+/*  SWAPCHAIN                                                                */
+/*  ======================================================================== */
+#include <array>
+
+namespace
+{
+    Ludus::Window MakeWindow(Ludus::PresentMode mode, unsigned buffers,
+        unsigned framesInFlight)
+    {
+        Ludus::Window::Swapchain swapchain;
+        swapchain.width_ = 32;
+        swapchain.height_ = 16;
+        swapchain.buffers_ = buffers;
+        swapchain.presentMode_ = mode;
+        swapchain.framesInFlight_ = framesInFlight;
+        swapchain.refreshRate_ = 500;
+        return Ludus::Window({ L"Swapchain", Ludus::Graphics::SOFTWARE }, swapchain);
+    }
+}
+
+TEST_CASE("Presenting the swapchain.", "[Swapchain]")
+{
+    using namespace Ludus;
+    Device device(32, 16);
+
+    SECTION("The settings of the swapchain are checked.")
+    {
+        CHECK_THROWS_AS(MakeWindow(PresentMode::FIFO, 1, 1), std::invalid_argument);
+        CHECK_THROWS_AS(MakeWindow(PresentMode::FIFO, 4, 1), std::invalid_argument);
+        CHECK_THROWS_AS(MakeWindow(PresentMode::FIFO, 2, 0), std::invalid_argument);
+    }
+
+    SECTION("Immediate frames show right away.")
+    {
+        Window window = MakeWindow(PresentMode::IMMEDIATE, 2, 1);
+        device.Clear(PackColor(10, 20, 30));
+        window.Present(device, Input::Now());
+        CHECK(window.GetFrontBuffer()[32 * 16 - 1] == PackColor(10, 20, 30));
+        device.Clear(PackColor(40, 50, 60));
+        window.Present(device);
+        CHECK(window.GetFrontBuffer()[0] == PackColor(40, 50, 60));
+        Window::PresentStatistics const statistics = window.GetPresentStatistics();
+        CHECK(statistics.presented_ == 2);
+        CHECK(statistics.displayed_ == 2);
+        CHECK(statistics.maxLatency_ < 100000000);
+    }
+
+    SECTION("Fifo shows every frame, one per refresh.")
+    {
+        Window window = MakeWindow(PresentMode::FIFO, 3, 2);
+        auto const start = std::chrono::steady_clock::now();
+        for(std::uint8_t frame = 0; frame < 10; ++frame)
+        {
+            window.WaitForFrame();
+            std::int64_t const input = Input::Now();
+            device.Clear(PackColor(frame, 0, 0));
+            window.Present(device, input);
+        }
+        // The last frames wait for their refreshes.
+        CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(14));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        Window::PresentStatistics const statistics = window.GetPresentStatistics();
+        CHECK(statistics.displayed_ == 10);
+        CHECK(statistics.dropped_ == 0);
+        CHECK(window.GetFrontBuffer()[0] == PackColor(9, 0, 0));
+        // Up to two frames queued ahead of the one shown.
+        CHECK(statistics.averageLatency_ > 0);
+        CHECK(statistics.lastLatency_ <= statistics.maxLatency_);
+    }
+
+    SECTION("Fewer frames in flight mean fresher input.")
+    {
+        auto measure = [&device](unsigned framesInFlight)
+        {
+            Window window = MakeWindow(PresentMode::FIFO, 3, framesInFlight);
+            for(unsigned frame = 0; frame < 20; ++frame)
+            {
+                window.WaitForFrame();
+                window.Present(device, Input::Now());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return window.GetPresentStatistics().averageLatency_;
+        };
+        CHECK(measure(1) < measure(2));
+    }
+
+    SECTION("Mailbox replaces frames the display didn't get to.")
+    {
+        Window window = MakeWindow(PresentMode::MAILBOX, 2, 2);
+        auto const start = std::chrono::steady_clock::now();
+        for(std::uint8_t frame = 0; frame < 50; ++frame)
+        {
+            device.Clear(PackColor(frame, 0, 0));
+            window.Present(device);
+        }
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(50));
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        Window::PresentStatistics const statistics = window.GetPresentStatistics();
+        CHECK(statistics.dropped_ > 0);
+        CHECK(statistics.displayed_ + statistics.dropped_ == 50);
+        CHECK(window.GetFrontBuffer()[0] == PackColor(49, 0, 0));
+    }
+}
+
+TEST_CASE("Resizing the swapchain.", "[Swapchain]")
+{
+    using namespace Ludus;
+    Device device(32, 16);
+    Window window = MakeWindow(PresentMode::IMMEDIATE, 2, 1);
+
+    SECTION("Resizes wait for the end of the frame and only the last counts.")
+    {
+        window.SetSwapchainDimensions(100, 100);
+        window.SetSwapchainDimensions(40, 20);
+        CHECK(window.GetWidth() == 40);
+        CHECK(device.GetWidth() == 32);
+        CHECK(window.GetSwapchain().width_ == 32);
+        window.Present(device);
+        CHECK(device.GetWidth() == 40);
+        CHECK(device.GetHeight() == 20);
+        CHECK(window.GetSwapchain().height_ == 20);
+        CHECK(window.GetReallocationCount() == 1);
+    }
+
+    SECTION("Shrinking keeps to a corner of the images.")
+    {
+        window.SetSwapchainDimensions(20, 10);
+        window.Present(device);
+        CHECK(window.GetReallocationCount() == 0);
+        CHECK(device.GetPitch() == 32);
+        CHECK(window.GetPitch() == 32);
+        device.Clear(PackColor(1, 2, 3));
+        device.DrawQuads(std::array<Vertex2D, 4>{ Vertex2D{ 0, 0, 0, 0, 0xFFFFFFFFu },
+            Vertex2D{ 100, 0, 0, 0, 0xFFFFFFFFu }, Vertex2D{ 100, 100, 0, 0, 0xFFFFFFFFu },
+            Vertex2D{ 0, 100, 0, 0, 0xFFFFFFFFu } }.data(), 1, nullptr, BlendMode::OPAQUE);
+        window.Present(device);
+        Color const *front = window.GetFrontBuffer();
+        CHECK(front[9 * 32 + 19] == 0xFFFFFFFFu);
+        // Outside of the corner in use, nothing was drawn.
+        CHECK(front[9 * 32 + 20] == PackColor(0, 0, 0));
+        CHECK(device.GetPixel(20, 9) == PackColor(0, 0, 0));
+    }
+
+    SECTION("Dragging an edge only reallocates now and then.")
+    {
+        for(unsigned frame = 0; frame < 100; ++frame)
+        {
+            for(unsigned event = 1; event <= 5; ++event)
+            {
+                window.SetSwapchainDimensions(32 + frame * 5 + event, 16 + frame);
+            }
+            window.Present(device);
+        }
+        CHECK(device.GetWidth() == 32 + 99 * 5 + 5);
+        CHECK(window.GetSwapchain().height_ == 16 + 99);
+        // Out of 500 resize events growing both sides.
+        CHECK(window.GetReallocationCount() < 25);
+    }
+}
+
+/*  ======================================================================== */
+/*  RESOURCES                                                                */
+/*  ======================================================================== */
+#include <Ludus/Graphics/Resources.hpp>
+#include <cstring>
+
+TEST_CASE("Creating device resources.", "[Resources]")
+{
+    using namespace Ludus;
+    Device device(8, 8);
+    device.SetFramesInFlight(2);
+
+    SECTION("Resources are named by handles that go stale.")
+    {
+        BufferHandle const buffer = device.CreateBuffer(64);
+        TextureHandle const texture = device.CreateTexture(4, 2, PackColor(1, 2, 3));
+        FramebufferHandle const framebuffer = device.CreateFramebuffer(16, 8);
+        CHECK(device.GetBuffer(buffer).bytes_.size() == 64);
+        CHECK(device.GetTexture(texture).GetTexel(3, 1) == PackColor(1, 2, 3));
+        CHECK(device.GetFramebuffer(framebuffer).depth_.size() == 16 * 8);
+        CHECK_THROWS_AS(device.GetBuffer(BufferHandle()), std::invalid_argument);
+
+        device.DestroyTexture(texture);
+        CHECK_FALSE(device.GetTexturePool().IsAlive(texture));
+        CHECK_THROWS_AS(device.GetTexture(texture), std::invalid_argument);
+        CHECK_THROWS_AS(device.DestroyTexture(texture), std::invalid_argument);
+        CHECK(device.GetTexturePool().GetRetiredCount() == 1);
+    }
+
+    SECTION("Destroyed resources wait for the frames in flight.")
+    {
+        BufferHandle const first = device.CreateBuffer(256);
+        std::uint8_t const *bytes = device.GetBuffer(first).bytes_.data();
+        device.DestroyBuffer(first);
+        device.EndFrame();
+        device.EndFrame();
+        // Still read by a frame in flight, so a new slot is taken.
+        BufferHandle const second = device.CreateBuffer(16);
+        CHECK(second.index_ != first.index_);
+        device.EndFrame();
+        CHECK(device.GetBufferPool().GetRetiredCount() == 0);
+
+        BufferHandle const third = device.CreateBuffer(128);
+        CHECK(third.index_ == first.index_);
+        CHECK(third.generation_ != first.generation_);
+        CHECK_FALSE(device.GetBufferPool().IsAlive(first));
+        // The memory of the slot is reused, and zeroed.
+        CHECK(device.GetBuffer(third).bytes_.data() == bytes);
+        CHECK(device.GetBuffer(third).bytes_[127] == 0);
+        CHECK(device.GetBufferPool().GetCapacity() == 2);
+        CHECK(device.GetBufferPool().GetLiveCount() == 2);
+    }
+
+    SECTION("The renderer ends the frames of the device.")
+    {
+        Renderer renderer(device);
+        device.DestroyFramebuffer(device.CreateFramebuffer(4, 4));
+        renderer.Submit();
+        renderer.Submit();
+        CHECK(device.GetFramebufferPool().GetRetiredCount() == 1);
+        renderer.Submit();
+        CHECK(device.GetFrame() == 3);
+        CHECK(device.GetFramebufferPool().GetRetiredCount() == 0);
+    }
+
+    SECTION("Destroying every frame keeps only the frames in flight.")
+    {
+        for(unsigned frame = 0; frame < 1000; ++frame)
+        {
+            for(unsigned buffer = 0; buffer < 8; ++buffer)
+            {
+                device.DestroyBuffer(device.CreateBuffer(32));
+            }
+            device.EndFrame();
+            CHECK(device.GetBufferPool().GetRetiredCount() <= 8 * 3);
+        }
+        CHECK(device.GetBufferPool().GetCapacity() <= 8 * 4);
+    }
+}
+
+TEST_CASE("Benchmarking resource churn.", "[Resources][!benchmark]")
+{
+    using namespace Ludus;
+    Device device(8, 8);
+    std::vector<TextureHandle> textures;
+    textures.reserve(256);
+
+    BENCHMARK("Creating and destroying 256 textures a frame")
+    {
+        for(unsigned i = 0; i < 256; ++i)
+        {
+            textures.push_back(device.CreateTexture(16, 16));
+        }
+        for(TextureHandle const texture : textures)
+        {
+            device.DestroyTexture(texture);
+        }
+        textures.clear();
+        device.EndFrame();
+        return device.GetTexturePool().GetCapacity();
+    };
+}
+
+TEST_CASE("Uploading the data of every frame.", "[Resources]")
+{
+    using namespace Ludus;
+    Device device(8, 8);
+    device.SetFramesInFlight(1);
+    device.SetUploadSize(1000);
+    UploadRing const &ring = device.GetUploadRing();
+    CHECK(ring.GetCapacity() == 3 * 1024);
+
+    SECTION("Allocations are aligned to cache lines and laid out in order.")
+    {
+        UploadAllocation const first = device.AllocateUpload(10);
+        UploadAllocation const second = device.AllocateUpload(100);
+        CHECK(reinterpret_cast<std::uintptr_t>(first.data_) % 64 == 0);
+        CHECK(first.offset_ == 0);
+        CHECK(second.offset_ == 64);
+        CHECK(second.data_ == first.data_ + 64);
+        CHECK(second.size_ == 100);
+        CHECK(ring.GetUsed() == 64 + 128);
+    }
+
+    SECTION("Frames get their memory back once out of flight.")
+    {
+        for(unsigned frame = 0; frame < 100; ++frame)
+        {
+            UploadAllocation const upload = device.AllocateUpload(1000);
+            std::memset(upload.data_, static_cast<int>(frame), upload.size_);
+            device.EndFrame();
+            // The frame just ended is in flight, the one before is done.
+            CHECK(ring.GetUsed() <= 2 * 1024);
+        }
+        CHECK(ring.GetUsed() == 1024);
+    }
+
+    SECTION("Frames within the budget never run out, wrapping or not.")
+    {
+        size_t const sizes[] = { 640, 1000, 1000, 999, 1, 320 };
+        for(unsigned frame = 0; frame < 300; ++frame)
+        {
+            size_t const size = sizes[frame % 6];
+            if(frame % 7 == 3)
+            {
+                // Sixteen small pieces, padded to the whole budget.
+                for(unsigned piece = 0; piece < 16; ++piece)
+                {
+                    REQUIRE_NOTHROW(device.AllocateUpload(10));
+                }
+            }
+            else
+            {
+                REQUIRE_NOTHROW(device.AllocateUpload(size));
+                REQUIRE_NOTHROW(device.AllocateUpload(1024 - (size + 63) / 64 * 64));
+            }
+            device.EndFrame();
+        }
+    }
+
+    SECTION("A frame uploading too much throws.")
+    {
+        device.AllocateUpload(1000);
+        device.EndFrame();
+        device.AllocateUpload(1000);
+        // Over the budget, only the spare frame takes it.
+        device.AllocateUpload(1000);
+        CHECK_THROWS_AS(device.AllocateUpload(1), std::length_error);
+        device.EndFrame();
+        CHECK_NOTHROW(device.AllocateUpload(1000));
+    }
+}
+
+TEST_CASE("Benchmarking uploads.", "[Resources][!benchmark]")
+{
+    using namespace Ludus;
+    Device device(8, 8);
+    device.SetUploadSize(1 << 20);
+    Vertex2D const quad[4] = {};
+
+    BENCHMARK("Uploading 4096 quads a frame")
+    {
+        for(unsigned i = 0; i < 4096; ++i)
+        {
+            UploadAllocation const upload = device.AllocateUpload(sizeof(quad));
+            std::memcpy(upload.data_, quad, sizeof(quad));
+        }
+        device.EndFrame();
+        return device.GetUploadRing().GetUsed();
+    };
+}
+
+/*  ======================================================================== */
+/*  TEXTURING                                                                */
+/*  ======================================================================== */
+#include <Ludus/Graphics/SampledTexture.hpp>
+#include <Ludus/Graphics/BlockCompression.hpp>
+
+TEST_CASE("Making mip chains.", "[Texturing]")
+{
+    using namespace Ludus;
+    Color const black = PackColor(0, 0, 0);
+    Color const white = PackColor(255, 255, 255);
+
+    SECTION("Levels halve down to a single texel.")
+    {
+        SampledTexture const square(Texture(4, 4));
+        CHECK(square.GetLevelCount() == 3);
+        CHECK(square.GetWidth(2) == 1);
+        SampledTexture const wide(Texture(8, 2));
+        REQUIRE(wide.GetLevelCount() == 4);
+        CHECK(wide.GetWidth(1) == 4);
+        CHECK(wide.GetHeight(1) == 1);
+        CHECK(wide.GetWidth(3) == 1);
+        CHECK_THROWS_AS(SampledTexture(Texture()), std::invalid_argument);
+    }
+
+    SECTION("The box filter averages squares of texels.")
+    {
+        Texture const checkers(2, 2, { black, white, white, black });
+        SampledTexture const sampled(checkers);
+        CHECK(sampled.GetTexel(1, 0, 0) == PackColor(128, 128, 128));
+    }
+
+    SECTION("The Kaiser filter keeps a flat texture flat.")
+    {
+        Color const gray = PackColor(100, 150, 200, 250);
+        SampledTexture const sampled(Texture(16, 8, gray), TextureLayout::TILED,
+            MipFilter::KAISER);
+        for(unsigned level = 0; level < sampled.GetLevelCount(); ++level)
+        {
+            CHECK(sampled.GetTexel(level, 0, 0) == gray);
+        }
+    }
+
+    SECTION("Tiled and linear layouts hold the same texels.")
+    {
+        std::vector<Color> texels(7 * 5);
+        for(size_t i = 0; i < texels.size(); ++i)
+        {
+            texels[i] = static_cast<Color>(i * 2654435761u);
+        }
+        Texture const source(7, 5, texels);
+        SampledTexture const linear(source, TextureLayout::LINEAR);
+        SampledTexture const tiled(source, TextureLayout::TILED);
+        REQUIRE(linear.GetLevelCount() == tiled.GetLevelCount());
+        for(unsigned level = 0; level < linear.GetLevelCount(); ++level)
+        {
+            for(unsigned y = 0; y < linear.GetHeight(level); ++y)
+            {
+                for(unsigned x = 0; x < linear.GetWidth(level); ++x)
+                {
+                    CHECK(linear.GetTexel(level, x, y) == tiled.GetTexel(level, x, y));
+                }
+            }
+        }
+        CHECK(linear.GetTexel(0, 6, 4) == texels[34]);
+    }
+}
+
+TEST_CASE("Sampling textures.", "[Texturing]")
+{
+    using namespace Ludus;
+    Color const black = PackColor(0, 0, 0);
+    Color const white = PackColor(255, 255, 255);
+    Color const gray = PackColor(128, 128, 128);
+
+    SECTION("Bilinear samples blend the nearest texels and wrap.")
+    {
+        SampledTexture const sampled(Texture(2, 1, { black, white }));
+        // More samples than a register holds, with a few left over.
+        float const u[6] = { 0.25f, 0.5f, 0.75f, 0.0f, 1.25f, -0.25f };
+        float const v[6] = { 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f };
+        Color colors[6] = {};
+        sampled.SampleBilinear(u, v, 6, 0, colors);
+        CHECK(colors[0] == black);
+        CHECK(colors[1] == gray);
+        CHECK(colors[2] == white);
+        CHECK(colors[3] == gray);
+        CHECK(colors[4] == black);
+        CHECK(colors[5] == white);
+    }
+
+    SECTION("Trilinear samples blend the nearest levels.")
+    {
+        SampledTexture const sampled(Texture(2, 2, { black, white, white, black }));
+        float const u[5] = { 0.25f, 0.25f, 0.25f, 0.25f, 0.25f };
+        float const v[5] = { 0.25f, 0.25f, 0.25f, 0.25f, 0.25f };
+        float const lod[5] = { 0.0f, 1.0f, 0.5f, 8.0f, -1.0f };
+        Color colors[5] = {};
+        sampled.SampleTrilinear(u, v, lod, 5, colors);
+        CHECK(colors[0] == black);
+        CHECK(colors[1] == gray);
+        CHECK(colors[2] == PackColor(64, 64, 64));
+        CHECK(colors[3] == gray);
+        CHECK(colors[4] == black);
+    }
+
+    SECTION("Levels that don't exist are rejected.")
+    {
+        SampledTexture const sampled(Texture(2, 2, { black, white, white, black }));
+        float const u[1] = { 0.25f };
+        float const v[1] = { 0.25f };
+        float const lod[1] = { std::nanf("") };
+        Color colors[1] = {};
+        CHECK_THROWS_AS(sampled.SampleBilinear(u, v, 1, 2, colors), std::out_of_range);
+        CHECK_THROWS_AS(sampled.GetWidth(2), std::out_of_range);
+        sampled.SampleTrilinear(u, v, lod, 1, colors);
+        CHECK(colors[0] == black);
+    }
+}
+
+TEST_CASE("Drawing filtered textures.", "[Texturing]")
+{
+    using namespace Ludus;
+    Color const black = PackColor(0, 0, 0);
+    Color const white = PackColor(255, 255, 255);
+    Color const gray = PackColor(128, 128, 128);
+    // Checks of a single texel, gray once averaged.
+    std::vector<Color> texels(64 * 64);
+    for(unsigned i = 0; i < texels.size(); ++i)
+    {
+        texels[i] = ((i % 64) + (i / 64)) % 2 ? white : black;
+    }
+    Texture const checkers(64, 64, texels);
+    Device device(16, 16);
+    auto const quad = [](float size, float skew)
+    {
+        return std::array<Vertex2D, 4>{ Vertex2D{ 0.0f, 0.0f, 0.0f, 0.0f, 0xFFFFFFFFu },
+            Vertex2D{ size, skew, 1.0f, 0.0f, 0xFFFFFFFFu },
+            Vertex2D{ size, size, 1.0f, 1.0f, 0xFFFFFFFFu },
+            Vertex2D{ 0.0f, size, 0.0f, 1.0f, 0xFFFFFFFFu } };
+    };
+
+    SECTION("Minified quads sample the smaller levels.")
+    {
+        SampledTexture const sampled(checkers);
+        // Eight texels a pixel, as rectangles and as triangles.
+        for(float const skew : { 0.0f, 0.01f })
+        {
+            device.Clear(PackColor(255, 0, 0));
+            device.DrawSampledQuads(quad(8.0f, skew).data(), 1, &sampled, BlendMode::OPAQUE);
+            CHECK(device.GetColorBuffer()[4 * 16 + 4] == gray);
+            CHECK(device.GetColorBuffer()[4 * 16 + 8] == PackColor(255, 0, 0));
+        }
+        // Sampling the nearest texel keeps the checks.
+        device.DrawQuads(quad(8.0f, 0.0f).data(), 1, &checkers, BlendMode::OPAQUE);
+        CHECK(device.GetColorBuffer()[4 * 16 + 4] != gray);
+    }
+
+    SECTION("Magnified quads blend the texels of the largest level.")
+    {
+        SampledTexture const sampled(Texture(2, 2, { black, white, white, black }));
+        device.DrawSampledQuads(quad(16.0f, 0.0f).data(), 1, &sampled, BlendMode::OPAQUE);
+        for(unsigned pixel : { 0u, 5u, 7u, 12u })
+        {
+            float const u[1] = { (pixel + 0.5f) / 16.0f };
+            float const v[1] = { 3.5f / 16.0f };
+            Color expected[1] = {};
+            sampled.SampleBilinear(u, v, 1, 0, expected);
+            CHECK(device.GetColorBuffer()[3 * 16 + pixel] == expected[0]);
+        }
+    }
+
+    SECTION("The renderer draws and captures filtered quads.")
+    {
+        std::string const path = (std::filesystem::temp_directory_path() /
+            "Ludus-Sampled.ldfc").string();
+        SampledTexture const sampled(checkers, TextureLayout::LINEAR, MipFilter::KAISER);
+        Renderer renderer(device);
+        renderer.Clear(PackColor(0, 0, 255));
+        size_t const first = renderer.AllocateQuads(1);
+        std::array<Vertex2D, 4> const vertices = quad(6.0f, 0.5f);
+        std::copy(vertices.begin(), vertices.end(), renderer.GetQuadVertices(first));
+        renderer.DrawSampledQuads(first, 1, &sampled, BlendMode::OPAQUE);
+        renderer.CaptureNextFrame(path);
+        renderer.Submit();
+        std::vector<Color> const expected(device.GetColorBuffer(),
+            device.GetColorBuffer() + 16 * 16);
+        CHECK(expected[3 * 16 + 3] != PackColor(0, 0, 255));
+
+        FrameCapture const capture = FrameCapture::Load(path);
+        Device replayDevice(capture.GetWidth(), capture.GetHeight());
+        Renderer replayRenderer(replayDevice);
+        capture.Record(replayRenderer);
+        replayRenderer.Submit();
+        CHECK(std::equal(expected.begin(), expected.end(), replayDevice.GetColorBuffer()));
+        std::remove(path.c_str());
+    }
+}
+
+TEST_CASE("Decoding compressed textures.", "[Texturing]")
+{
+    using namespace Ludus;
+    Color texels[16] = {};
+
+    SECTION("BC1 blocks with the first color greater use four colors.")
+    {
+        // Red and blue, then a texel of every index along the first row.
+        std::uint8_t const block[8] = { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0x00, 0x00, 0x00 };
+        DecodeBC1Block(block, texels);
+        CHECK(texels[0] == PackColor(255, 0, 0));
+        CHECK(texels[1] == PackColor(0, 0, 255));
+        CHECK(texels[2] == PackColor(170, 0, 85));
+        CHECK(texels[3] == PackColor(85, 0, 170));
+        CHECK(texels[4] == PackColor(255, 0, 0));
+    }
+
+    SECTION("BC1 blocks with the first color lesser use three and transparency.")
+    {
+        std::uint8_t const block[8] = { 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0x00, 0x00, 0x00 };
+        DecodeBC1Block(block, texels);
+        CHECK(texels[0] == PackColor(0, 0, 255));
+        CHECK(texels[1] == PackColor(255, 0, 0));
+        CHECK(texels[2] == PackColor(128, 0, 128));
+        CHECK(texels[3] == PackColor(0, 0, 0, 0));
+    }
+
+    SECTION("BC3 blocks interpolate their alpha.")
+    {
+        // Indices 0, 1 and 2 on the first three texels.
+        std::uint8_t block[16] = { 255, 0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+        DecodeBC3Block(block, texels);
+        CHECK(texels[0] == PackColor(255, 255, 255, 255));
+        CHECK(texels[1] == PackColor(255, 255, 255, 0));
+        CHECK(texels[2] == PackColor(255, 255, 255, 219));
+        CHECK(texels[3] == PackColor(255, 255, 255, 255));
+
+        // The lesser first alpha leaves room for opaque and transparent.
+        block[0] = 0;
+        block[1] = 255;
+        block[2] = 0xA8;
+        block[3] = 0x0F;
+        DecodeBC3Block(block, texels);
+        CHECK(GetChannel(texels[0], 3) == 0);
+        CHECK(GetChannel(texels[1], 3) == 204);
+        CHECK(GetChannel(texels[2], 3) == 0);
+        CHECK(GetChannel(texels[3], 3) == 255);
+        // The color block uses four colors no matter their order.
+        CHECK(GetChannel(texels[0], 0) == 255);
+    }
+
+    SECTION("Whole textures cut the blocks on their edges.")
+    {
+        std::vector<std::uint8_t> blocks(2 * 8);
+        // A red block followed by a blue one.
+        blocks[1] = 0xF8;
+        blocks[3] = 0xF8;
+        blocks[8] = 0x1F;
+        blocks[10] = 0x1F;
+        Texture const texture = DecodeBC1(blocks.data(), blocks.size(), 6, 3);
+        REQUIRE(texture.GetWidth() == 6);
+        REQUIRE(texture.GetHeight() == 3);
+        CHECK(texture.GetData()[3] == PackColor(255, 0, 0));
+        CHECK(texture.GetData()[4] == PackColor(0, 0, 255));
+        CHECK(texture.GetData()[2 * 6 + 5] == PackColor(0, 0, 255));
+        CHECK_THROWS_AS(DecodeBC1(blocks.data(), blocks.size(), 6, 5),
+            std::invalid_argument);
+        CHECK_THROWS_AS(DecodeBC3(blocks.data(), blocks.size(), 6, 3),
+            std::invalid_argument);
+    }
+}
+
+TEST_CASE("Benchmarking texture sampling.", "[Texturing][!benchmark]")
+{
+    using namespace Ludus;
+    std::mt19937 random(7);
+    std::vector<Color> texels(512 * 512);
+    for(Color &texel : texels)
+    {
+        texel = static_cast<Color>(random());
+    }
+    Texture const source(512, 512, texels);
+    SampledTexture const linear(source, TextureLayout::LINEAR);
+    SampledTexture const tiled(source, TextureLayout::TILED);
+
+    // A quad drawn slightly rotated, so neighboring samples are in neighboring rows.
+    size_t constexpr Samples = 65536;
+    std::vector<float> u(Samples), v(Samples), lod(Samples);
+    for(size_t i = 0; i < Samples; ++i)
+    {
+        float const x = static_cast<float>(i % 256) / 256.0f;
+        float const y = static_cast<float>(i / 256) / 256.0f;
+        u[i] = x * 0.98f - y * 0.17f;
+        v[i] = x * 0.17f + y * 0.98f;
+        lod[i] = static_cast<float>(i % 7) * 0.25f;
+    }
+    std::vector<Color> colors(Samples);
+
+    BENCHMARK("Sampling 65536 texels bilinearly, linear layout")
+    {
+        linear.SampleBilinear(u.data(), v.data(), Samples, 0, colors.data());
+        return colors[Samples / 2];
+    };
+    BENCHMARK("Sampling 65536 texels bilinearly, tiled layout")
+    {
+        tiled.SampleBilinear(u.data(), v.data(), Samples, 0, colors.data());
+        return colors[Samples / 2];
+    };
+    BENCHMARK("Sampling 65536 texels trilinearly, tiled layout")
+    {
+        tiled.SampleTrilinear(u.data(), v.data(), lod.data(), Samples, colors.data());
+        return colors[Samples / 2];
+    };
+
+    // The same quad through the device, minified to half its size.
+    Device device(256, 256);
+    std::array<Vertex2D, 4> const quad = { Vertex2D{ 0.0f, 0.0f, 0.0f, 0.0f, 0xFFFFFFFFu },
+        Vertex2D{ 256.0f, 0.0f, 2.0f, 0.0f, 0xFFFFFFFFu },
+        Vertex2D{ 256.0f, 256.0f, 2.0f, 2.0f, 0xFFFFFFFFu },
+        Vertex2D{ 0.0f, 256.0f, 0.0f, 2.0f, 0xFFFFFFFFu } };
+    BENCHMARK("Drawing a 256x256 quad, nearest texel")
+    {
+        device.DrawQuads(quad.data(), 1, &source, BlendMode::OPAQUE);
+        return device.GetColorBuffer()[128];
+    };
+    BENCHMARK("Drawing a 256x256 quad, trilinear")
+    {
+        device.DrawSampledQuads(quad.data(), 1, &tiled, BlendMode::OPAQUE);
+        return device.GetColorBuffer()[128];
+    };
+    BENCHMARK("Making the mips of 262144 texels with a box filter")
+    {
+        return SampledTexture(source, TextureLayout::TILED, MipFilter::BOX).GetLevelCount();
+    };
+    BENCHMARK("Making the mips of 262144 texels with a Kaiser filter")
+    {
+        return SampledTexture(source, TextureLayout::TILED, MipFilter::KAISER).GetLevelCount();
+    };
+
+    std::vector<std::uint8_t> blocks(64 * 64 * 8);
+    for(std::uint8_t &byte : blocks)
+    {
+        byte = static_cast<std::uint8_t>(random());
+    }
+    BENCHMARK("Decoding 65536 texels of BC1")
+    {
+        return DecodeBC1(blocks.data(), blocks.size(), 256, 256).GetData()[0];
+    };
+}
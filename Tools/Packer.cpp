@@ -0,0 +1,83 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Packer.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Packs every file under a directory into a single pack, keyed by their
+ * paths relative to the directory with forward slashes.
+ * Usage: Packer <directory> <pack>
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Assets/Pack.hpp"
+#include "Ludus/System/JobSystem.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+    if(argc < 3)
+    {
+        std::fprintf(stderr, "Usage: %s <directory> <pack>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        std::filesystem::path const root(argv[1]);
+        // Sorted, so the same directory always makes the same pack.
+        std::vector<std::filesystem::path> paths;
+        for(std::filesystem::directory_entry const &entry :
+            std::filesystem::recursive_directory_iterator(root))
+        {
+            if(entry.is_regular_file())
+            {
+                paths.push_back(entry.path());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+
+        Ludus::PackWriter writer;
+        size_t bytes = 0;
+        for(std::filesystem::path const &path : paths)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if(!file)
+            {
+                std::fprintf(stderr, "The file %s can't be read.\n", path.string().c_str());
+                return EXIT_FAILURE;
+            }
+            std::vector<std::uint8_t> const contents(
+                (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            writer.Add(path.lexically_relative(root).generic_string(), contents.data(),
+                contents.size());
+            bytes += contents.size();
+        }
+
+        Ludus::JobSystem jobs;
+        writer.Save(argv[2], &jobs);
+        Ludus::PackReader const pack(argv[2]);
+        std::printf("%s: %zu files, %zu bytes in %zu blocks, %ju bytes packed\n",
+            argv[2], pack.GetFileCount(), bytes, pack.GetBlockCount(),
+            static_cast<std::uintmax_t>(std::filesystem::file_size(argv[2])));
+    }
+    catch(std::exception const &error)
+    {
+        std::fprintf(stderr, "%s\n", error.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/* ========================================================================= */
+/**
+ * @author          David Wong Cascante
+ * @file            Replay.cpp
+ * @par             Ludus Engine
+ * @date            10/19/2026
+ *
+ * @brief
+ * Runs a captured frame on the software device over and over and reports
+ * how long every pass took, so renderer changes can be profiled without
+ * the rest of the engine.
+ * Usage: Replay <capture> [iterations]
+ **/
+/* ========================================================================= */
+
+/* ========================================================================= */
+/* Includes */
+/* ========================================================================= */
+#include "Ludus/Precompile.hpp"
+#include "Ludus/Graphics/Device.hpp"
+#include "Ludus/Graphics/FrameCapture.hpp"
+#include "Ludus/Graphics/Renderer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    /* ===================================================================== */
+    /** The timings gathered for one pass over every iteration. */
+    /* ===================================================================== */
+    struct PassSummary
+    {
+        /** The kind of command the pass runs. */
+        char const *name_;
+        /** The fastest run, in milliseconds. */
+        double min_;
+        /** The slowest run, in milliseconds. */
+        double max_;
+        /** Every run added together, in milliseconds. */
+        double total_;
+    };
+}
+
+int main(int argc, char **argv)
+{
+    if(argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <capture> [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    long const iterations = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 100;
+    if(iterations <= 0)
+    {
+        std::fprintf(stderr, "The iteration count must be positive.\n");
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Ludus::FrameCapture const capture = Ludus::FrameCapture::Load(argv[1]);
+        Ludus::Device device(capture.GetWidth(), capture.GetHeight());
+        Ludus::Renderer renderer(device);
+
+        // The first run warms the caches and sizes the scratch arrays.
+        capture.Record(renderer);
+        renderer.Submit();
+
+        std::vector<PassSummary> passes;
+        for(Ludus::Renderer::PassTiming const &timing : renderer.GetPassTimings())
+        {
+            passes.push_back(PassSummary{ timing.name_,
+                std::numeric_limits<double>::max(), 0.0, 0.0 });
+        }
+        for(long i = 0; i < iterations; ++i)
+        {
+            capture.Record(renderer);
+            renderer.Submit();
+            std::vector<Ludus::Renderer::PassTiming> const &timings =
+                renderer.GetPassTimings();
+            for(size_t pass = 0; pass < passes.size(); ++pass)
+            {
+                double const milliseconds = timings[pass].duration_.count() * 1e-6;
+                passes[pass].min_ = std::min(passes[pass].min_, milliseconds);
+                passes[pass].max_ = std::max(passes[pass].max_, milliseconds);
+                passes[pass].total_ += milliseconds;
+            }
+        }
+
+        std::printf("%s: %ux%u, %zu passes, %ld iterations\n", argv[1],
+            capture.GetWidth(), capture.GetHeight(), passes.size(), iterations);
+        std::printf("%5s  %-10s %10s %10s %10s\n", "pass", "kind", "min ms",
+            "mean ms", "max ms");
+        double frame = 0.0;
+        for(size_t pass = 0; pass < passes.size(); ++pass)
+        {
+            PassSummary const &summary = passes[pass];
+            std::printf("%5zu  %-10s %10.3f %10.3f %10.3f\n", pass, summary.name_,
+                summary.min_, summary.total_ / iterations, summary.max_);
+            frame += summary.total_ / iterations;
+        }
+        Ludus::Renderer::Statistics const &statistics = renderer.GetStatistics();
+        std::printf("frame: %.3f ms mean, %zu draws, %zu quads, %zu/%zu "
+            "instances visible, %zu triangles\n", frame, statistics.draws_,
+            statistics.quads_, statistics.visibleInstances_,
+            statistics.instances_, statistics.triangles_);
+    }
+    catch(std::exception const &error)
+    {
+        std::fprintf(stderr, "%s\n", error.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}